@@ -27,6 +27,12 @@ static const int NUMBER_BASE = 58;
 // Checksum digest algorithm
 static const char *CHECKSUM_DIGEST_ALGORITHM = "SHA-256";
 
+// Checksum digest
+static thread_local const unique_ptr<EVP_MD, decltype(&EVP_MD_free)> checksumDigest(EVP_MD_fetch(nullptr, CHECKSUM_DIGEST_ALGORITHM, nullptr), EVP_MD_free);
+
+// Checksum digest context
+static thread_local const unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> checksumDigestContext(EVP_MD_CTX_new(), EVP_MD_CTX_free);
+
 // Checksum size
 static const size_t CHECKSUM_SIZE = 4;
 
@@ -126,8 +132,16 @@ string Base58::encodeWithChecksum(const uint8_t *data, const size_t length) {
 // Decode
 vector<uint8_t> Base58::decode(const char *data) {
 
-	// Get length
-	const size_t length = strlen(data);
+	// Decode data into result
+	vector<uint8_t> result;
+	decodeInto(result, data, strlen(data));
+	
+	// Return result
+	return result;
+}
+
+// Decode into
+void Base58::decodeInto(vector<uint8_t> &result, const char *data, const size_t length) {
 	
 	// Go through all leading alphabet zeros in the data
 	size_t numberOfLeadingZeros = 0;
@@ -137,16 +151,21 @@ vector<uint8_t> Base58::decode(const char *data) {
 		++numberOfLeadingZeros;
 	}
 
-	// Create buffer
-	uint8_t buffer[(length - numberOfLeadingZeros) * SIZE_PERCENT_DECREASE / 1000 + 1];
-	memset(buffer, 0, sizeof(buffer));
+	// Get buffer size
+	const size_t bufferSize = (length - numberOfLeadingZeros) * SIZE_PERCENT_DECREASE / 1000 + 1;
+	
+	// Set result to zero with space for the leading zeros and the buffer
+	result.assign(numberOfLeadingZeros + bufferSize, 0);
+	
+	// Get buffer from the result after the leading zeros
+	uint8_t *buffer = &result[numberOfLeadingZeros];
 
 	// Go through all characters in the data after the leading alphabet zeros
 	size_t currentLength = 0;
 	for(size_t i = numberOfLeadingZeros; i < length; ++i) {
 
 		// Check if character is invalid
-		const char *characterOffset = strchr(ALPHABET, data[i]);
+		const char *characterOffset = data[i] ? strchr(ALPHABET, data[i]) : nullptr;
 		if(!characterOffset) {
 
 			// Throw exception
@@ -158,7 +177,7 @@ vector<uint8_t> Base58::decode(const char *data) {
 
 		// Go through all affected bytes in the buffer
 		size_t j = 0;
-		for(size_t k = sizeof(buffer) - 1; byte || j < currentLength; --k) {
+		for(size_t k = bufferSize - 1; byte || j < currentLength; --k) {
 
 			// Get the affected byte's value after it's changed
 			const uint16_t value = buffer[k] * NUMBER_BASE + byte;
@@ -185,25 +204,18 @@ vector<uint8_t> Base58::decode(const char *data) {
 	}
 
 	// Go through all leading zeros in the buffer
-	size_t bufferIndex = sizeof(buffer) - currentLength;
-	while(bufferIndex < sizeof(buffer) && !buffer[bufferIndex]) {
+	size_t bufferIndex = bufferSize - currentLength;
+	while(bufferIndex < bufferSize && !buffer[bufferIndex]) {
 
 		// Increment buffer index
 		++bufferIndex;
 	}
 	
-	// Initialize result to zero
-	vector<uint8_t> result(sizeof(buffer) - bufferIndex + numberOfLeadingZeros, 0);
-
-	// Go through all bytes in the buffer after the leading zeros
-	for(size_t i = 0; bufferIndex < sizeof(buffer); ++i, ++bufferIndex) {
-
-		// Set byte in the result
-		result[i + numberOfLeadingZeros] = buffer[bufferIndex];
-	}
-
-	// Return result
-	return result;
+	// Move bytes in the buffer after its leading zeros to the start of the buffer
+	memmove(buffer, &buffer[bufferIndex], bufferSize - bufferIndex);
+	
+	// Remove unused bytes from the end of the result
+	result.resize(numberOfLeadingZeros + bufferSize - bufferIndex);
 }
 
 // Decode with checksum
@@ -241,30 +253,28 @@ vector<uint8_t> Base58::decodeWithChecksum(const char *data) {
 void getChecksum(uint8_t checksum[CHECKSUM_SIZE], const uint8_t *data, const size_t length) {
 
 	// Check if getting digest failed
-	const unique_ptr<EVP_MD, decltype(&EVP_MD_free)> digest(EVP_MD_fetch(nullptr, CHECKSUM_DIGEST_ALGORITHM, nullptr), EVP_MD_free);
-	if(!digest) {
+	if(!checksumDigest) {
 	
 		// Throw exception
 		throw runtime_error("Getting digest failed");
 	}
 	
 	// Check if creating digest context failed
-	const unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> digestContext(EVP_MD_CTX_new(), EVP_MD_CTX_free);
-	if(!digestContext) {
+	if(!checksumDigestContext) {
 	
 		// Throw exception
 		throw runtime_error("Creating digest context failed");
 	}
 	
 	// Check if initializing digest context failed
-	if(!EVP_DigestInit_ex2(digestContext.get(), digest.get(), nullptr)) {
+	if(!EVP_DigestInit_ex2(checksumDigestContext.get(), checksumDigest.get(), nullptr)) {
 	
 		// Throw exception
 		throw runtime_error("Initializing digest context failed");
 	}
 	
 	// Check if hashing data failed
-	if(!EVP_DigestUpdate(digestContext.get(), data, length)) {
+	if(!EVP_DigestUpdate(checksumDigestContext.get(), data, length)) {
 	
 		// Throw exception
 		throw runtime_error("Hashing data failed");
@@ -280,7 +290,7 @@ void getChecksum(uint8_t checksum[CHECKSUM_SIZE], const uint8_t *data, const siz
 		// End
 		OSSL_PARAM_END
 	};
-	if(!EVP_MD_get_params(digest.get(), getDigestLengthParameters)) {
+	if(!EVP_MD_get_params(checksumDigest.get(), getDigestLengthParameters)) {
 	
 		// Throw exception
 		throw runtime_error("Getting digest length failed");
@@ -289,28 +299,28 @@ void getChecksum(uint8_t checksum[CHECKSUM_SIZE], const uint8_t *data, const siz
 	// Check if getting hash failed
 	uint8_t hash[digestLength];
 	unsigned int hashLength;
-	if(!EVP_DigestFinal_ex(digestContext.get(), hash, &hashLength) || hashLength != sizeof(hash)) {
+	if(!EVP_DigestFinal_ex(checksumDigestContext.get(), hash, &hashLength) || hashLength != sizeof(hash)) {
 	
 		// Throw exception
 		throw runtime_error("Getting hash failed");
 	}
 	
 	// Check if initializing digest context failed
-	if(!EVP_DigestInit_ex2(digestContext.get(), digest.get(), nullptr)) {
+	if(!EVP_DigestInit_ex2(checksumDigestContext.get(), checksumDigest.get(), nullptr)) {
 	
 		// Throw exception
 		throw runtime_error("Initializing digest context failed");
 	}
 	
 	// Check if hashing hash failed
-	if(!EVP_DigestUpdate(digestContext.get(), hash, sizeof(hash))) {
+	if(!EVP_DigestUpdate(checksumDigestContext.get(), hash, sizeof(hash))) {
 	
 		// Throw exception
 		throw runtime_error("Hashing hash failed");
 	}
 	
 	// Check if getting hash failed
-	if(!EVP_DigestFinal_ex(digestContext.get(), hash, &hashLength) || hashLength != sizeof(hash)) {
+	if(!EVP_DigestFinal_ex(checksumDigestContext.get(), hash, &hashLength) || hashLength != sizeof(hash)) {
 	
 		// Throw exception
 		throw runtime_error("Getting hash failed");
@@ -31,6 +31,9 @@ class Base58 final {
 		// Decode
 		static vector<uint8_t> decode(const char *data);
 		
+		// Decode into
+		static void decodeInto(vector<uint8_t> &result, const char *data, const size_t length);
+		
 		// Decode with checksum
 		static vector<uint8_t> decodeWithChecksum(const char *data);
 };
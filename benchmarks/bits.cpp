@@ -0,0 +1,95 @@
+// Header files
+#include <chrono>
+#include <iostream>
+#include "../bit_reader.h"
+#include "../bit_writer.h"
+
+using namespace std;
+
+
+// Constants
+
+// Number of iterations
+static const size_t NUMBER_OF_ITERATIONS = 100000;
+
+// Proof size
+static const size_t PROOF_SIZE = 675;
+
+// Serialized size
+static const size_t SERIALIZED_SIZE = 1024;
+
+
+// Main function
+int main() {
+
+	// Initialize data
+	uint8_t data[PROOF_SIZE] = {};
+	
+	// Initialize checksum so that the work can't be optimized out
+	size_t checksum = 0;
+	
+	// Initialize bytes
+	vector<uint8_t> bytes;
+	
+	// Get start time
+	chrono::time_point<chrono::steady_clock> start = chrono::steady_clock::now();
+	
+	// Go through all iterations
+	for(size_t i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Write values in a compact slate's layout where everything after the first few fields is unaligned
+		BitWriter bitWriter(SERIALIZED_SIZE);
+		bitWriter.setBits(i, 3);
+		bitWriter.setBits(1, 1);
+		bitWriter.setBytes(data, 16);
+		for(int j = 0; j < 4; ++j) {
+		
+			// Write a small length followed by a value
+			bitWriter.setBits(j, 6);
+			bitWriter.setBits(i, 32);
+		}
+		bitWriter.setBytes(data, 32);
+		bitWriter.setBytes(data, 33);
+		bitWriter.setBits(PROOF_SIZE, 10);
+		bitWriter.setBytes(data, PROOF_SIZE);
+		bitWriter.setBytes(data, 64);
+		
+		// Update checksum
+		checksum += bitWriter.getBytes().size();
+		
+		// Save bytes
+		bytes = bitWriter.getBytes();
+	}
+	
+	// Display message
+	cout << "Bit writer: " << chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count() / NUMBER_OF_ITERATIONS << " ns" << endl;
+	
+	// Get start time
+	start = chrono::steady_clock::now();
+	
+	// Go through all iterations
+	for(size_t i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Read the values back
+		BitReader bitReader(bytes.data(), bytes.size());
+		checksum += bitReader.getBits(3);
+		checksum += bitReader.getBits(1);
+		checksum += bitReader.getBytes(16).size();
+		for(int j = 0; j < 4; ++j) {
+		
+			// Read a small length followed by a value
+			checksum += bitReader.getBits(6);
+			checksum += bitReader.getBits(32);
+		}
+		checksum += bitReader.getBytes(32).size();
+		checksum += bitReader.getBytes(33).size();
+		checksum += bitReader.getBytes(bitReader.getBits(10)).size();
+		checksum += bitReader.getBytes(64).size();
+	}
+	
+	// Display message
+	cout << "Bit reader: " << chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count() / NUMBER_OF_ITERATIONS << " ns" << endl;
+	
+	// Return checksum
+	return checksum ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,55 @@
+// Header files
+#include <chrono>
+#include <iostream>
+#include "../base58.h"
+#include "../blake2.h"
+
+using namespace std;
+
+
+// Constants
+
+// Number of iterations
+static const size_t NUMBER_OF_ITERATIONS = 1000000;
+
+
+// Main function
+int main() {
+
+	// Initialize data
+	uint8_t data[32] = {};
+	
+	// Initialize checksum so that the work can't be optimized out
+	size_t checksum = 0;
+	
+	// Get start time
+	chrono::time_point<chrono::steady_clock> start = chrono::steady_clock::now();
+	
+	// Go through all iterations
+	for(size_t i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Hash data
+		uint8_t hash[32];
+		checksum += blake2b(hash, sizeof(hash), data, sizeof(data), nullptr, 0);
+		checksum += hash[0];
+	}
+	
+	// Display message
+	cout << "BLAKE2b: " << chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count() / NUMBER_OF_ITERATIONS << " ns" << endl;
+	
+	// Get start time
+	start = chrono::steady_clock::now();
+	
+	// Go through all iterations
+	for(size_t i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Encode data with a checksum
+		checksum += Base58::encodeWithChecksum(data, sizeof(data)).size();
+	}
+	
+	// Display message
+	cout << "Base58 with checksum: " << chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count() / NUMBER_OF_ITERATIONS << " ns" << endl;
+	
+	// Return checksum
+	return checksum ? EXIT_SUCCESS : EXIT_FAILURE;
+}
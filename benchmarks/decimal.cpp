@@ -0,0 +1,51 @@
+// Header files
+#include <chrono>
+#include <iostream>
+#include "../common.h"
+#include "../decimal.h"
+
+using namespace std;
+
+
+// Constants
+
+// Number of iterations
+static const size_t NUMBER_OF_ITERATIONS = 1000000;
+
+
+// Main function
+int main() {
+
+	// Initialize checksum so that the work can't be optimized out
+	size_t checksum = 0;
+	
+	// Get start time
+	chrono::time_point<chrono::steady_clock> start = chrono::steady_clock::now();
+	
+	// Go through all iterations
+	for(size_t i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Multiply a price in the base currency by a currency price
+		checksum += Common::multiplyStrings("1546586.768", "0.012345678").size();
+	}
+	
+	// Display message
+	cout << "Multiply strings: " << chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count() / NUMBER_OF_ITERATIONS << " ns" << endl;
+	
+	// Get start time
+	start = chrono::steady_clock::now();
+	
+	// Go through all iterations
+	for(size_t i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Weight a price by its timestamp and add it to an average the same way that the price does
+		const Decimal weightedPrice = (Decimal("0.0123456789") * Decimal(static_cast<uint64_t>(3599))).divide(Decimal(static_cast<uint64_t>(17995)), Decimal::MAXIMUM_SCALE);
+		checksum += (weightedPrice + Decimal("0.01")).toString(10).size();
+	}
+	
+	// Display message
+	cout << "Weighted price: " << chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count() / NUMBER_OF_ITERATIONS << " ns" << endl;
+	
+	// Return checksum
+	return checksum ? EXIT_SUCCESS : EXIT_FAILURE;
+}
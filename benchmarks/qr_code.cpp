@@ -0,0 +1,69 @@
+// Header files
+#include <chrono>
+#include <iostream>
+#include "../qr_code.h"
+#include "qrcodegen.h"
+#include "zlib.h"
+
+using namespace std;
+
+
+// Constants
+
+// Number of iterations
+static const size_t NUMBER_OF_ITERATIONS = 10000;
+
+// QR code padding
+static const int QR_CODE_PADDING = 4;
+
+// QR code compression level
+static const int QR_CODE_COMPRESSION_LEVEL = 6;
+
+
+// Main function
+int main() {
+
+	// Check if encoding QR code failed
+	uint8_t qrCode[qrcodegen_BUFFER_LEN_MAX];
+	uint8_t temporaryBuffer[qrcodegen_BUFFER_LEN_MAX];
+	if(!qrcodegen_encodeText("http://mwcpayzmxwrb2pbe6xohyzn6ug4rcnc3qd7xb4z5iaeyqdpvsynkfbqd.onion/v2/foreign?payment_id=0123456789abcdef0123456789abcdef", temporaryBuffer, qrCode, qrcodegen_Ecc_LOW, qrcodegen_VERSION_MIN, qrcodegen_VERSION_MAX, qrcodegen_Mask_AUTO, false)) {
+	
+		// Display message
+		cout << "Encoding QR code failed" << endl;
+		
+		// Return failure
+		return EXIT_FAILURE;
+	}
+	
+	// Initialize checksum so that the work can't be optimized out
+	size_t checksum = 0;
+	
+	// Get start time
+	chrono::time_point<chrono::steady_clock> start = chrono::steady_clock::now();
+	
+	// Go through all iterations
+	for(size_t i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Get PNG
+		checksum += QrCode::getPng(qrCode, QR_CODE_PADDING, false, QR_CODE_COMPRESSION_LEVEL, Z_DEFAULT_STRATEGY).size();
+	}
+	
+	// Display message
+	cout << "PNG: " << chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count() / NUMBER_OF_ITERATIONS << " ns" << endl;
+	
+	// Get start time
+	start = chrono::steady_clock::now();
+	
+	// Go through all iterations
+	for(size_t i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Get SVG
+		checksum += QrCode::getSvg(qrCode, QR_CODE_PADDING, false).size();
+	}
+	
+	// Display message
+	cout << "SVG: " << chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count() / NUMBER_OF_ITERATIONS << " ns" << endl;
+	
+	// Return checksum
+	return checksum ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -1,4 +1,5 @@
 // Header files
+#include <cstring>
 #include <limits>
 #include <stdexcept>
 #include "./bit_reader.h"
@@ -26,93 +27,102 @@ BitReader::BitReader(const uint8_t *bytes, const size_t length) :
 }
 
 // Get bits
-uint64_t BitReader::getBits(size_t numberOfBits) {
+uint64_t BitReader::getBits(const size_t numberOfBits) {
 
-	// Check if more than one byte is requested
-	if(numberOfBits > numeric_limits<uint8_t>::digits) {
-	
-		// Initialize result
-		uint64_t result = 0;
-	
-		// Go through all bits
-		while(numberOfBits) {
-		
-			// Get used number of bits
-			const size_t usedNumberOfBits = min(numberOfBits, static_cast<size_t>(numeric_limits<uint8_t>::digits));
+	// Check if no bits are requested
+	if(!numberOfBits) {
 		
-			// Update result to make space for more bits
-			result <<= usedNumberOfBits;
-			
-			// Include bits in result
-			result |= getBits(usedNumberOfBits);
-		
-			// Update number of bits
-			numberOfBits -= usedNumberOfBits;
-		}
+		// Return zero
+		return 0;
+	}
+
+	// Check if number of bits is invalid
+	if(numberOfBits > numeric_limits<uint64_t>::digits || numberOfBits > (length - byteIndex) * numeric_limits<uint8_t>::digits - bitIndex) {
 		
-		// Return result
-		return result;
+		// Throw exception
+		throw runtime_error("Number of bits is invalid");
 	}
 	
-	// Otherwise
-	else {
+	// Load up to the accumulator's size of bytes at the byte index into the accumulator
+	uint64_t accumulator = 0;
+	memcpy(&accumulator, &bytes[byteIndex], min(length - byteIndex, sizeof(accumulator)));
 	
-		// Check if no bits are requested
-		if(!numberOfBits) {
-		
-			// Return zero
-			return 0;
-		}
-
-		// Check if number of bits is invalid
-		if(byteIndex == length || (byteIndex == length - 1 && bitIndex + numberOfBits > numeric_limits<uint8_t>::digits)) {
-		
-			// Throw exception
-			throw runtime_error("Number of bits is invalid");
-		}
+	// Check if little endian
+	#if BYTE_ORDER == LITTLE_ENDIAN
 	
-		// Set result to the byte at the byte index
-		uint64_t result = bytes[byteIndex] << numeric_limits<uint8_t>::digits;
-		
-		// Check if more bytes are needed
-		if(bitIndex + numberOfBits > numeric_limits<uint8_t>::digits) {
-		
-			// Append next byte to the result
-			result |= bytes[byteIndex + 1];
-		}
-		
-		// Remove upper bits from the result
-		result &= (1 << (numeric_limits<uint16_t>::digits - bitIndex)) - 1;
-		
-		// Remove lower bits from the result
-		result >>= (numeric_limits<uint16_t>::digits - (bitIndex + numberOfBits));
+		// Make accumulator big endian
+		accumulator = __builtin_bswap64(accumulator);
+	#endif
 	
-		// Update bit index
-		bitIndex += numberOfBits;
-		
-		// Check if bit index overflowed into the next byte
-		if(bitIndex >= numeric_limits<uint8_t>::digits) {
+	// Set result to the bits after the bit index in the accumulator
+	uint64_t result = (accumulator << bitIndex) >> (numeric_limits<uint64_t>::digits - numberOfBits);
+	
+	// Check if more bits are needed than the accumulator contains
+	if(bitIndex + numberOfBits > numeric_limits<uint64_t>::digits) {
+	
+		// Include remaining bits from the byte after the accumulator in the result
+		result |= bytes[byteIndex + sizeof(accumulator)] >> (numeric_limits<uint8_t>::digits - (bitIndex + numberOfBits - numeric_limits<uint64_t>::digits));
+	}
+	
+	// Update bit index
+	bitIndex += numberOfBits;
 		
-			// Increment byte index
-			++byteIndex;
+	// Update byte index to include the bytes that the bit index overflowed into
+	byteIndex += bitIndex / numeric_limits<uint8_t>::digits;
 		
-			// Correct bit index
-			bitIndex %= numeric_limits<uint8_t>::digits;
-		}
+	// Correct bit index
+	bitIndex %= numeric_limits<uint8_t>::digits;
 		
-		// Return result
-		return result;
-	}
+	// Return result
+	return result;
 }
 
 // Get bytes
 vector<uint8_t> BitReader::getBytes(const size_t length) {
 
+	// Check if length is invalid
+	if(length > this->length - byteIndex - (bitIndex ? 1 : 0)) {
+	
+		// Throw exception
+		throw runtime_error("Length is invalid");
+	}
+	
+	// Check if byte aligned
+	if(!bitIndex) {
+	
+		// Set result to the bytes at the byte index
+		vector<uint8_t> result(&bytes[byteIndex], &bytes[byteIndex] + length);
+		
+		// Update byte index
+		byteIndex += length;
+		
+		// Return result
+		return result;
+	}
+	
 	// Initialize result
 	vector<uint8_t> result(length);
 	
-	// Go through all bytes
-	for(size_t i = 0; i < length; ++i) {
+	// Go through all of the accumulator's size of bytes
+	size_t i = 0;
+	for(; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+	
+		// Get bits
+		uint64_t bits = getBits(numeric_limits<uint64_t>::digits);
+		
+		// Check if little endian
+		#if BYTE_ORDER == LITTLE_ENDIAN
+		
+			// Make bits big endian
+			bits = __builtin_bswap64(bits);
+		#endif
+		
+		// Set bytes in the result
+		memcpy(&result[i], &bits, sizeof(bits));
+	}
+	
+	// Go through all remaining bytes
+	for(; i < length; ++i) {
 	
 		// Set byte in the result
 		result[i] = getBits(numeric_limits<uint8_t>::digits);
@@ -22,7 +22,7 @@ class BitReader final {
 		explicit BitReader(const uint8_t *bytes, const size_t length);
 		
 		// Get bits
-		uint64_t getBits(size_t numberOfBits);
+		uint64_t getBits(const size_t numberOfBits);
 		
 		// Get bytes
 		vector<uint8_t> getBytes(const size_t length);
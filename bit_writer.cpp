@@ -1,5 +1,7 @@
 // Header files
+#include <cstring>
 #include <limits>
+#include <stdexcept>
 #include "./bit_writer.h"
 
 using namespace std;
@@ -8,7 +10,7 @@ using namespace std;
 // Supporting function implementation
 
 // Constructor
-BitWriter::BitWriter() :
+BitWriter::BitWriter(const size_t capacity) :
 
 	// Set byte index
 	byteIndex(0),
@@ -16,68 +18,111 @@ BitWriter::BitWriter() :
 	// Set bit index
 	bitIndex(0)
 {
+
+	// Reserve capacity in bytes
+	bytes.reserve(capacity);
 }
 
 // Set bits
-void BitWriter::setBits(const uint64_t bits, size_t numberOfBits) {
+void BitWriter::setBits(const uint64_t bits, const size_t numberOfBits) {
 
-	// Go through all bytes past one byte
-	while(numberOfBits > numeric_limits<uint8_t>::digits) {
-	
-		// Set byte's bits
-		setBits(bits >> (numeric_limits<uint8_t>::digits * (numberOfBits / numeric_limits<uint8_t>::digits - 1) + numberOfBits % numeric_limits<uint8_t>::digits), numeric_limits<uint8_t>::digits);
+	// Check if no bits are provided
+	if(!numberOfBits) {
 	
-		// Update number of bits
-		numberOfBits -= numeric_limits<uint8_t>::digits;
+		// Return
+		return;
 	}
 	
-	// Check if bits exist
-	if(numberOfBits) {
+	// Check if number of bits is invalid
+	if(numberOfBits > numeric_limits<uint64_t>::digits) {
 	
-		// Check if more space is needed
-		if(!bitIndex || bitIndex + numberOfBits > numeric_limits<uint8_t>::digits) {
-		
-			// Increase byte's size by one
-			bytes.push_back(0);
-		}
-		
-		// Check if bits will overflow into the next byte
-		if(bitIndex + numberOfBits > numeric_limits<uint8_t>::digits) {
+		// Throw exception
+		throw runtime_error("Number of bits is invalid");
+	}
 		
-			// Include bits in bytes at byte index
-			bytes[byteIndex] |= bits >> ((bitIndex + numberOfBits) - numeric_limits<uint8_t>::digits);
-			
-			// Include bits in bytes at the next byte index
-			bytes[byteIndex + 1] |= bits << (numeric_limits<uint16_t>::digits - (bitIndex + numberOfBits));
-		}
+	// Check if bits will overflow the accumulator
+	if(bitIndex + numberOfBits > numeric_limits<uint64_t>::digits) {
+	
+		// Set all but the last byte's bits
+		setBits(bits >> numeric_limits<uint8_t>::digits, numberOfBits - numeric_limits<uint8_t>::digits);
 		
-		// Otherwise
-		else {
+		// Set last byte's bits
+		setBits(bits & numeric_limits<uint8_t>::max(), numeric_limits<uint8_t>::digits);
 		
-			// Include bits in bytes at byte index
-			bytes[byteIndex] |= bits << (numeric_limits<uint8_t>::digits - (bitIndex + numberOfBits));
-		}
+		// Return
+		return;
+	}
 		
-		// Update bit index
-		bitIndex += numberOfBits;
+	// Set accumulator to the bits after the bit index without any of their unused upper bits
+	uint64_t accumulator = (bits << (numeric_limits<uint64_t>::digits - numberOfBits)) >> bitIndex;
+	
+	// Check if a byte is partially set
+	if(bitIndex) {
+	
+		// Include partially set byte in the accumulator
+		accumulator |= static_cast<uint64_t>(bytes[byteIndex]) << (numeric_limits<uint64_t>::digits - numeric_limits<uint8_t>::digits);
+	}
+	
+	// Check if little endian
+	#if BYTE_ORDER == LITTLE_ENDIAN
+	
+		// Make accumulator big endian
+		accumulator = __builtin_bswap64(accumulator);
+	#endif
+	
+	// Increase bytes' size to include all bytes used by the accumulator
+	bytes.resize(byteIndex + (bitIndex + numberOfBits + numeric_limits<uint8_t>::digits - 1) / numeric_limits<uint8_t>::digits);
+	
+	// Store used bytes from the accumulator in bytes at the byte index
+	memcpy(&bytes[byteIndex], &accumulator, bytes.size() - byteIndex);
 		
-		// Check if bit index overflowed into the next byte
-		if(bitIndex >= numeric_limits<uint8_t>::digits) {
+	// Update bit index
+	bitIndex += numberOfBits;
 		
-			// Increment byte index
-			++byteIndex;
+	// Update byte index to include the bytes that the bit index overflowed into
+	byteIndex += bitIndex / numeric_limits<uint8_t>::digits;
 		
-			// Correct bit index
-			bitIndex %= numeric_limits<uint8_t>::digits;
-		}
-	}
+	// Correct bit index
+	bitIndex %= numeric_limits<uint8_t>::digits;
 }
 
 // Set bytes
 void BitWriter::setBytes(const uint8_t *bytes, const size_t length) {
 
-	// Go through all bytes
-	for(size_t i = 0; i < length; ++i) {
+	// Check if byte aligned
+	if(!bitIndex) {
+	
+		// Append bytes to bytes
+		this->bytes.insert(this->bytes.end(), bytes, bytes + length);
+		
+		// Update byte index
+		byteIndex += length;
+		
+		// Return
+		return;
+	}
+	
+	// Go through all of the accumulator's size minus one of bytes
+	size_t i = 0;
+	for(; i + sizeof(uint64_t) - 1 <= length; i += sizeof(uint64_t) - 1) {
+	
+		// Get bytes as bits
+		uint64_t bits = 0;
+		memcpy(&bits, &bytes[i], sizeof(bits) - 1);
+		
+		// Check if little endian
+		#if BYTE_ORDER == LITTLE_ENDIAN
+		
+			// Make bits big endian
+			bits = __builtin_bswap64(bits);
+		#endif
+		
+		// Set bits
+		setBits(bits >> numeric_limits<uint8_t>::digits, (sizeof(bits) - 1) * numeric_limits<uint8_t>::digits);
+	}
+	
+	// Go through all remaining bytes
+	for(; i < length; ++i) {
 	
 		// Set byte's bits
 		setBits(bytes[i], numeric_limits<uint8_t>::digits);
@@ -19,10 +19,10 @@ class BitWriter final {
 	public:
 	
 		// Constructor
-		BitWriter();
+		explicit BitWriter(const size_t capacity);
 		
 		// Set bits
-		void setBits(const uint64_t bits, size_t numberOfBits);
+		void setBits(const uint64_t bits, const size_t numberOfBits);
 		
 		// Set bytes
 		void setBytes(const uint8_t *bytes, const size_t length);
@@ -13,6 +13,9 @@ using namespace std;
 // Hash digest algorithm
 static const char *HASH_DIGEST_ALGORITHM = "BLAKE2B-512";
 
+// Hash digest
+static thread_local const unique_ptr<EVP_MD, decltype(&EVP_MD_free)> hashDigest(EVP_MD_fetch(nullptr, HASH_DIGEST_ALGORITHM, nullptr), EVP_MD_free);
+
 
 // Supporting function implementation
 
@@ -27,8 +30,7 @@ int blake2b(uint8_t *output, const size_t outputLength, const uint8_t *input, co
 	}
 	
 	// Check if getting digest failed
-	const unique_ptr<EVP_MD, decltype(&EVP_MD_free)> digest(EVP_MD_fetch(nullptr, HASH_DIGEST_ALGORITHM, nullptr), EVP_MD_free);
-	if(!digest) {
+	if(!hashDigest) {
 	
 		// Return one
 		return 1;
@@ -51,7 +53,7 @@ int blake2b(uint8_t *output, const size_t outputLength, const uint8_t *input, co
 		// End
 		OSSL_PARAM_END
 	};
-	if(!EVP_DigestInit_ex2(digestContext.get(), digest.get(), setDigestLengthParameters)) {
+	if(!EVP_DigestInit_ex2(digestContext.get(), hashDigest.get(), setDigestLengthParameters)) {
 	
 		// Return one
 		return 1;
@@ -0,0 +1,458 @@
+// Header files
+#include <iostream>
+#include <signal.h>
+#include <syncstream>
+#include "./callback_dispatcher.h"
+#include "./common.h"
+
+using namespace std;
+
+
+// Supporting function implementation
+
+// Constructor
+CallbackDispatcher::CallbackDispatcher(Payments &payments, HttpClient &httpClient) :
+
+	// Set quit
+	quit(false),
+	
+	// Set payments
+	payments(payments),
+	
+	// Set HTTP client
+	httpClient(httpClient),
+	
+	// Set dispatch requested
+	dispatchRequested(false),
+	
+	// Set number of sending callbacks
+	numberOfSendingCallbacks(0)
+{
+
+	// Display message
+	osyncstream(cout) << "Starting callback dispatcher" << endl;
+	
+	// Try
+	try {
+	
+		// Create main thread
+		mainThread = thread(&CallbackDispatcher::run, this);
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Throw exception
+		throw runtime_error("Creating callback dispatcher main thread failed");
+	}
+	
+	// Check if main thread is invalid
+	if(!mainThread.joinable()) {
+	
+		// Display message
+		osyncstream(cout) << "Callback dispatcher main thread is invalid" << endl;
+		
+		// Exit failure
+		exit(EXIT_FAILURE);
+	}
+	
+	// Display message
+	osyncstream(cout) << "Callback dispatcher started" << endl;
+}
+
+// Destructor
+CallbackDispatcher::~CallbackDispatcher() {
+
+	// Display message
+	osyncstream(cout) << "Closing callback dispatcher" << endl;
+	
+	// Try
+	try {
+	
+		{
+			// Lock
+			lock_guard guard(lock);
+			
+			// Set quit
+			quit.store(true);
+		}
+		
+		// Notify main thread
+		conditionVariable.notify_all();
+		
+		// Wait for main thread to finish
+		mainThread.join();
+		
+		{
+			// Lock
+			unique_lock uniqueLock(lock);
+			
+			// Wait for all sending callbacks to finish
+			conditionVariable.wait(uniqueLock, [this]() {
+			
+				// Return if no callbacks are being sent
+				return !numberOfSendingCallbacks;
+			});
+		}
+		
+		// Save callback results
+		saveCallbackResults();
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Display message
+		osyncstream(cout) << "Waiting for callback dispatcher to finish failed" << endl;
+		
+		// Exit failure
+		exit(EXIT_FAILURE);
+	}
+	
+	// Display message
+	osyncstream(cout) << "Callback dispatcher closed" << endl;
+}
+
+// Dispatch pending callbacks
+void CallbackDispatcher::dispatchPendingCallbacks() {
+
+	{
+		// Lock
+		lock_guard guard(lock);
+		
+		// Set dispatch requested
+		dispatchRequested = true;
+	}
+	
+	// Notify main thread
+	conditionVariable.notify_all();
+}
+
+// Run
+void CallbackDispatcher::run() {
+
+	// Try
+	try {
+	
+		// Initialize last send time
+		uint64_t lastSendTime = 0;
+		
+		// Initialize next completed callback attempt
+		optional<uint64_t> nextCompletedCallbackAttempt = getNextCompletedCallbackAttempt(lastSendTime);
+		
+		// Loop forever
+		while(true) {
+		
+			// Initialize send pending callbacks
+			bool sendPending;
+			
+			{
+				// Lock
+				unique_lock uniqueLock(lock);
+				
+				// Check if a completed callback attempt is scheduled
+				if(nextCompletedCallbackAttempt.has_value()) {
+				
+					// Check if waiting until quitting, a dispatch is requested, or callback results exist timed out
+					if(!conditionVariable.wait_until(uniqueLock, chrono::system_clock::from_time_t(nextCompletedCallbackAttempt.value()), [this]() {
+					
+						// Return if quitting, a dispatch is requested, or callback results exist
+						return quit.load() || dispatchRequested || !completedCallbackResults.empty() || !confirmedCallbackResults.empty();
+					})) {
+					
+						// Set dispatch requested since the next completed callback attempt is due
+						dispatchRequested = true;
+					}
+				}
+				
+				// Otherwise
+				else {
+				
+					// Wait until quitting, a dispatch is requested, or callback results exist
+					conditionVariable.wait(uniqueLock, [this]() {
+				
+						// Return if quitting, a dispatch is requested, or callback results exist
+						return quit.load() || dispatchRequested || !completedCallbackResults.empty() || !confirmedCallbackResults.empty();
+					});
+				}
+				
+				// Check if quitting
+				if(quit.load()) {
+				
+					// Break
+					break;
+				}
+				
+				// Set send pending callbacks to if a dispatch is requested
+				sendPending = dispatchRequested;
+				
+				// Clear dispatch requested
+				dispatchRequested = false;
+			}
+			
+			// Save callback results
+			saveCallbackResults();
+			
+			// Check if sending pending callbacks
+			if(sendPending) {
+			
+				// Update last send time
+				lastSendTime = time(nullptr);
+				
+				// Send pending callbacks
+				sendPendingCallbacks();
+			}
+			
+			// Get next completed callback attempt after the ones that the last send already handled
+			nextCompletedCallbackAttempt = getNextCompletedCallbackAttempt(lastSendTime);
+		}
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Display message
+		osyncstream(cout) << "Callback dispatcher failed for unknown reason" << endl;
+		
+		// Set error occurred
+		Common::setErrorOccurred();
+		
+		// Raise interrupt signal
+		kill(getpid(), SIGINT);
+	}
+}
+
+// Send pending callbacks
+void CallbackDispatcher::sendPendingCallbacks() {
+
+	// Try
+	try {
+	
+		// Go through all pending confirmed callback payments
+		for(tuple<uint64_t, uint64_t, string> &paymentInfo : payments.getPendingConfirmedCallbackPayments()) {
+		
+			// Get payment ID
+			const uint64_t &paymentId = get<0>(paymentInfo);
+			
+			// Check if payment's confirmed callback is already being sent
+			if(sendingConfirmedCallbacks.contains(paymentId)) {
+			
+				// Go to next payment
+				continue;
+			}
+			
+			// Get payment confirmations
+			const uint64_t &paymentConfirmations = get<1>(paymentInfo);
+			
+			// Get payment's confirmed callback
+			string &paymentConfirmedCallback = get<2>(paymentInfo);
+			
+			// Apply substitutions to payment's confirmed callback
+			Common::applySubstitutions(paymentConfirmedCallback, {
+			
+				// ID
+				{"__id__", to_string(paymentId)},
+				
+				// Confirmations
+				{"__confirmations__", to_string(paymentConfirmations)}
+			});
+			
+			// Add payment to sending confirmed callbacks
+			sendingConfirmedCallbacks.insert(paymentId);
+			
+			{
+				// Lock
+				lock_guard guard(lock);
+				
+				// Increment number of sending callbacks
+				++numberOfSendingCallbacks;
+			}
+			
+			// Check if sending HTTP request to the payment's confirmed callback failed
+			if(!httpClient.sendRequest(paymentConfirmedCallback.c_str(), [this, paymentId, paymentConfirmations](const bool successful) {
+			
+				{
+					// Lock
+					lock_guard guard(lock);
+					
+					// Add payment's confirmations to confirmed callback results
+					confirmedCallbackResults.emplace_back(paymentId, paymentConfirmations);
+					
+					// Decrement number of sending callbacks
+					--numberOfSendingCallbacks;
+				}
+				
+				// Notify main thread
+				conditionVariable.notify_all();
+			})) {
+			
+				// Lock
+				lock_guard guard(lock);
+				
+				// Add payment's confirmations to confirmed callback results
+				confirmedCallbackResults.emplace_back(paymentId, paymentConfirmations);
+				
+				// Decrement number of sending callbacks
+				--numberOfSendingCallbacks;
+			}
+		}
+		
+		// Go through all unsuccessful completed callback payments
+		for(tuple<uint64_t, uint64_t, uint64_t, string> &paymentInfo : payments.getUnsuccessfulCompletedCallbackPayments()) {
+		
+			// Get payment ID
+			const uint64_t &paymentId = get<0>(paymentInfo);
+			
+			// Check if payment's completed callback is already being sent
+			if(sendingCompletedCallbacks.contains(paymentId)) {
+			
+				// Go to next payment
+				continue;
+			}
+			
+			// Get payment completed
+			const uint64_t &paymentCompleted = get<1>(paymentInfo);
+			
+			// Get payment received
+			const uint64_t &paymentReceived = get<2>(paymentInfo);
+			
+			// Get payment's completed callback
+			string &paymentCompletedCallback = get<3>(paymentInfo);
+			
+			// Apply substitutions to payment's completed callback
+			Common::applySubstitutions(paymentCompletedCallback, {
+			
+				// ID
+				{"__id__", to_string(paymentId)},
+				
+				// Completed
+				{"__completed__", to_string(paymentCompleted)},
+				
+				// Received
+				{"__received__", to_string(paymentReceived)}
+			});
+			
+			// Add payment to sending completed callbacks
+			sendingCompletedCallbacks.insert(paymentId);
+			
+			{
+				// Lock
+				lock_guard guard(lock);
+				
+				// Increment number of sending callbacks
+				++numberOfSendingCallbacks;
+			}
+			
+			// Check if sending HTTP request to the payment's completed callback failed
+			if(!httpClient.sendRequest(paymentCompletedCallback.c_str(), [this, paymentId](const bool successful) {
+			
+				{
+					// Lock
+					lock_guard guard(lock);
+					
+					// Add if request was successful to completed callback results
+					completedCallbackResults.emplace_back(paymentId, successful);
+					
+					// Decrement number of sending callbacks
+					--numberOfSendingCallbacks;
+				}
+				
+				// Notify main thread
+				conditionVariable.notify_all();
+			})) {
+			
+				// Lock
+				lock_guard guard(lock);
+				
+				// Add that request failed to completed callback results
+				completedCallbackResults.emplace_back(paymentId, false);
+				
+				// Decrement number of sending callbacks
+				--numberOfSendingCallbacks;
+			}
+		}
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+	}
+}
+
+// Save callback results
+void CallbackDispatcher::saveCallbackResults() {
+
+	// Initialize completed results
+	list<pair<uint64_t, bool>> completedResults;
+	
+	// Initialize confirmed results
+	list<pair<uint64_t, uint64_t>> confirmedResults;
+	
+	{
+		// Lock
+		lock_guard guard(lock);
+		
+		// Get completed and confirmed callback results
+		completedResults.swap(completedCallbackResults);
+		confirmedResults.swap(confirmedCallbackResults);
+	}
+	
+	// Initialize successful completed callback payments
+	list<uint64_t> successfulCompletedCallbackPayments;
+	
+	// Initialize failed completed callback payments
+	list<uint64_t> failedCompletedCallbackPayments;
+	
+	// Go through all completed results
+	for(const pair<uint64_t, bool> &completedResult : completedResults) {
+	
+		// Remove payment from sending completed callbacks
+		sendingCompletedCallbacks.erase(completedResult.first);
+		
+		// Check if payment's completed callback was successful
+		if(completedResult.second) {
+		
+			// Add payment to successful completed callback payments
+			successfulCompletedCallbackPayments.push_back(completedResult.first);
+		}
+		
+		// Otherwise
+		else {
+		
+			// Add payment to failed completed callback payments
+			failedCompletedCallbackPayments.push_back(completedResult.first);
+		}
+	}
+	
+	// Go through all confirmed results
+	for(const pair<uint64_t, uint64_t> &confirmedResult : confirmedResults) {
+	
+		// Remove payment from sending confirmed callbacks
+		sendingConfirmedCallbacks.erase(confirmedResult.first);
+	}
+	
+	// Check if there are results to save
+	if(!completedResults.empty() || !confirmedResults.empty()) {
+	
+		// Save results in a single transaction
+		payments.acknowledgePaymentCallbacks(successfulCompletedCallbackPayments, failedCompletedCallbackPayments, confirmedResults);
+	}
+}
+
+// Get next completed callback attempt
+optional<uint64_t> CallbackDispatcher::getNextCompletedCallbackAttempt(const uint64_t after) {
+
+	// Try
+	try {
+	
+		// Return next completed callback attempt
+		return payments.getNextCompletedCallbackAttempt(after);
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Return nothing so that completed callbacks are retried on the next dispatch request
+		return nullopt;
+	}
+}
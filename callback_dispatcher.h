@@ -0,0 +1,89 @@
+// Header guard
+#ifndef CALLBACK_DISPATCHER_H
+#define CALLBACK_DISPATCHER_H
+
+
+// Header files
+#include <atomic>
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include "./http_client.h"
+#include "./payments.h"
+
+using namespace std;
+
+
+// Classes
+
+// Callback dispatcher class
+class CallbackDispatcher final {
+
+	// Public
+	public:
+	
+		// Constructor
+		explicit CallbackDispatcher(Payments &payments, HttpClient &httpClient);
+		
+		// Destructor
+		~CallbackDispatcher();
+		
+		// Dispatch pending callbacks
+		void dispatchPendingCallbacks();
+	
+	// Private
+	private:
+	
+		// Run
+		void run();
+		
+		// Send pending callbacks
+		void sendPendingCallbacks();
+		
+		// Save callback results
+		void saveCallbackResults();
+		
+		// Get next completed callback attempt
+		optional<uint64_t> getNextCompletedCallbackAttempt(const uint64_t after);
+		
+		// Quit
+		atomic_bool quit;
+		
+		// Payments
+		Payments &payments;
+		
+		// HTTP client
+		HttpClient &httpClient;
+		
+		// Dispatch requested
+		bool dispatchRequested;
+		
+		// Number of sending callbacks
+		size_t numberOfSendingCallbacks;
+		
+		// Completed callback results
+		list<pair<uint64_t, bool>> completedCallbackResults;
+		
+		// Confirmed callback results
+		list<pair<uint64_t, uint64_t>> confirmedCallbackResults;
+		
+		// Lock
+		mutex lock;
+		
+		// Condition variable
+		condition_variable conditionVariable;
+		
+		// Sending completed callbacks
+		unordered_set<uint64_t> sendingCompletedCallbacks;
+		
+		// Sending confirmed callbacks
+		unordered_set<uint64_t> sendingConfirmedCallbacks;
+		
+		// Main thread
+		thread mainThread;
+};
+
+
+#endif
@@ -5,13 +5,8 @@
 #include <memory>
 #include <sstream>
 #include <stdexcept>
-#include "./base64.h"
 #include "./common.h"
-#include "event2/bufferevent_ssl.h"
-#include "event2/event.h"
-#include "event2/http.h"
-#include "mpfr.h"
-#include "openssl/ssl.h"
+#include "./decimal.h"
 
 using namespace std;
 
@@ -60,12 +55,6 @@ const uint8_t Common::UUID_VARIANT_TWO_BITMASK_RESULT = 0b1100;
 // Hex character size
 const size_t Common::HEX_CHARACTER_SIZE = sizeof("FF") - sizeof('\0');
 
-// MPFR precision
-const int Common::MPFR_PRECISION = 256;
-
-// Minimum TLS version
-static const int MINIMUM_TLS_VERSION = TLS1_VERSION;
-
 
 // Global variables
 
@@ -231,249 +220,6 @@ bool Common::getSignalReceived() {
 	return signalReceived;
 }
 
-// Send HTTP request
-bool Common::sendHttpRequest(const char *destination) {
-
-	// Try
-	try {
-	
-		// Check if parsing destination failed
-		const unique_ptr<evhttp_uri, decltype(&evhttp_uri_free)> uri(evhttp_uri_parse(destination), evhttp_uri_free);
-		if(!uri) {
-		
-			// Return false
-			return false;
-		}
-		
-		// Check if creating event base failed
-		const unique_ptr<event_base, decltype(&event_base_free)> eventBase(event_base_new(), event_base_free);
-		if(!eventBase) {
-		
-			// Return false
-			return false;
-		}
-		
-		// Check if host is to an IPv6 address
-		string host;
-		if(evhttp_uri_get_host(uri.get())[0] == '[' && evhttp_uri_get_host(uri.get())[strlen(evhttp_uri_get_host(uri.get())) - sizeof('\0')] == ']') {
-		
-			// Set host
-			host = string(&evhttp_uri_get_host(uri.get())[sizeof('[')], strlen(evhttp_uri_get_host(uri.get())) - sizeof('[') - sizeof(']'));
-		}
-		
-		// Otherwise
-		else {
-		
-			// Set host
-			host = evhttp_uri_get_host(uri.get());
-		}
-		
-		// Check if no port is specified
-		uint16_t port;
-		if(evhttp_uri_get_port(uri.get()) == -1) {
-		
-			// Set port
-			port = !strcasecmp(evhttp_uri_get_scheme(uri.get()), "http") ? HTTP_PORT : HTTPS_PORT;
-		}
-		
-		// Otherwise
-		else {
-		
-			// Set port
-			port = evhttp_uri_get_port(uri.get());
-		}
-		
-		// Initialize connection
-		unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)> connection(nullptr, evhttp_connection_free);
-		
-		// Check if using TLS
-		unique_ptr<SSL_CTX, decltype(&SSL_CTX_free)> tlsContext(nullptr, SSL_CTX_free);
-		if(!strcasecmp(evhttp_uri_get_scheme(uri.get()), "https")) {
-		
-			// Check if getting TLS method failed
-			const SSL_METHOD *tlsMethod = TLS_client_method();
-			if(!tlsMethod) {
-			
-				// Return false
-				return false;
-			}
-			
-			// Check if creating TLS context failed
-			tlsContext = unique_ptr<SSL_CTX, decltype(&SSL_CTX_free)>(SSL_CTX_new_ex(nullptr, nullptr, tlsMethod), SSL_CTX_free);
-			if(!tlsContext) {
-			
-				// Return false
-				return false;
-			}
-			
-			// Check if setting TLS context's minimum TLS version failed
-			if(!SSL_CTX_set_min_proto_version(tlsContext.get(), MINIMUM_TLS_VERSION)) {
-			
-				// Return false
-				return false;
-			}
-			
-			// Check if using the default verify paths for the TLS context failed
-			if(!SSL_CTX_set_default_verify_paths(tlsContext.get())) {
-			
-				// Return false
-				return false;
-			}
-			
-			// Set TLS context to verify server certificate
-			SSL_CTX_set_verify(tlsContext.get(), SSL_VERIFY_PEER, nullptr);
-			
-			// Check if creating TLS connection from the TLS context failed
-			unique_ptr<SSL, decltype(&SSL_free)> tlsConnection(SSL_new(tlsContext.get()), SSL_free);
-			if(!tlsConnection) {
-			
-				// Return false
-				return false;
-			}
-			
-			// Check if enabling the TLS connection's hostname checking failed
-			if(!SSL_set1_host(tlsConnection.get(), host.c_str())) {
-			
-				// Return false
-				return false;
-			}
-			
-			// Check if setting the TLS connection's server name indication failed
-			if(!SSL_set_tlsext_host_name(tlsConnection.get(), host.c_str())) {
-			
-				// Return false
-				return false;
-			}
-			
-			// Check if creating TLS buffer from TLS connection failed
-			unique_ptr<bufferevent, decltype(&bufferevent_free)> tlsBuffer(bufferevent_openssl_socket_new(eventBase.get(), -1, tlsConnection.get(), BUFFEREVENT_SSL_CONNECTING, BEV_OPT_CLOSE_ON_FREE | BEV_OPT_DEFER_CALLBACKS), bufferevent_free);
-			if(!tlsBuffer) {
-			
-				// Return false
-				return false;
-			}
-			
-			// Release TLS connection
-			tlsConnection.release();
-			
-			// Check if allow dirty shutdown for the TLS buffer failed
-			if(bufferevent_ssl_set_flags(tlsBuffer.get(), BUFFEREVENT_SSL_DIRTY_SHUTDOWN) == EV_UINT64_MAX) {
-			
-				// Return false
-				return false;
-			}
-			
-			// Check if creating connection from TLS buffer failed
-			connection = unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>(evhttp_connection_base_bufferevent_new(eventBase.get(), nullptr, tlsBuffer.get(), host.c_str(), port), evhttp_connection_free);
-			if(!connection) {
-			
-				// Return false
-				return false;
-			}
-			
-			// Release TLS buffer
-			tlsBuffer.release();
-			
-			// Set connection close callback
-			evhttp_connection_set_closecb(connection.get(), [](evhttp_connection *connection, void *argument) {
-			
-				// Check if connection's buffer event exists
-				bufferevent *bufferEvent = evhttp_connection_get_bufferevent(connection);
-				if(bufferEvent) {
-
-					// Check if buffer event's TLS connection exists
-					SSL *tlsConnection = bufferevent_openssl_get_ssl(bufferEvent);
-					if(tlsConnection) {
-					
-						// Shutdown TLS connection
-						SSL_shutdown(tlsConnection);
-					}
-				}
-			}, nullptr);
-		}
-		
-		// Otherwise
-		else {
-		
-			// Check if creating connection failed
-			connection = unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>(evhttp_connection_base_new(eventBase.get(), nullptr, host.c_str(), port), evhttp_connection_free);
-			if(!connection) {
-			
-				// Return false
-				return false;
-			}
-		}
-		
-		// Initialize result
-		bool result = false;
-		
-		// Check if creating request failed
-		unique_ptr<evhttp_request, decltype(&evhttp_request_free)> request(evhttp_request_new([](evhttp_request *request, void *argument) {
-		
-			// Get result from argument
-			bool *result = reinterpret_cast<bool *>(argument);
-			
-			// Set result to if the request was successful
-			*result = request && evhttp_request_get_response_code(request) == HTTP_OK;
-			
-		}, &result), evhttp_request_free);
-		
-		if(!request) {
-		
-			// Return false
-			return false;
-		}
-		
-		// Check if setting request's host and connection headers failed
-		if(!evhttp_request_get_output_headers(request.get()) || evhttp_add_header(evhttp_request_get_output_headers(request.get()), "Host", (evhttp_uri_get_host(uri.get()) + (((!strcasecmp(evhttp_uri_get_scheme(uri.get()), "http") && port != HTTP_PORT) || (!strcasecmp(evhttp_uri_get_scheme(uri.get()), "https") && port != HTTPS_PORT)) ? ':' + to_string(port) : "")).c_str()) || evhttp_add_header(evhttp_request_get_output_headers(request.get()), "Connection", "close")) {
-		
-			// Return false
-			return false;
-		}
-		
-		// Check if user info is provided
-		if(evhttp_uri_get_userinfo(uri.get()) && *evhttp_uri_get_userinfo(uri.get())) {
-		
-			// Check if settings request's authorization header failed
-			if(evhttp_add_header(evhttp_request_get_output_headers(request.get()), "Authorization", ("Basic " + Base64::encode(reinterpret_cast<const uint8_t *>(evhttp_uri_get_userinfo(uri.get())), strlen(evhttp_uri_get_userinfo(uri.get())))).c_str())) {
-			
-				// Return false
-				return false;
-			}
-		}
-		
-		// Check if making request failed
-		if(evhttp_make_request(connection.get(), request.get(), EVHTTP_REQ_GET, (string((evhttp_uri_get_path(uri.get()) && *evhttp_uri_get_path(uri.get())) ? evhttp_uri_get_path(uri.get()) : "/") + ((evhttp_uri_get_query(uri.get()) && *evhttp_uri_get_query(uri.get())) ? string("?") + evhttp_uri_get_query(uri.get()) : "")).c_str())) {
-		
-			// Release request
-			request.release();
-			
-			// Return false
-			return false;
-		}
-		
-		// Release request
-		request.release();
-		
-		// Check if running event loop failed
-		if(event_base_dispatch(eventBase.get()) == -1) {
-		
-			// Return false
-			return false;
-		}
-		
-		// Return result
-		return result;
-	}
-	
-	// Catch errors
-	catch(...) {
-	
-		// Return false
-		return false;
-	}
-}
-
 // Apply substitutions
 void Common::applySubstitutions(string &text, const unordered_map<string, string> &substitutions) {
 
@@ -595,11 +341,7 @@ bool Common::isZeroTimingSafe(const uint8_t *data, const size_t length) {
 string Common::multiplyStrings(const char *firstString, const char *secondString) {
 
 	// Initialize first value
-	mpfr_t firstValue;
-	mpfr_init2(firstValue, MPFR_PRECISION);
-	
-	// Automatically free first value
-	const unique_ptr<remove_pointer<mpfr_ptr>::type, decltype(&mpfr_clear)> firstValueUniquePointer(firstValue, mpfr_clear);
+	Decimal firstValue;
 	
 	// Go through all characters in the first string
 	for(const char *i = firstString; *i; ++i) {
@@ -612,8 +354,15 @@ string Common::multiplyStrings(const char *firstString, const char *secondString
 		}
 	}
 	
-	// Check if setting first value is invalid
-	if(mpfr_set_str(firstValue, firstString, DECIMAL_NUMBER_BASE, MPFR_RNDN) || mpfr_sgn(firstValue) < 0) {
+	// Try
+	try {
+	
+		// Set first value
+		firstValue = Decimal(firstString);
+	}
+	
+	// Catch errors
+	catch(...) {
 	
 		// Throw exception
 		throw runtime_error("First string is invalid");
@@ -631,11 +380,7 @@ string Common::multiplyStrings(const char *firstString, const char *secondString
 	}
 	
 	// Initialize second value
-	mpfr_t secondValue;
-	mpfr_init2(secondValue, MPFR_PRECISION);
-	
-	// Automatically free second value
-	const unique_ptr<remove_pointer<mpfr_ptr>::type, decltype(&mpfr_clear)> secondValueUniquePointer(secondValue, mpfr_clear);
+	Decimal secondValue;
 	
 	// Go through all characters in the second string
 	for(const char *i = secondString; *i; ++i) {
@@ -648,8 +393,15 @@ string Common::multiplyStrings(const char *firstString, const char *secondString
 		}
 	}
 	
-	// Check if setting second value is invalid
-	if(mpfr_set_str(secondValue, secondString, DECIMAL_NUMBER_BASE, MPFR_RNDN) || mpfr_sgn(secondValue) < 0) {
+	// Try
+	try {
+	
+		// Set second value
+		secondValue = Decimal(secondString);
+	}
+	
+	// Catch errors
+	catch(...) {
 	
 		// Throw exception
 		throw runtime_error("Second string is invalid");
@@ -664,30 +416,10 @@ string Common::multiplyStrings(const char *firstString, const char *secondString
 	}
 	
 	// Multiply first value by second value
-	mpfr_mul(firstValue, firstValue, secondValue, MPFR_RNDN);
-	
-	// Check if result is invalid
-	if(mpfr_sgn(firstValue) < 0) {
-	
-		// Throw exception
-		throw runtime_error("Result is invalid");
-	}
-	
-	// Check if getting result size failed
-	const int resultSize = mpfr_snprintf(nullptr, 0, ("%." + to_string(precision) + "R*F").c_str(), MPFR_RNDN, firstValue);
-	if(resultSize <= 0) {
+	firstValue = firstValue * secondValue;
 	
-		// Throw exception
-		throw runtime_error("Getting result size failed");
-	}
-	
-	// Check if getting result failed
-	string result(resultSize, '\0');
-	if(mpfr_sprintf(result.data(), ("%." + to_string(precision) + "R*F").c_str(), MPFR_RNDN, firstValue) != resultSize) {
-	
-		// Throw exception
-		throw runtime_error("Getting result failed");
-	}
+	// Get result
+	string result = firstValue.toString(precision);
 	
 	// Check if result isn't zero and it has precision
 	if(result != "0" && precision) {
@@ -69,9 +69,6 @@ class Common final {
 		// Hex character size
 		static const size_t HEX_CHARACTER_SIZE;
 		
-		// MPFR precision
-		static const int MPFR_PRECISION;
-		
 		// Set error occurred
 		static void setErrorOccurred();
 		
@@ -99,9 +96,6 @@ class Common final {
 		// Get signal received
 		static bool getSignalReceived();
 		
-		// Send HTTP request
-		static bool sendHttpRequest(const char *destination);
-		
 		// Apply substitutions
 		static void applySubstitutions(string &text, const unordered_map<string, string> &substitutions);
 		
@@ -38,6 +38,9 @@ const size_t Crypto::POLY1305_TAG_SIZE = 16;
 // Derive child extended private key MAC algorithm
 static const char *DERIVE_CHILD_EXTENDED_PRIVATE_KEY_MAC_ALGORITHM = "HMAC";
 
+// Derive child extended private key MAC
+static thread_local const unique_ptr<EVP_MAC, decltype(&EVP_MAC_free)> deriveChildExtendedPrivateKeyMac(EVP_MAC_fetch(nullptr, DERIVE_CHILD_EXTENDED_PRIVATE_KEY_MAC_ALGORITHM, nullptr), EVP_MAC_free);
+
 // Derive child extended private key MAC digest
 static const char *DERIVE_CHILD_EXTENDED_PRIVATE_KEY_MAC_DIGEST = "SHA-512";
 
@@ -69,12 +72,18 @@ static const unique_ptr<secp256k1_bulletproof_generators, void(*)(secp256k1_bull
 // Secp256k1 ECDSA signature digest algorithm
 static const char *SECP256K1_ECDSA_SIGNATURE_DIGEST_ALGORITHM = "SHA-256";
 
+// Secp256k1 ECDSA signature digest
+static thread_local const unique_ptr<EVP_MD, decltype(&EVP_MD_free)> secp256k1EcdsaSignatureDigest(EVP_MD_fetch(nullptr, SECP256K1_ECDSA_SIGNATURE_DIGEST_ALGORITHM, nullptr), EVP_MD_free);
+
 // DER signature maximum size
 static const size_t DER_SIGNATURE_MAXIMUM_SIZE = 72;
 
 // Single-signer hash digest algorithm
 static const char *SINGLE_SIGNER_HASH_DIGEST_ALGORITHM = "BLAKE2B-512";
 
+// Single-signer hash digest
+static thread_local const unique_ptr<EVP_MD, decltype(&EVP_MD_free)> singleSignerHashDigest(EVP_MD_fetch(nullptr, SINGLE_SIGNER_HASH_DIGEST_ALGORITHM, nullptr), EVP_MD_free);
+
 // Single-signer hash digest size
 static const size_t SINGLE_SIGNER_HASH_DIGEST_SIZE = 32;
 
@@ -87,6 +96,9 @@ static const char *X25519_KEY_TYPE = "X25519";
 // X25519 private key digest algorithm
 static const char *X25519_PRIVATE_KEY_DIGEST_ALGORITHM = "SHA-512";
 
+// X25519 private key digest
+static thread_local const unique_ptr<EVP_MD, decltype(&EVP_MD_free)> x25519PrivateKeyDigest(EVP_MD_fetch(nullptr, X25519_PRIVATE_KEY_DIGEST_ALGORITHM, nullptr), EVP_MD_free);
+
 // Ed25519 curve prime
 static const uint8_t ED25519_CURVE_PRIME[] = {0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED};
 
@@ -127,8 +139,7 @@ bool Crypto::getBlindingFactor(uint8_t blindingFactor[BLINDING_FACTOR_SIZE], con
 bool Crypto::deriveChildExtendedPrivateKey(uint8_t extendedPrivateKey[EXTENDED_PRIVATE_KEY_SIZE], const uint32_t *path, const size_t pathLength) {
 
 	// Check if getting MAC failed
-	const unique_ptr<EVP_MAC, decltype(&EVP_MAC_free)> mac(EVP_MAC_fetch(nullptr, DERIVE_CHILD_EXTENDED_PRIVATE_KEY_MAC_ALGORITHM, nullptr), EVP_MAC_free);
-	if(!mac) {
+	if(!deriveChildExtendedPrivateKeyMac) {
 	
 		// Securely clear extended private key
 		explicit_bzero(extendedPrivateKey, EXTENDED_PRIVATE_KEY_SIZE);
@@ -138,7 +149,7 @@ bool Crypto::deriveChildExtendedPrivateKey(uint8_t extendedPrivateKey[EXTENDED_P
 	}
 	
 	// Check if creating MAC context failed
-	const unique_ptr<EVP_MAC_CTX, decltype(&EVP_MAC_CTX_free)> macContext(EVP_MAC_CTX_new(mac.get()), EVP_MAC_CTX_free);
+	const unique_ptr<EVP_MAC_CTX, decltype(&EVP_MAC_CTX_free)> macContext(EVP_MAC_CTX_new(deriveChildExtendedPrivateKeyMac.get()), EVP_MAC_CTX_free);
 	if(!macContext) {
 	
 		// Securely clear extended private key
@@ -461,8 +472,7 @@ bool Crypto::getSecp256k1PublicKey(uint8_t serializedPublicKey[SECP256K1_PUBLIC_
 vector<uint8_t> Crypto::getSecp256k1EcdsaSignature(const uint8_t privateKey[SECP256K1_PRIVATE_KEY_SIZE], const uint8_t *data, const size_t dataLength) {
 
 	// Check if getting digest failed
-	const unique_ptr<EVP_MD, decltype(&EVP_MD_free)> digest(EVP_MD_fetch(nullptr, SECP256K1_ECDSA_SIGNATURE_DIGEST_ALGORITHM, nullptr), EVP_MD_free);
-	if(!digest) {
+	if(!secp256k1EcdsaSignatureDigest) {
 	
 		// Throw exception
 		throw runtime_error("Getting digest failed");
@@ -477,7 +487,7 @@ vector<uint8_t> Crypto::getSecp256k1EcdsaSignature(const uint8_t privateKey[SECP
 	}
 	
 	// Check if initializing digest context failed
-	if(!EVP_DigestInit_ex2(digestContext.get(), digest.get(), nullptr)) {
+	if(!EVP_DigestInit_ex2(digestContext.get(), secp256k1EcdsaSignatureDigest.get(), nullptr)) {
 	
 		// Throw exception
 		throw runtime_error("Initializing digest context failed");
@@ -500,7 +510,7 @@ vector<uint8_t> Crypto::getSecp256k1EcdsaSignature(const uint8_t privateKey[SECP
 		// End
 		OSSL_PARAM_END
 	};
-	if(!EVP_MD_get_params(digest.get(), getDigestLengthParameters)) {
+	if(!EVP_MD_get_params(secp256k1EcdsaSignatureDigest.get(), getDigestLengthParameters)) {
 	
 		// Throw exception
 		throw runtime_error("Getting digest length failed");
@@ -558,8 +568,7 @@ vector<uint8_t> Crypto::getSecp256k1EcdsaSignature(const uint8_t privateKey[SECP
 bool Crypto::getSecp256k1PartialSingleSignerSignature(uint8_t serializedSignature[SECP256K1_SINGLE_SIGNER_SIGNATURE_SIZE], const uint8_t privateKey[SECP256K1_PRIVATE_KEY_SIZE], const uint8_t *data, const size_t dataLength, const uint8_t privateNonce[SCALAR_SIZE], const uint8_t serializedPublicKey[SECP256K1_PUBLIC_KEY_SIZE], const uint8_t serializedPublicNonce[SECP256K1_PUBLIC_KEY_SIZE]) {
 
 	// Check if getting digest failed
-	const unique_ptr<EVP_MD, decltype(&EVP_MD_free)> digest(EVP_MD_fetch(nullptr, SINGLE_SIGNER_HASH_DIGEST_ALGORITHM, nullptr), EVP_MD_free);
-	if(!digest) {
+	if(!singleSignerHashDigest) {
 	
 		// Return false
 		return false;
@@ -582,7 +591,7 @@ bool Crypto::getSecp256k1PartialSingleSignerSignature(uint8_t serializedSignatur
 		// End
 		OSSL_PARAM_END
 	};
-	if(!EVP_DigestInit_ex2(digestContext.get(), digest.get(), setDigestLengthParameters)) {
+	if(!EVP_DigestInit_ex2(digestContext.get(), singleSignerHashDigest.get(), setDigestLengthParameters)) {
 	
 		// Return false
 		return false;
@@ -678,8 +687,7 @@ bool Crypto::getSecp256k1PartialSingleSignerSignature(uint8_t serializedSignatur
 bool Crypto::verifySecp256k1CompleteSingleSignerSignatures(const uint8_t serializedPublicKey[SECP256K1_PUBLIC_KEY_SIZE], const uint8_t serializedPublicNonce[SECP256K1_PUBLIC_KEY_SIZE], const secp256k1_pedersen_commitment &publicKeyTotalCommitment, const uint8_t completeSignature[SECP256K1_SINGLE_SIGNER_SIGNATURE_SIZE], const uint8_t serializedPartialSignature[SECP256K1_SINGLE_SIGNER_SIGNATURE_SIZE], const uint8_t *data, const size_t dataLength) {
 
 	// Check if getting digest failed
-	const unique_ptr<EVP_MD, decltype(&EVP_MD_free)> digest(EVP_MD_fetch(nullptr, SINGLE_SIGNER_HASH_DIGEST_ALGORITHM, nullptr), EVP_MD_free);
-	if(!digest) {
+	if(!singleSignerHashDigest) {
 	
 		// Return false
 		return false;
@@ -702,7 +710,7 @@ bool Crypto::verifySecp256k1CompleteSingleSignerSignatures(const uint8_t seriali
 		// End
 		OSSL_PARAM_END
 	};
-	if(!EVP_DigestInit_ex2(digestContext.get(), digest.get(), setDigestLengthParameters)) {
+	if(!EVP_DigestInit_ex2(digestContext.get(), singleSignerHashDigest.get(), setDigestLengthParameters)) {
 	
 		// Return false
 		return false;
@@ -788,8 +796,7 @@ bool Crypto::verifySecp256k1CompleteSingleSignerSignatures(const uint8_t seriali
 bool Crypto::verifySecp256k1CompleteSingleSignerSignature(const uint8_t serializedPublicKey[SECP256K1_PUBLIC_KEY_SIZE], const uint8_t serializedSignature[SECP256K1_SINGLE_SIGNER_SIGNATURE_SIZE], const uint8_t *data, const size_t dataLength) {
 
 	// Check if getting digest failed
-	const unique_ptr<EVP_MD, decltype(&EVP_MD_free)> digest(EVP_MD_fetch(nullptr, SINGLE_SIGNER_HASH_DIGEST_ALGORITHM, nullptr), EVP_MD_free);
-	if(!digest) {
+	if(!singleSignerHashDigest) {
 	
 		// Return false
 		return false;
@@ -812,7 +819,7 @@ bool Crypto::verifySecp256k1CompleteSingleSignerSignature(const uint8_t serializ
 		// End
 		OSSL_PARAM_END
 	};
-	if(!EVP_DigestInit_ex2(digestContext.get(), digest.get(), setDigestLengthParameters)) {
+	if(!EVP_DigestInit_ex2(digestContext.get(), singleSignerHashDigest.get(), setDigestLengthParameters)) {
 	
 		// Return false
 		return false;
@@ -1059,8 +1066,7 @@ bool Crypto::isValidX25519PublicKey(const uint8_t *publicKey, const size_t lengt
 bool Crypto::getX25519PrivateKey(uint8_t *x25519PrivateKey, const uint8_t ed25519PrivateKey[ED25519_PRIVATE_KEY_SIZE], const bool includePrf) {
 
 	// Check if getting digest failed
-	const unique_ptr<EVP_MD, decltype(&EVP_MD_free)> digest(EVP_MD_fetch(nullptr, X25519_PRIVATE_KEY_DIGEST_ALGORITHM, nullptr), EVP_MD_free);
-	if(!digest) {
+	if(!x25519PrivateKeyDigest) {
 	
 		// Return false;
 		return false;
@@ -1075,7 +1081,7 @@ bool Crypto::getX25519PrivateKey(uint8_t *x25519PrivateKey, const uint8_t ed2551
 	}
 	
 	// Check if initializing digest context failed
-	if(!EVP_DigestInit_ex2(digestContext.get(), digest.get(), nullptr)) {
+	if(!EVP_DigestInit_ex2(digestContext.get(), x25519PrivateKeyDigest.get(), nullptr)) {
 	
 		// Return false;
 		return false;
@@ -1098,7 +1104,7 @@ bool Crypto::getX25519PrivateKey(uint8_t *x25519PrivateKey, const uint8_t ed2551
 		// End
 		OSSL_PARAM_END
 	};
-	if(!EVP_MD_get_params(digest.get(), getDigestLengthParameters)) {
+	if(!EVP_MD_get_params(x25519PrivateKeyDigest.get(), getDigestLengthParameters)) {
 	
 		// Return false;
 		return false;
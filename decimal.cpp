@@ -0,0 +1,434 @@
+// Header files
+#include <cctype>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include "./common.h"
+#include "./decimal.h"
+
+using namespace std;
+
+
+// Constants
+
+// Maximum scale
+const uint8_t Decimal::MAXIMUM_SCALE = numeric_limits<unsigned __int128>::digits10;
+
+// Bits in a word
+static const int BITS_IN_A_WORD = numeric_limits<uint64_t>::digits;
+
+
+// Function prototypes
+
+// Multiply wide
+static pair<unsigned __int128, unsigned __int128> multiplyWide(const unsigned __int128 first, const unsigned __int128 second);
+
+// Multiply by word
+static bool multiplyByWord(pair<unsigned __int128, unsigned __int128> &value, const uint64_t multiplier);
+
+// Divide by word
+static uint64_t divideByWord(pair<unsigned __int128, unsigned __int128> &value, const uint64_t divisor);
+
+// Divide wide
+static pair<unsigned __int128, unsigned __int128> divideWide(const pair<unsigned __int128, unsigned __int128> &numerator, const unsigned __int128 divisor, bool &inexact);
+
+// Round value
+static pair<unsigned __int128, uint8_t> roundValue(pair<unsigned __int128, unsigned __int128> value, uint8_t scale, const uint8_t maximumScale, bool inexact);
+
+
+// Supporting function implementation
+
+// Constructor
+Decimal::Decimal() :
+
+	// Set mantissa
+	mantissa(0),
+	
+	// Set scale
+	scale(0)
+{
+}
+
+// Constructor
+Decimal::Decimal(const char *string) {
+
+	// Check if string is invalid
+	if(!string || !*string || (*string == '.' && !string[sizeof('.')])) {
+	
+		// Throw exception
+		throw runtime_error("String is invalid");
+	}
+	
+	// Initialize value
+	pair<unsigned __int128, unsigned __int128> value(0, 0);
+	
+	// Initialize value scale
+	uint8_t valueScale = 0;
+	
+	// Go through all characters in the string
+	bool hasDecimal = false;
+	for(const char *i = string; *i; ++i) {
+	
+		// Check if character is a decimal
+		if(*i == '.') {
+		
+			// Check if string already has a decimal
+			if(hasDecimal) {
+			
+				// Throw exception
+				throw runtime_error("String is invalid");
+			}
+			
+			// Set has decimal
+			hasDecimal = true;
+		}
+		
+		// Otherwise check if character isn't a digit
+		else if(!isdigit(*i)) {
+		
+			// Throw exception
+			throw runtime_error("String is invalid");
+		}
+		
+		// Otherwise
+		else {
+		
+			// Check if value would overflow
+			if((hasDecimal && valueScale == numeric_limits<uint8_t>::max()) || !multiplyByWord(value, Common::DECIMAL_NUMBER_BASE)) {
+			
+				// Throw exception
+				throw runtime_error("String is invalid");
+			}
+			
+			// Add digit to value
+			value.second += *i - '0';
+			
+			// Check if a carry occurred
+			if(value.second < static_cast<unsigned __int128>(*i - '0')) {
+			
+				// Add carry to value
+				++value.first;
+			}
+			
+			// Check if string has a decimal
+			if(hasDecimal) {
+			
+				// Increment value scale
+				++valueScale;
+			}
+		}
+	}
+	
+	// Set mantissa and scale to the rounded value
+	tie(mantissa, scale) = roundValue(value, valueScale, MAXIMUM_SCALE, false);
+}
+
+// Constructor
+Decimal::Decimal(const uint64_t integer) :
+
+	// Set mantissa
+	mantissa(integer),
+	
+	// Set scale
+	scale(0)
+{
+}
+
+// Constructor
+Decimal::Decimal(const unsigned __int128 mantissa, const uint8_t scale) :
+
+	// Set mantissa
+	mantissa(mantissa),
+	
+	// Set scale
+	scale(scale)
+{
+}
+
+// Addition operator
+Decimal Decimal::operator+(const Decimal &other) const {
+
+	// Initialize values
+	pair<unsigned __int128, unsigned __int128> firstValue(0, mantissa);
+	pair<unsigned __int128, unsigned __int128> secondValue(0, other.mantissa);
+	
+	// Go through all missing digits in the first value
+	for(uint8_t i = scale; i < other.scale; ++i) {
+	
+		// Check if scaling first value overflowed
+		if(!multiplyByWord(firstValue, Common::DECIMAL_NUMBER_BASE)) {
+		
+			// Throw exception
+			throw runtime_error("Decimal overflow");
+		}
+	}
+	
+	// Go through all missing digits in the second value
+	for(uint8_t i = other.scale; i < scale; ++i) {
+	
+		// Check if scaling second value overflowed
+		if(!multiplyByWord(secondValue, Common::DECIMAL_NUMBER_BASE)) {
+		
+			// Throw exception
+			throw runtime_error("Decimal overflow");
+		}
+	}
+	
+	// Add second value to the first value
+	firstValue.second += secondValue.second;
+	firstValue.first += secondValue.first + (firstValue.second < secondValue.second);
+	
+	// Return rounded result
+	const pair result = roundValue(firstValue, max(scale, other.scale), MAXIMUM_SCALE, false);
+	return Decimal(result.first, result.second);
+}
+
+// Multiplication operator
+Decimal Decimal::operator*(const Decimal &other) const {
+
+	// Return rounded product
+	const pair result = roundValue(multiplyWide(mantissa, other.mantissa), scale + other.scale, MAXIMUM_SCALE, false);
+	return Decimal(result.first, result.second);
+}
+
+// Divide
+Decimal Decimal::divide(const Decimal &divisor, const uint8_t resultScale) const {
+
+	// Check if divisor is zero
+	if(divisor.isZero()) {
+	
+		// Throw exception
+		throw runtime_error("Division by zero");
+	}
+	
+	// Get working scale with an extra digit for rounding
+	int workingScale = min(resultScale, MAXIMUM_SCALE) + 1;
+	
+	// Get number of digits to scale the numerator by
+	int numberOfDigits = workingScale + divisor.scale - scale;
+	
+	// Check if the numerator's scale is already greater than the working scale
+	if(numberOfDigits < 0) {
+	
+		// Use the numerator's scale as the working scale
+		workingScale -= numberOfDigits;
+		numberOfDigits = 0;
+	}
+	
+	// Go through all digits to scale the numerator by
+	pair<unsigned __int128, unsigned __int128> numerator(0, mantissa);
+	for(; numberOfDigits; --numberOfDigits) {
+	
+		// Check if scaling numerator overflowed
+		if(!multiplyByWord(numerator, Common::DECIMAL_NUMBER_BASE)) {
+		
+			// Throw exception since the quotient can't have the requested scale
+			throw runtime_error("Decimal overflow");
+		}
+	}
+	
+	// Divide numerator by the divisor
+	bool inexact;
+	const pair<unsigned __int128, unsigned __int128> quotient = divideWide(numerator, divisor.mantissa, inexact);
+	
+	// Return rounded quotient
+	const pair result = roundValue(quotient, workingScale, min(resultScale, MAXIMUM_SCALE), inexact);
+	return Decimal(result.first, result.second);
+}
+
+// Is zero
+bool Decimal::isZero() const {
+
+	// Return if mantissa is zero
+	return !mantissa;
+}
+
+// To string
+string Decimal::toString(const size_t precision) const {
+
+	// Get value rounded to the precision
+	const pair<unsigned __int128, uint8_t> value = (precision < scale) ? roundValue({0, mantissa}, scale, precision, false) : pair<unsigned __int128, uint8_t>(mantissa, scale);
+	
+	// Go through all digits in the value
+	string result;
+	unsigned __int128 remaining = value.first;
+	do {
+	
+		// Add digit to result
+		result.push_back('0' + static_cast<char>(remaining % Common::DECIMAL_NUMBER_BASE));
+		
+		// Remove digit from remaining
+		remaining /= Common::DECIMAL_NUMBER_BASE;
+	
+	} while(remaining || result.size() <= value.second);
+	
+	// Put digits in order
+	result = string(result.rbegin(), result.rend());
+	
+	// Check if precision exists
+	if(precision) {
+	
+		// Insert decimal into result
+		result.insert(result.size() - value.second, 1, '.');
+		
+		// Pad result to the precision
+		result.append(precision - value.second, '0');
+	}
+	
+	// Return result
+	return result;
+}
+
+// Multiply wide
+pair<unsigned __int128, unsigned __int128> multiplyWide(const unsigned __int128 first, const unsigned __int128 second) {
+
+	// Get words
+	const uint64_t firstLow = first;
+	const uint64_t firstHigh = first >> BITS_IN_A_WORD;
+	const uint64_t secondLow = second;
+	const uint64_t secondHigh = second >> BITS_IN_A_WORD;
+	
+	// Get partial products
+	const unsigned __int128 lowLow = static_cast<unsigned __int128>(firstLow) * secondLow;
+	const unsigned __int128 lowHigh = static_cast<unsigned __int128>(firstLow) * secondHigh;
+	const unsigned __int128 highLow = static_cast<unsigned __int128>(firstHigh) * secondLow;
+	const unsigned __int128 highHigh = static_cast<unsigned __int128>(firstHigh) * secondHigh;
+	
+	// Get middle sum
+	const unsigned __int128 middle = (lowLow >> BITS_IN_A_WORD) + static_cast<uint64_t>(lowHigh) + static_cast<uint64_t>(highLow);
+	
+	// Return product
+	return {highHigh + (lowHigh >> BITS_IN_A_WORD) + (highLow >> BITS_IN_A_WORD) + (middle >> BITS_IN_A_WORD), (middle << BITS_IN_A_WORD) | static_cast<uint64_t>(lowLow)};
+}
+
+// Multiply by word
+bool multiplyByWord(pair<unsigned __int128, unsigned __int128> &value, const uint64_t multiplier) {
+
+	// Multiply low part by the multiplier
+	const pair<unsigned __int128, unsigned __int128> low = multiplyWide(value.second, multiplier);
+	
+	// Multiply high part by the multiplier
+	const pair<unsigned __int128, unsigned __int128> high = multiplyWide(value.first, multiplier);
+	
+	// Check if result overflowed
+	if(high.first || high.second > numeric_limits<unsigned __int128>::max() - low.first) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Set value to the result
+	value = {high.second + low.first, low.second};
+	
+	// Return true
+	return true;
+}
+
+// Divide by word
+uint64_t divideByWord(pair<unsigned __int128, unsigned __int128> &value, const uint64_t divisor) {
+
+	// Go through all words in the value from most significant to least significant
+	const uint64_t words[] = {static_cast<uint64_t>(value.first >> BITS_IN_A_WORD), static_cast<uint64_t>(value.first), static_cast<uint64_t>(value.second >> BITS_IN_A_WORD), static_cast<uint64_t>(value.second)};
+	uint64_t quotient[sizeof(words) / sizeof(words[0])];
+	unsigned __int128 remainder = 0;
+	for(size_t i = 0; i < sizeof(words) / sizeof(words[0]); ++i) {
+	
+		// Get current dividend
+		const unsigned __int128 dividend = (remainder << BITS_IN_A_WORD) | words[i];
+		
+		// Set quotient word and remainder
+		quotient[i] = dividend / divisor;
+		remainder = dividend % divisor;
+	}
+	
+	// Set value to the quotient
+	value = {(static_cast<unsigned __int128>(quotient[0]) << BITS_IN_A_WORD) | quotient[1], (static_cast<unsigned __int128>(quotient[2]) << BITS_IN_A_WORD) | quotient[3]};
+	
+	// Return remainder
+	return remainder;
+}
+
+// Divide wide
+pair<unsigned __int128, unsigned __int128> divideWide(const pair<unsigned __int128, unsigned __int128> &numerator, const unsigned __int128 divisor, bool &inexact) {
+
+	// Go through all bits in the numerator from most significant to least significant
+	pair<unsigned __int128, unsigned __int128> quotient(0, 0);
+	unsigned __int128 remainder = 0;
+	for(int i = numeric_limits<unsigned __int128>::digits * 2 - 1; i >= 0; --i) {
+	
+		// Get if the remainder will overflow
+		const bool carry = remainder >> (numeric_limits<unsigned __int128>::digits - 1);
+		
+		// Add bit to the remainder
+		remainder = (remainder << 1) | (((i >= numeric_limits<unsigned __int128>::digits) ? (numerator.first >> (i - numeric_limits<unsigned __int128>::digits)) : (numerator.second >> i)) & 1);
+		
+		// Check if the divisor fits in the remainder
+		if(carry || remainder >= divisor) {
+		
+			// Subtract divisor from the remainder
+			remainder -= divisor;
+			
+			// Check if bit is in the quotient's high part
+			if(i >= numeric_limits<unsigned __int128>::digits) {
+			
+				// Set bit in the quotient's high part
+				quotient.first |= static_cast<unsigned __int128>(1) << (i - numeric_limits<unsigned __int128>::digits);
+			}
+			
+			// Otherwise
+			else {
+			
+				// Set bit in the quotient's low part
+				quotient.second |= static_cast<unsigned __int128>(1) << i;
+			}
+		}
+	}
+	
+	// Set inexact to if a remainder exists
+	inexact = remainder;
+	
+	// Return quotient
+	return quotient;
+}
+
+// Round value
+pair<unsigned __int128, uint8_t> roundValue(pair<unsigned __int128, unsigned __int128> value, uint8_t scale, const uint8_t maximumScale, bool inexact) {
+
+	// Loop while the value doesn't fit in a mantissa or has too many digits
+	int digit = 0;
+	while(value.first || scale > maximumScale) {
+	
+		// Check if no more digits can be removed
+		if(!scale) {
+		
+			// Throw exception
+			throw runtime_error("Decimal overflow");
+		}
+		
+		// Update inexact with the previously removed digit
+		inexact |= digit != 0;
+		
+		// Remove least significant digit from the value
+		digit = divideByWord(value, Common::DECIMAL_NUMBER_BASE);
+		
+		// Decrement scale
+		--scale;
+	}
+	
+	// Check if value should be rounded up using round half to even
+	if(digit > Common::DECIMAL_NUMBER_BASE / 2 || (digit == Common::DECIMAL_NUMBER_BASE / 2 && (inexact || (value.second & 1)))) {
+	
+		// Check if rounding up overflows
+		if(value.second == numeric_limits<unsigned __int128>::max()) {
+		
+			// Throw exception
+			throw runtime_error("Decimal overflow");
+		}
+		
+		// Round up value
+		++value.second;
+	}
+	
+	// Return value and scale
+	return {value.second, scale};
+}
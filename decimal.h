@@ -0,0 +1,62 @@
+// Header guard
+#ifndef DECIMAL_H
+#define DECIMAL_H
+
+
+// Header files
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+
+// Classes
+
+// Decimal class
+class Decimal final {
+
+	// Public
+	public:
+	
+		// Maximum scale
+		static const uint8_t MAXIMUM_SCALE;
+		
+		// Constructor
+		Decimal();
+		
+		// Constructor
+		explicit Decimal(const char *string);
+		
+		// Constructor
+		explicit Decimal(const uint64_t integer);
+		
+		// Addition operator
+		Decimal operator+(const Decimal &other) const;
+		
+		// Multiplication operator
+		Decimal operator*(const Decimal &other) const;
+		
+		// Divide
+		Decimal divide(const Decimal &divisor, const uint8_t resultScale) const;
+		
+		// Is zero
+		bool isZero() const;
+		
+		// To string
+		string toString(const size_t precision) const;
+	
+	// Private
+	private:
+	
+		// Constructor
+		explicit Decimal(const unsigned __int128 mantissa, const uint8_t scale);
+		
+		// Mantissa
+		unsigned __int128 mantissa;
+		
+		// Scale
+		uint8_t scale;
+};
+
+
+#endif
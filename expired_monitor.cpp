@@ -7,22 +7,19 @@
 using namespace std;
 
 
-// Constants
-
-// Check interval seconds
-static const unsigned int CHECK_INTERVAL_SECONDS = 1;
-
-
 // Supporting function implementation
 
 // Constructor
-ExpiredMonitor::ExpiredMonitor(Payments &payments) :
+ExpiredMonitor::ExpiredMonitor(Payments &payments, HttpClient &httpClient) :
 
 	// Set quit
 	quit(false),
 	
 	// Set payments
-	payments(payments)
+	payments(payments),
+	
+	// Set HTTP client
+	httpClient(httpClient)
 {
 
 	// Display message
@@ -65,8 +62,8 @@ ExpiredMonitor::~ExpiredMonitor() {
 	// Set quit
 	quit.store(true);
 	
-	// Send signal to main thread to fail syscalls
-	pthread_kill(mainThread.native_handle(), SIGUSR1);
+	// Stop main thread from waiting for expired payments or their callbacks
+	payments.stopWaitingForExpiredPayments();
 	
 	// Try
 	try {
@@ -95,14 +92,11 @@ void ExpiredMonitor::run() {
 	// Try
 	try {
 	
-		// While not quitting
-		while(!quit.load()) {
+		// While payments expired and not quitting
+		while(payments.waitForExpiredPayments(quit)) {
 		
 			// Run unsuccessful expired payment callbacks
-			payments.runUnsuccessfulExpiredPaymentCallbacks();
-			
-			// Sleep
-			sleep(CHECK_INTERVAL_SECONDS);
+			payments.runUnsuccessfulExpiredPaymentCallbacks(httpClient, quit);
 		}
 	}
 	
@@ -6,6 +6,7 @@
 // Header files
 #include <atomic>
 #include <thread>
+#include "./http_client.h"
 #include "./payments.h"
 
 using namespace std;
@@ -20,7 +21,7 @@ class ExpiredMonitor final {
 	public:
 	
 		// Constructor
-		explicit ExpiredMonitor(Payments &payments);
+		explicit ExpiredMonitor(Payments &payments, HttpClient &httpClient);
 		
 		// Destructor
 		~ExpiredMonitor();
@@ -37,6 +38,9 @@ class ExpiredMonitor final {
 		// Payments
 		Payments &payments;
 		
+		// HTTP client
+		HttpClient &httpClient;
+		
 		// Main thread
 		thread mainThread;
 };
@@ -0,0 +1,1168 @@
+// Header files
+#include <cstring>
+#include <future>
+#include <iostream>
+#include <netinet/in.h>
+#include <signal.h>
+#include <syncstream>
+#include <tuple>
+#include "./base64.h"
+#include "./common.h"
+#include "event2/bufferevent_ssl.h"
+#include "event2/thread.h"
+#include "event2/util.h"
+#include "./http_client.h"
+
+using namespace std;
+
+
+// Constants
+
+// Minimum TLS version
+static const int MINIMUM_TLS_VERSION = TLS1_VERSION;
+
+// Maximum active requests per destination
+static const size_t MAXIMUM_ACTIVE_REQUESTS_PER_DESTINATION = 8;
+
+// Maximum idle connections per destination
+static const size_t MAXIMUM_IDLE_CONNECTIONS_PER_DESTINATION = MAXIMUM_ACTIVE_REQUESTS_PER_DESTINATION;
+
+// Request timeout seconds
+static const int REQUEST_TIMEOUT_SECONDS = 1 * Common::SECONDS_IN_A_MINUTE;
+
+// DNS cache time to live
+static const chrono::seconds DNS_CACHE_TIME_TO_LIVE(5 * Common::SECONDS_IN_A_MINUTE);
+
+// Maximum DNS cache size
+static const size_t MAXIMUM_DNS_CACHE_SIZE = 256;
+
+// Maximum TLS sessions
+static const size_t MAXIMUM_TLS_SESSIONS = 256;
+
+// Send request timeout
+static const chrono::seconds SEND_REQUEST_TIMEOUT(3 * REQUEST_TIMEOUT_SECONDS);
+
+
+// Supporting function implementation
+
+// Constructor
+HttpClient::HttpClient() :
+
+	// Set event base
+	eventBase(nullptr, event_base_free),
+	
+	// Set DNS base
+	dnsBase(nullptr, [](evdns_base *dnsBase) {
+	
+		// Free DNS base and fail its pending requests
+		evdns_base_free(dnsBase, true);
+	}),
+	
+	// Set TLS context
+	tlsContext(nullptr, SSL_CTX_free),
+	
+	// Set stopped
+	stopped(false),
+	
+	// Set next handler ID
+	nextHandlerId(0)
+{
+
+	// Display message
+	osyncstream(cout) << "Starting HTTP client" << endl;
+	
+	// Check if enabling threads support failed
+	if(evthread_use_pthreads()) {
+	
+		// Throw exception
+		throw runtime_error("Enabling HTTP client threads support failed");
+	}
+	
+	// Check if creating event base failed
+	eventBase = unique_ptr<event_base, decltype(&event_base_free)>(event_base_new(), event_base_free);
+	if(!eventBase) {
+	
+		// Throw exception
+		throw runtime_error("Creating HTTP client event base failed");
+	}
+	
+	// Check if creating DNS base failed
+	dnsBase = unique_ptr<evdns_base, void(*)(evdns_base *)>(evdns_base_new(eventBase.get(), EVDNS_BASE_INITIALIZE_NAMESERVERS), dnsBase.get_deleter());
+	if(!dnsBase) {
+	
+		// Throw exception
+		throw runtime_error("Creating HTTP client DNS base failed");
+	}
+	
+	// Check if getting TLS method failed
+	const SSL_METHOD *tlsMethod = TLS_client_method();
+	if(!tlsMethod) {
+	
+		// Throw exception
+		throw runtime_error("Getting HTTP client TLS method failed");
+	}
+	
+	// Check if creating TLS context failed
+	tlsContext = unique_ptr<SSL_CTX, decltype(&SSL_CTX_free)>(SSL_CTX_new_ex(nullptr, nullptr, tlsMethod), SSL_CTX_free);
+	if(!tlsContext) {
+	
+		// Throw exception
+		throw runtime_error("Creating HTTP client TLS context failed");
+	}
+	
+	// Check if setting TLS context's minimum TLS version failed
+	if(!SSL_CTX_set_min_proto_version(tlsContext.get(), MINIMUM_TLS_VERSION)) {
+	
+		// Throw exception
+		throw runtime_error("Setting HTTP client TLS context's minimum TLS version failed");
+	}
+	
+	// Check if using the default verify paths for the TLS context failed
+	if(!SSL_CTX_set_default_verify_paths(tlsContext.get())) {
+	
+		// Throw exception
+		throw runtime_error("Using the default verify paths for the HTTP client TLS context failed");
+	}
+	
+	// Set TLS context to verify server certificate
+	SSL_CTX_set_verify(tlsContext.get(), SSL_VERIFY_PEER, nullptr);
+	
+	// Set TLS context to keep client sessions so that they can be resumed
+	SSL_CTX_set_session_cache_mode(tlsContext.get(), SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL);
+	
+	// Try
+	try {
+	
+		// Create main thread
+		mainThread = thread(&HttpClient::run, this);
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Throw exception
+		throw runtime_error("Creating HTTP client main thread failed");
+	}
+	
+	// Check if main thread is invalid
+	if(!mainThread.joinable()) {
+	
+		// Display message
+		osyncstream(cout) << "HTTP client main thread is invalid" << endl;
+		
+		// Exit failure
+		exit(EXIT_FAILURE);
+	}
+	
+	// Display message
+	osyncstream(cout) << "HTTP client started" << endl;
+}
+
+// Destructor
+HttpClient::~HttpClient() {
+
+	// Display message
+	osyncstream(cout) << "Closing HTTP client" << endl;
+	
+	// Check if exiting event loop failed
+	if(event_base_loopexit(eventBase.get(), nullptr)) {
+	
+		// Display message
+		osyncstream(cout) << "Exiting HTTP client event loop failed" << endl;
+		
+		// Exit failure
+		exit(EXIT_FAILURE);
+	}
+	
+	// Try
+	try {
+	
+		// Wait for main thread to finish
+		mainThread.join();
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Display message
+		osyncstream(cout) << "Waiting for HTTP client to finish failed" << endl;
+		
+		// Exit failure
+		exit(EXIT_FAILURE);
+	}
+	
+	// Remove pending requests since their handlers were already failed
+	pendingRequests.clear();
+	
+	// Free DNS base
+	dnsBase.reset();
+	
+	// Go through all open connections
+	while(!connectionDestinations.empty()) {
+	
+		// Close connection
+		closeConnection(connectionDestinations.begin()->first);
+	}
+	
+	// Free closed connections
+	freeClosedConnections();
+	
+	// Display message
+	osyncstream(cout) << "HTTP client closed" << endl;
+}
+
+// Send request
+bool HttpClient::sendRequest(const char *destination) {
+
+	// Try
+	try {
+	
+		// Initialize result that the handler can still set after waiting for it timed out
+		const shared_ptr<promise<bool>> result = make_shared<promise<bool>>();
+		future<bool> resultFuture = result->get_future();
+		
+		// Check if sending request failed
+		if(!sendRequest(destination, [result](const bool successful) {
+		
+			// Set result to if the request was successful
+			result->set_value(successful);
+		})) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Check if waiting for result timed out
+		if(resultFuture.wait_for(SEND_REQUEST_TIMEOUT) != future_status::ready) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Return result
+		return resultFuture.get();
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Return false
+		return false;
+	}
+}
+
+// Send request
+bool HttpClient::sendRequest(const char *destination, function<void(const bool)> &&handler) {
+
+	// Initialize handler ID
+	uint64_t handlerId;
+	
+	// Try
+	try {
+	
+		// Lock handlers
+		lock_guard guard(handlersLock);
+		
+		// Check if event loop stopped
+		if(stopped) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Add handler to handlers so that it's run even if the event loop stops before the request finishes
+		handlerId = nextHandlerId++;
+		handlers.emplace(handlerId, move(handler));
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Try
+	try {
+	
+		// Check if adding request to the event loop failed
+		unique_ptr<tuple<HttpClient *, string, uint64_t>> requestInfo = make_unique<tuple<HttpClient *, string, uint64_t>>(this, destination, handlerId);
+		if(event_base_once(eventBase.get(), -1, EV_TIMEOUT, [](const evutil_socket_t fileDescriptor, const short signal, void *argument) {
+		
+			// Get request info from argument
+			const unique_ptr<tuple<HttpClient *, string, uint64_t>> requestInfo(reinterpret_cast<tuple<HttpClient *, string, uint64_t> *>(argument));
+			
+			// Get self from request info
+			HttpClient *self = get<0>(*requestInfo);
+			
+			// Get handler ID from request info
+			const uint64_t handlerId = get<2>(*requestInfo);
+			
+			// Queue request
+			self->queueRequest(get<1>(*requestInfo), [self, handlerId](const bool successful) {
+			
+				// Run handler
+				self->runHandler(handlerId, successful);
+			});
+			
+		}, requestInfo.get(), nullptr)) {
+		
+			// Throw exception
+			throw runtime_error("Adding request to the event loop failed");
+		}
+		
+		// Release request info
+		requestInfo.release();
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Lock handlers
+		lock_guard guard(handlersLock);
+		
+		// Remove handler from handlers
+		handlers.erase(handlerId);
+	
+		// Return false
+		return false;
+	}
+	
+	// Return true
+	return true;
+}
+
+// Run
+void HttpClient::run() {
+
+	// Try
+	try {
+	
+		// Check if running event loop failed
+		if(event_base_loop(eventBase.get(), EVLOOP_NO_EXIT_ON_EMPTY) == -1) {
+		
+			// Throw exception
+			throw runtime_error("Running HTTP client event loop failed");
+		}
+	}
+	
+	// Catch runtime errors
+	catch(const runtime_error &error) {
+	
+		// Display message
+		osyncstream(cout) << error.what() << endl;
+		
+		// Set error occurred
+		Common::setErrorOccurred();
+		
+		// Raise interrupt signal
+		kill(getpid(), SIGINT);
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Display message
+		osyncstream(cout) << "HTTP client failed for unknown reason" << endl;
+		
+		// Set error occurred
+		Common::setErrorOccurred();
+		
+		// Raise interrupt signal
+		kill(getpid(), SIGINT);
+	}
+	
+	// Fail handlers since the event loop stopped
+	failHandlers();
+}
+
+// Queue request
+void HttpClient::queueRequest(const string &destination, function<void(const bool)> &&handler) {
+
+	// Try
+	try {
+	
+		// Check if parsing destination failed
+		const unique_ptr<evhttp_uri, decltype(&evhttp_uri_free)> uri(evhttp_uri_parse(destination.c_str()), evhttp_uri_free);
+		if(!uri || !evhttp_uri_get_scheme(uri.get()) || !evhttp_uri_get_host(uri.get())) {
+		
+			// Run handler
+			handler(false);
+			
+			// Return
+			return;
+		}
+		
+		// Get destination key
+		const string destinationKey = getDestinationKey(getDestination(uri.get()));
+		
+		// Set handler to start the destination's next request when done
+		function<void(const bool)> requestHandler = [this, destinationKey, handler = move(handler)](const bool successful) {
+		
+			// Run handler
+			handler(successful);
+			
+			// Finish request
+			finishRequest(destinationKey);
+		};
+		
+		// Check if the destination has the maximum number of active requests
+		size_t &destinationActiveRequests = activeRequests[destinationKey];
+		if(destinationActiveRequests >= MAXIMUM_ACTIVE_REQUESTS_PER_DESTINATION) {
+		
+			// Add request to the destination's pending requests
+			pendingRequests[destinationKey].emplace_back(destination, move(requestHandler));
+		}
+		
+		// Otherwise
+		else {
+		
+			// Increment destination's active requests
+			++destinationActiveRequests;
+			
+			// Start request
+			startRequest(destination, move(requestHandler));
+		}
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Check if handler wasn't used
+		if(handler) {
+		
+			// Run handler
+			handler(false);
+		}
+	}
+}
+
+// Finish request
+void HttpClient::finishRequest(const string &destinationKey) {
+
+	// Check if the destination has pending requests
+	unordered_map<string, list<pair<string, function<void(const bool)>>>>::iterator destinationPendingRequests = pendingRequests.find(destinationKey);
+	if(destinationPendingRequests != pendingRequests.end() && !destinationPendingRequests->second.empty()) {
+	
+		// Remove next request from the destination's pending requests
+		pair<string, function<void(const bool)>> request = move(destinationPendingRequests->second.front());
+		destinationPendingRequests->second.pop_front();
+		
+		// Check if destination doesn't have any pending requests
+		if(destinationPendingRequests->second.empty()) {
+		
+			// Remove destination's pending requests
+			pendingRequests.erase(destinationPendingRequests);
+		}
+		
+		// Start request
+		startRequest(request.first, move(request.second));
+	}
+	
+	// Otherwise check if destination has active requests
+	else if(activeRequests.contains(destinationKey) && !--activeRequests[destinationKey]) {
+	
+		// Remove destination's active requests
+		activeRequests.erase(destinationKey);
+	}
+}
+
+// Run handler
+void HttpClient::runHandler(const uint64_t handlerId, const bool successful) {
+
+	// Initialize handler
+	function<void(const bool)> handler;
+	
+	// Lock handlers
+	unique_lock guard(handlersLock);
+	
+	// Check if handler was already run
+	unordered_map<uint64_t, function<void(const bool)>>::iterator handlerIterator = handlers.find(handlerId);
+	if(handlerIterator == handlers.end()) {
+	
+		// Return
+		return;
+	}
+	
+	// Remove handler from handlers
+	handler = move(handlerIterator->second);
+	handlers.erase(handlerIterator);
+	
+	// Unlock handlers
+	guard.unlock();
+	
+	// Run handler
+	handler(successful);
+}
+
+// Fail handlers
+void HttpClient::failHandlers() {
+
+	// Initialize failed handlers
+	unordered_map<uint64_t, function<void(const bool)>> failedHandlers;
+	
+	// Lock handlers
+	unique_lock guard(handlersLock);
+	
+	// Set stopped
+	stopped = true;
+	
+	// Remove all handlers from handlers
+	failedHandlers.swap(handlers);
+	
+	// Unlock handlers
+	guard.unlock();
+	
+	// Go through all failed handlers
+	for(pair<const uint64_t, function<void(const bool)>> &failedHandler : failedHandlers) {
+	
+		// Try
+		try {
+		
+			// Run handler
+			failedHandler.second(false);
+		}
+		
+		// Catch errors
+		catch(...) {
+		
+		}
+	}
+}
+
+// Start request
+void HttpClient::startRequest(const string &destination, function<void(const bool)> &&handler) {
+
+	// Try
+	try {
+	
+		// Check if parsing destination failed
+		const unique_ptr<evhttp_uri, decltype(&evhttp_uri_free)> uri(evhttp_uri_parse(destination.c_str()), evhttp_uri_free);
+		if(!uri) {
+		
+			// Run handler
+			handler(false);
+			
+			// Return
+			return;
+		}
+		
+		// Get destination's host, port, and if using TLS
+		const tuple destinationInfo = getDestination(uri.get());
+		const string &host = get<0>(destinationInfo);
+		const uint16_t &port = get<1>(destinationInfo);
+		const bool &useTls = get<2>(destinationInfo);
+		
+		// Get destination key
+		const string destinationKey = getDestinationKey(destinationInfo);
+		
+		// Check if an idle connection to the destination exists
+		unordered_map<string, list<evhttp_connection *>>::iterator destinationIdleConnections = idleConnections.find(destinationKey);
+		if(destinationIdleConnections != idleConnections.end() && !destinationIdleConnections->second.empty()) {
+		
+			// Remove connection from the destination's idle connections
+			evhttp_connection *connection = destinationIdleConnections->second.front();
+			destinationIdleConnections->second.pop_front();
+			
+			// Make request with the connection
+			makeRequest(connection, true, destination, move(handler));
+			
+			// Return
+			return;
+		}
+		
+		// Check if host's address is cached
+		unordered_map<string, pair<string, chrono::steady_clock::time_point>>::const_iterator cachedAddress = dnsCache.find(host);
+		if(cachedAddress != dnsCache.end() && cachedAddress->second.second > chrono::steady_clock::now()) {
+		
+			// Check if creating connection to the destination failed
+			evhttp_connection *connection = createConnection(destinationKey, useTls, host, cachedAddress->second.first, port);
+			if(!connection) {
+			
+				// Run handler
+				handler(false);
+				
+				// Return
+				return;
+			}
+			
+			// Make request with the connection
+			makeRequest(connection, false, destination, move(handler));
+			
+			// Return
+			return;
+		}
+		
+		// Set resolve hints
+		const evutil_addrinfo hints = {
+		
+			// Flags
+			.ai_flags = EVUTIL_AI_ADDRCONFIG,
+			
+			// Family
+			.ai_family = AF_UNSPEC,
+			
+			// Socket type
+			.ai_socktype = SOCK_STREAM,
+			
+			// Protocol
+			.ai_protocol = IPPROTO_TCP
+		};
+		
+		// Resolve host's address
+		evdns_getaddrinfo(dnsBase.get(), host.c_str(), nullptr, &hints, [](const int result, evutil_addrinfo *addresses, void *argument) {
+		
+			// Get resolve info from argument
+			const unique_ptr<tuple<HttpClient *, string, string, function<void(const bool)>>> resolveInfo(reinterpret_cast<tuple<HttpClient *, string, string, function<void(const bool)>> *>(argument));
+			
+			// Automatically free addresses
+			const unique_ptr<evutil_addrinfo, decltype(&evutil_freeaddrinfo)> addressesUniquePointer(addresses, evutil_freeaddrinfo);
+			
+			// Try
+			try {
+			
+				// Check if resolving host's address failed
+				char address[INET6_ADDRSTRLEN];
+				if(result || !addresses || (addresses->ai_family != AF_INET && addresses->ai_family != AF_INET6) || !evutil_inet_ntop(addresses->ai_family, (addresses->ai_family == AF_INET) ? static_cast<const void *>(&reinterpret_cast<const sockaddr_in *>(addresses->ai_addr)->sin_addr) : static_cast<const void *>(&reinterpret_cast<const sockaddr_in6 *>(addresses->ai_addr)->sin6_addr), address, sizeof(address))) {
+				
+					// Run handler
+					get<3>(*resolveInfo)(false);
+					
+					// Return
+					return;
+				}
+				
+				// Get self from resolve info
+				HttpClient *self = get<0>(*resolveInfo);
+				
+				// Cache host's address
+				self->cacheAddress(get<1>(*resolveInfo), address);
+				
+				// Start request now that the host's address is cached
+				self->startRequest(get<2>(*resolveInfo), move(get<3>(*resolveInfo)));
+			}
+			
+			// Catch errors
+			catch(...) {
+			
+				// Check if handler wasn't used
+				if(get<3>(*resolveInfo)) {
+				
+					// Run handler
+					get<3>(*resolveInfo)(false);
+				}
+			}
+		
+		}, new tuple<HttpClient *, string, string, function<void(const bool)>>(this, host, destination, move(handler)));
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Check if handler wasn't used
+		if(handler) {
+		
+			// Run handler
+			handler(false);
+		}
+	}
+}
+
+// Create connection
+evhttp_connection *HttpClient::createConnection(const string &destinationKey, const bool useTls, const string &host, const string &address, const uint16_t port) {
+
+	// Initialize connection
+	unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)> connection(nullptr, evhttp_connection_free);
+	
+	// Check if using TLS
+	if(useTls) {
+	
+		// Check if creating TLS connection from the TLS context failed
+		unique_ptr<SSL, decltype(&SSL_free)> tlsConnection(SSL_new(tlsContext.get()), SSL_free);
+		if(!tlsConnection) {
+		
+			// Return nothing
+			return nullptr;
+		}
+		
+		// Check if enabling the TLS connection's hostname checking failed
+		if(!SSL_set1_host(tlsConnection.get(), host.c_str())) {
+		
+			// Return nothing
+			return nullptr;
+		}
+		
+		// Check if setting the TLS connection's server name indication failed
+		if(!SSL_set_tlsext_host_name(tlsConnection.get(), host.c_str())) {
+		
+			// Return nothing
+			return nullptr;
+		}
+		
+		// Check if a TLS session exists for the destination
+		unordered_map<string, unique_ptr<SSL_SESSION, decltype(&SSL_SESSION_free)>>::const_iterator tlsSession = tlsSessions.find(destinationKey);
+		if(tlsSession != tlsSessions.end()) {
+		
+			// Check if setting the TLS connection to resume the TLS session failed
+			if(!SSL_set_session(tlsConnection.get(), tlsSession->second.get())) {
+			
+				// Return nothing
+				return nullptr;
+			}
+		}
+		
+		// Check if creating TLS buffer from TLS connection failed
+		unique_ptr<bufferevent, decltype(&bufferevent_free)> tlsBuffer(bufferevent_openssl_socket_new(eventBase.get(), -1, tlsConnection.get(), BUFFEREVENT_SSL_CONNECTING, BEV_OPT_CLOSE_ON_FREE | BEV_OPT_DEFER_CALLBACKS), bufferevent_free);
+		if(!tlsBuffer) {
+		
+			// Return nothing
+			return nullptr;
+		}
+		
+		// Release TLS connection
+		tlsConnection.release();
+		
+		// Check if allow dirty shutdown for the TLS buffer failed
+		if(bufferevent_ssl_set_flags(tlsBuffer.get(), BUFFEREVENT_SSL_DIRTY_SHUTDOWN) == EV_UINT64_MAX) {
+		
+			// Return nothing
+			return nullptr;
+		}
+		
+		// Check if creating connection from TLS buffer failed
+		connection = unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>(evhttp_connection_base_bufferevent_new(eventBase.get(), nullptr, tlsBuffer.get(), address.c_str(), port), evhttp_connection_free);
+		if(!connection) {
+		
+			// Return nothing
+			return nullptr;
+		}
+		
+		// Release TLS buffer
+		tlsBuffer.release();
+	}
+	
+	// Otherwise
+	else {
+	
+		// Check if creating connection failed
+		connection = unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>(evhttp_connection_base_new(eventBase.get(), nullptr, address.c_str(), port), evhttp_connection_free);
+		if(!connection) {
+		
+			// Return nothing
+			return nullptr;
+		}
+	}
+	
+	// Set connection's timeout
+	evhttp_connection_set_timeout(connection.get(), REQUEST_TIMEOUT_SECONDS);
+	
+	// Add connection to open connections
+	connectionDestinations.emplace(connection.get(), destinationKey);
+	
+	// Set connection close callback
+	evhttp_connection_set_closecb(connection.get(), [](evhttp_connection *connection, void *argument) {
+	
+		// Get self from argument
+		HttpClient *self = reinterpret_cast<HttpClient *>(argument);
+		
+		// Check if connection's buffer event exists
+		bufferevent *bufferEvent = evhttp_connection_get_bufferevent(connection);
+		if(bufferEvent) {
+		
+			// Check if buffer event's TLS connection exists
+			SSL *tlsConnection = bufferevent_openssl_get_ssl(bufferEvent);
+			if(tlsConnection) {
+			
+				// Shutdown TLS connection
+				SSL_shutdown(tlsConnection);
+			}
+		}
+		
+		// Close connection
+		self->closeConnection(connection);
+	
+	}, this);
+	
+	// Return connection
+	return connection.release();
+}
+
+// Make request
+void HttpClient::makeRequest(evhttp_connection *connection, const bool reusingConnection, const string &destination, function<void(const bool)> &&handler) {
+
+	// Check if parsing destination failed
+	const unique_ptr<evhttp_uri, decltype(&evhttp_uri_free)> uri(evhttp_uri_parse(destination.c_str()), evhttp_uri_free);
+	if(!uri) {
+	
+		// Close connection
+		closeConnection(connection);
+		
+		// Run handler
+		handler(false);
+		
+		// Return
+		return;
+	}
+	
+	// Get destination's port and if using TLS
+	const tuple destinationInfo = getDestination(uri.get());
+	const uint16_t &port = get<1>(destinationInfo);
+	const bool &useTls = get<2>(destinationInfo);
+	
+	// Create request info
+	unique_ptr<tuple<HttpClient *, evhttp_connection *, string, bool, function<void(const bool)>>> requestInfo = make_unique<tuple<HttpClient *, evhttp_connection *, string, bool, function<void(const bool)>>>(this, connection, destination, reusingConnection, move(handler));
+	
+	// Check if creating request failed
+	unique_ptr<evhttp_request, decltype(&evhttp_request_free)> request(evhttp_request_new([](evhttp_request *request, void *argument) {
+	
+		// Get request info from argument
+		const unique_ptr<tuple<HttpClient *, evhttp_connection *, string, bool, function<void(const bool)>>> requestInfo(reinterpret_cast<tuple<HttpClient *, evhttp_connection *, string, bool, function<void(const bool)>> *>(argument));
+		
+		// Get self from request info
+		HttpClient *self = get<0>(*requestInfo);
+		
+		// Get connection from request info
+		evhttp_connection *connection = get<1>(*requestInfo);
+		
+		// Get if the request was successful
+		const bool successful = request && evhttp_request_get_response_code(request) == HTTP_OK;
+		
+		// Try
+		try {
+		
+			// Check if request was successful
+			if(successful) {
+			
+				// Check if connection's buffer event exists
+				bufferevent *bufferEvent = evhttp_connection_get_bufferevent(connection);
+				if(bufferEvent) {
+				
+					// Check if buffer event's TLS connection exists
+					SSL *tlsConnection = bufferevent_openssl_get_ssl(bufferEvent);
+					if(tlsConnection) {
+					
+						// Check if getting TLS connection's session was successful
+						unique_ptr<SSL_SESSION, decltype(&SSL_SESSION_free)> tlsSession(SSL_get1_session(tlsConnection), SSL_SESSION_free);
+						if(tlsSession && SSL_SESSION_is_resumable(tlsSession.get())) {
+						
+							// Check if connection is open
+							unordered_map<evhttp_connection *, string>::const_iterator connectionDestination = self->connectionDestinations.find(connection);
+							if(connectionDestination != self->connectionDestinations.end()) {
+							
+								// Save TLS session for the destination so that it can be resumed
+								self->saveTlsSession(connectionDestination->second, move(tlsSession));
+							}
+						}
+					}
+				}
+			}
+			
+			// Check if connection is open
+			unordered_map<evhttp_connection *, string>::const_iterator connectionDestination = self->connectionDestinations.find(connection);
+			if(connectionDestination != self->connectionDestinations.end()) {
+			
+				// Check if a response was received and the destination's idle connections aren't full
+				list<evhttp_connection *> &destinationIdleConnections = self->idleConnections[connectionDestination->second];
+				if(request && evhttp_request_get_response_code(request) && destinationIdleConnections.size() < MAXIMUM_IDLE_CONNECTIONS_PER_DESTINATION) {
+				
+					// Add connection to the destination's idle connections
+					destinationIdleConnections.push_back(connection);
+				}
+				
+				// Otherwise
+				else {
+				
+					// Close connection
+					self->closeConnection(connection);
+				}
+			}
+		}
+		
+		// Catch errors
+		catch(...) {
+		
+			// Close connection
+			self->closeConnection(connection);
+		}
+		
+		// Check if no response was received using a connection that was reused
+		if((!request || !evhttp_request_get_response_code(request)) && get<3>(*requestInfo)) {
+		
+			// Start request again since the destination may have closed the idle connection
+			self->startRequest(get<2>(*requestInfo), move(get<4>(*requestInfo)));
+		}
+		
+		// Otherwise
+		else {
+		
+			// Run handler
+			get<4>(*requestInfo)(successful);
+		}
+	
+	}, requestInfo.get()), evhttp_request_free);
+	
+	if(!request) {
+	
+		// Close connection
+		closeConnection(connection);
+		
+		// Run handler
+		get<4>(*requestInfo)(false);
+		
+		// Return
+		return;
+	}
+	
+	// Check if setting request's host header failed
+	if(!evhttp_request_get_output_headers(request.get()) || evhttp_add_header(evhttp_request_get_output_headers(request.get()), "Host", (evhttp_uri_get_host(uri.get()) + ((!useTls && port != Common::HTTP_PORT) || (useTls && port != Common::HTTPS_PORT) ? ':' + to_string(port) : "")).c_str())) {
+	
+		// Close connection
+		closeConnection(connection);
+		
+		// Run handler
+		get<4>(*requestInfo)(false);
+		
+		// Return
+		return;
+	}
+	
+	// Check if user info is provided
+	if(evhttp_uri_get_userinfo(uri.get()) && *evhttp_uri_get_userinfo(uri.get())) {
+	
+		// Check if settings request's authorization header failed
+		if(evhttp_add_header(evhttp_request_get_output_headers(request.get()), "Authorization", ("Basic " + Base64::encode(reinterpret_cast<const uint8_t *>(evhttp_uri_get_userinfo(uri.get())), strlen(evhttp_uri_get_userinfo(uri.get())))).c_str())) {
+		
+			// Close connection
+			closeConnection(connection);
+			
+			// Run handler
+			get<4>(*requestInfo)(false);
+			
+			// Return
+			return;
+		}
+	}
+	
+	// Check if making request failed
+	if(evhttp_make_request(connection, request.get(), EVHTTP_REQ_GET, (string((evhttp_uri_get_path(uri.get()) && *evhttp_uri_get_path(uri.get())) ? evhttp_uri_get_path(uri.get()) : "/") + ((evhttp_uri_get_query(uri.get()) && *evhttp_uri_get_query(uri.get())) ? string("?") + evhttp_uri_get_query(uri.get()) : "")).c_str())) {
+	
+		// Release request
+		request.release();
+		
+		// Close connection
+		closeConnection(connection);
+		
+		// Run handler
+		get<4>(*requestInfo)(false);
+		
+		// Return
+		return;
+	}
+	
+	// Release request
+	request.release();
+	
+	// Release request info
+	requestInfo.release();
+}
+
+// Close connection
+void HttpClient::closeConnection(evhttp_connection *connection) {
+
+	// Check if connection is open
+	unordered_map<evhttp_connection *, string>::iterator connectionDestination = connectionDestinations.find(connection);
+	if(connectionDestination != connectionDestinations.end()) {
+	
+		// Check if destination has idle connections
+		unordered_map<string, list<evhttp_connection *>>::iterator destinationIdleConnections = idleConnections.find(connectionDestination->second);
+		if(destinationIdleConnections != idleConnections.end()) {
+		
+			// Remove connection from the destination's idle connections
+			destinationIdleConnections->second.remove(connection);
+			
+			// Check if destination doesn't have any idle connections
+			if(destinationIdleConnections->second.empty()) {
+			
+				// Remove destination's idle connections
+				idleConnections.erase(destinationIdleConnections);
+			}
+		}
+		
+		// Remove connection from open connections
+		connectionDestinations.erase(connectionDestination);
+		
+		// Add connection to closed connections
+		closedConnections.push_back(connection);
+		
+		// Check if connection is the only closed connection
+		if(closedConnections.size() == 1) {
+		
+			// Free closed connections once the event loop is done using them
+			event_base_once(eventBase.get(), -1, EV_TIMEOUT, [](const evutil_socket_t fileDescriptor, const short signal, void *argument) {
+			
+				// Get self from argument
+				HttpClient *self = reinterpret_cast<HttpClient *>(argument);
+				
+				// Free closed connections
+				self->freeClosedConnections();
+			
+			}, this, nullptr);
+		}
+	}
+}
+
+// Free closed connections
+void HttpClient::freeClosedConnections() {
+
+	// Go through all closed connections
+	while(!closedConnections.empty()) {
+	
+		// Remove connection from closed connections
+		evhttp_connection *connection = closedConnections.front();
+		closedConnections.pop_front();
+		
+		// Free connection
+		evhttp_connection_free(connection);
+	}
+}
+
+// Cache address
+void HttpClient::cacheAddress(const string &host, const string &address) {
+
+	// Get current time
+	const chrono::steady_clock::time_point currentTime = chrono::steady_clock::now();
+	
+	// Check if host isn't cached and the DNS cache is full
+	if(!dnsCache.contains(host) && dnsCache.size() >= MAXIMUM_DNS_CACHE_SIZE) {
+	
+		// Go through all cached addresses
+		unordered_map<string, pair<string, chrono::steady_clock::time_point>>::const_iterator oldestCachedAddress = dnsCache.cend();
+		for(unordered_map<string, pair<string, chrono::steady_clock::time_point>>::const_iterator i = dnsCache.cbegin(); i != dnsCache.cend();) {
+		
+			// Check if cached address is expired
+			if(i->second.second <= currentTime) {
+			
+				// Remove cached address from the DNS cache
+				i = dnsCache.erase(i);
+			}
+			
+			// Otherwise
+			else {
+			
+				// Check if cached address is the oldest
+				if(oldestCachedAddress == dnsCache.cend() || i->second.second < oldestCachedAddress->second.second) {
+				
+					// Set oldest cached address to the cached address
+					oldestCachedAddress = i;
+				}
+				
+				// Go to next cached address
+				++i;
+			}
+		}
+		
+		// Check if DNS cache is still full
+		if(dnsCache.size() >= MAXIMUM_DNS_CACHE_SIZE) {
+		
+			// Remove oldest cached address from the DNS cache
+			dnsCache.erase(oldestCachedAddress);
+		}
+	}
+	
+	// Cache host's address
+	dnsCache.insert_or_assign(host, make_pair(address, currentTime + DNS_CACHE_TIME_TO_LIVE));
+}
+
+// Save TLS session
+void HttpClient::saveTlsSession(const string &destinationKey, unique_ptr<SSL_SESSION, decltype(&SSL_SESSION_free)> &&tlsSession) {
+
+	// Check if destination doesn't have a TLS session and the TLS sessions are full
+	if(!tlsSessions.contains(destinationKey) && tlsSessions.size() >= MAXIMUM_TLS_SESSIONS) {
+	
+		// Get current time
+		const time_t currentTime = time(nullptr);
+		
+		// Go through all TLS sessions
+		unordered_map<string, unique_ptr<SSL_SESSION, decltype(&SSL_SESSION_free)>>::const_iterator oldestTlsSession = tlsSessions.cend();
+		for(unordered_map<string, unique_ptr<SSL_SESSION, decltype(&SSL_SESSION_free)>>::const_iterator i = tlsSessions.cbegin(); i != tlsSessions.cend();) {
+		
+			// Check if TLS session is expired
+			if(SSL_SESSION_get_time(i->second.get()) + SSL_SESSION_get_timeout(i->second.get()) <= currentTime) {
+			
+				// Remove TLS session from the TLS sessions
+				i = tlsSessions.erase(i);
+			}
+			
+			// Otherwise
+			else {
+			
+				// Check if TLS session is the oldest
+				if(oldestTlsSession == tlsSessions.cend() || SSL_SESSION_get_time(i->second.get()) < SSL_SESSION_get_time(oldestTlsSession->second.get())) {
+				
+					// Set oldest TLS session to the TLS session
+					oldestTlsSession = i;
+				}
+				
+				// Go to next TLS session
+				++i;
+			}
+		}
+		
+		// Check if TLS sessions are still full
+		if(tlsSessions.size() >= MAXIMUM_TLS_SESSIONS) {
+		
+			// Remove oldest TLS session from the TLS sessions
+			tlsSessions.erase(oldestTlsSession);
+		}
+	}
+	
+	// Save TLS session for the destination
+	tlsSessions.insert_or_assign(destinationKey, move(tlsSession));
+}
+
+// Get destination
+tuple<string, uint16_t, bool> HttpClient::getDestination(const evhttp_uri *uri) {
+
+	// Check if host is to an IPv6 address
+	string host;
+	if(evhttp_uri_get_host(uri)[0] == '[' && evhttp_uri_get_host(uri)[strlen(evhttp_uri_get_host(uri)) - sizeof('\0')] == ']') {
+	
+		// Set host
+		host = string(&evhttp_uri_get_host(uri)[sizeof('[')], strlen(evhttp_uri_get_host(uri)) - sizeof('[') - sizeof(']'));
+	}
+	
+	// Otherwise
+	else {
+	
+		// Set host
+		host = evhttp_uri_get_host(uri);
+	}
+	
+	// Get if using TLS
+	const bool useTls = !strcasecmp(evhttp_uri_get_scheme(uri), "https");
+	
+	// Check if no port is specified
+	uint16_t port;
+	if(evhttp_uri_get_port(uri) == -1) {
+	
+		// Set port
+		port = useTls ? Common::HTTPS_PORT : Common::HTTP_PORT;
+	}
+	
+	// Otherwise
+	else {
+	
+		// Set port
+		port = evhttp_uri_get_port(uri);
+	}
+	
+	// Return host, port, and if using TLS
+	return {host, port, useTls};
+}
+
+// Get destination key
+string HttpClient::getDestinationKey(const tuple<string, uint16_t, bool> &destination) {
+
+	// Return destination's scheme, host, and port
+	return string(get<2>(destination) ? "https" : "http") + "://" + get<0>(destination) + ':' + to_string(get<1>(destination));
+}
@@ -0,0 +1,136 @@
+// Header guard
+#ifndef HTTP_CLIENT_H
+#define HTTP_CLIENT_H
+
+
+// Header files
+#include <chrono>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include "event2/dns.h"
+#include "event2/event.h"
+#include "event2/http.h"
+#include "openssl/ssl.h"
+
+using namespace std;
+
+
+// Classes
+
+// HTTP client class
+class HttpClient final {
+
+	// Public
+	public:
+	
+		// Constructor
+		HttpClient();
+		
+		// Destructor
+		~HttpClient();
+		
+		// Send request
+		bool sendRequest(const char *destination);
+		
+		// Send request
+		bool sendRequest(const char *destination, function<void(const bool)> &&handler);
+	
+	// Private
+	private:
+	
+		// Run
+		void run();
+		
+		// Queue request
+		void queueRequest(const string &destination, function<void(const bool)> &&handler);
+		
+		// Finish request
+		void finishRequest(const string &destinationKey);
+		
+		// Run handler
+		void runHandler(const uint64_t handlerId, const bool successful);
+		
+		// Fail handlers
+		void failHandlers();
+		
+		// Start request
+		void startRequest(const string &destination, function<void(const bool)> &&handler);
+		
+		// Create connection
+		evhttp_connection *createConnection(const string &destinationKey, const bool useTls, const string &host, const string &address, const uint16_t port);
+		
+		// Make request
+		void makeRequest(evhttp_connection *connection, const bool reusingConnection, const string &destination, function<void(const bool)> &&handler);
+		
+		// Close connection
+		void closeConnection(evhttp_connection *connection);
+		
+		// Free closed connections
+		void freeClosedConnections();
+		
+		// Cache address
+		void cacheAddress(const string &host, const string &address);
+		
+		// Save TLS session
+		void saveTlsSession(const string &destinationKey, unique_ptr<SSL_SESSION, decltype(&SSL_SESSION_free)> &&tlsSession);
+		
+		// Get destination
+		static tuple<string, uint16_t, bool> getDestination(const evhttp_uri *uri);
+		
+		// Get destination key
+		static string getDestinationKey(const tuple<string, uint16_t, bool> &destination);
+		
+		// Event base
+		unique_ptr<event_base, decltype(&event_base_free)> eventBase;
+		
+		// DNS base
+		unique_ptr<evdns_base, void(*)(evdns_base *)> dnsBase;
+		
+		// TLS context
+		unique_ptr<SSL_CTX, decltype(&SSL_CTX_free)> tlsContext;
+		
+		// DNS cache
+		unordered_map<string, pair<string, chrono::steady_clock::time_point>> dnsCache;
+		
+		// TLS sessions
+		unordered_map<string, unique_ptr<SSL_SESSION, decltype(&SSL_SESSION_free)>> tlsSessions;
+		
+		// Connection destinations
+		unordered_map<evhttp_connection *, string> connectionDestinations;
+		
+		// Idle connections
+		unordered_map<string, list<evhttp_connection *>> idleConnections;
+		
+		// Closed connections
+		list<evhttp_connection *> closedConnections;
+		
+		// Active requests
+		unordered_map<string, size_t> activeRequests;
+		
+		// Pending requests
+		unordered_map<string, list<pair<string, function<void(const bool)>>>> pendingRequests;
+		
+		// Handlers lock
+		mutex handlersLock;
+		
+		// Stopped
+		bool stopped;
+		
+		// Next handler ID
+		uint64_t nextHandlerId;
+		
+		// Handlers
+		unordered_map<uint64_t, function<void(const bool)>> handlers;
+		
+		// Main thread
+		thread mainThread;
+};
+
+
+#endif
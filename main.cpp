@@ -11,10 +11,14 @@
 #include <unistd.h>
 #include <unordered_map>
 #include <vector>
+#include "./callback_dispatcher.h"
 #include "./common.h"
 #include "event2/event.h"
 #include "./expired_monitor.h"
+#include "./http_client.h"
 #include "./node.h"
+#include "./output_precomputer.h"
+#include "./payment_proof_address_cache.h"
 #include "./payments.h"
 #include "./price.h"
 #include "./private_server.h"
@@ -46,6 +50,15 @@ static const char *DATABASE_FILE = "database.db";
 // Lock file
 static const char *LOCK_FILE = "directory.lock";
 
+// Default database synchronous
+static const char *DEFAULT_DATABASE_SYNCHRONOUS = "full";
+
+// Default database memory map size
+static const uint64_t DEFAULT_DATABASE_MEMORY_MAP_SIZE = 0;
+
+// Default database cache size
+static const uint64_t DEFAULT_DATABASE_CACHE_SIZE = 2 * Common::BYTES_IN_A_KILOBYTE;
+
 
 // Classes
 
@@ -108,6 +121,15 @@ int main(int argc, char *argv[]) {
 			// Password
 			{"password", required_argument, nullptr, 'w'},
 			
+			// Database synchronous
+			{"database_synchronous", required_argument, nullptr, 'S'},
+			
+			// Database memory map size
+			{"database_mmap_size", required_argument, nullptr, 'M'},
+			
+			// Database cache size
+			{"database_cache_size", required_argument, nullptr, 'K'},
+			
 			// "Recovery passphrase
 			{"recovery_passphrase", no_argument, nullptr, 'r'},
 			
@@ -134,6 +156,14 @@ int main(int argc, char *argv[]) {
 			{}
 		});
 		
+		// Add payments options to list
+		const vector paymentsOptions = Payments::getOptions();
+		options.insert(options.begin(), paymentsOptions.begin(), paymentsOptions.end());
+		
+		// Add output precomputer options to list
+		const vector outputPrecomputerOptions = OutputPrecomputer::getOptions();
+		options.insert(options.begin(), outputPrecomputerOptions.begin(), outputPrecomputerOptions.end());
+		
 		// Add Tor proxy options to list
 		const vector torProxyOptions = TorProxy::getOptions();
 		options.insert(options.begin(), torProxyOptions.begin(), torProxyOptions.end());
@@ -252,6 +282,71 @@ int main(int argc, char *argv[]) {
 							// Break
 							break;
 						
+						// Database synchronous
+						case 'S':
+						
+							// Check if database synchronous is invalid
+							if(!optarg || (strcmp(optarg, "off") && strcmp(optarg, "normal") && strcmp(optarg, "full") && strcmp(optarg, "extra"))) {
+							
+								// Display message
+								cout << argv[0] << ": invalid database synchronous -- '" << (optarg ? optarg : "") << '\'' << endl;
+						
+								// Display options help
+								displayOptionsHelp(argv);
+							
+								// Return failure
+								return EXIT_FAILURE;
+							}
+							
+							// Break
+							break;
+						
+						// Database memory map size
+						case 'M': {
+						
+							// Check if database memory map size is invalid
+							char *end;
+							errno = 0;
+							const unsigned long long memoryMapSize = optarg ? strtoull(optarg, &end, Common::DECIMAL_NUMBER_BASE) : 0;
+							if(!optarg || end == optarg || *end || !isdigit(optarg[0]) || (optarg[0] == '0' && isdigit(optarg[1])) || errno || memoryMapSize > static_cast<uint64_t>(numeric_limits<int64_t>::max())) {
+							
+								// Display message
+								cout << argv[0] << ": invalid database memory map size -- '" << (optarg ? optarg : "") << '\'' << endl;
+						
+								// Display options help
+								displayOptionsHelp(argv);
+							
+								// Return failure
+								return EXIT_FAILURE;
+							}
+							
+							// Break
+							break;
+						}
+						
+						// Database cache size
+						case 'K': {
+						
+							// Check if database cache size is invalid
+							char *end;
+							errno = 0;
+							const unsigned long long cacheSize = optarg ? strtoull(optarg, &end, Common::DECIMAL_NUMBER_BASE) : 0;
+							if(!optarg || end == optarg || *end || !isdigit(optarg[0]) || (optarg[0] == '0' && isdigit(optarg[1])) || errno || !cacheSize || cacheSize > static_cast<uint64_t>(numeric_limits<int32_t>::max())) {
+							
+								// Display message
+								cout << argv[0] << ": invalid database cache size -- '" << (optarg ? optarg : "") << '\'' << endl;
+						
+								// Display options help
+								displayOptionsHelp(argv);
+							
+								// Return failure
+								return EXIT_FAILURE;
+							}
+							
+							// Break
+							break;
+						}
+						
 						// Show payment
 						case 'i':
 						
@@ -272,6 +367,26 @@ int main(int argc, char *argv[]) {
 							break;
 					}
 					
+					// Check if validating payments option failed
+					if(!Payments::validateOption(option, optarg, argv)) {
+					
+						// Display options help
+						displayOptionsHelp(argv);
+					
+						// Return failure
+						return EXIT_FAILURE;
+					}
+					
+					// Check if validating output precomputer option failed
+					if(!OutputPrecomputer::validateOption(option, optarg, argv)) {
+					
+						// Display options help
+						displayOptionsHelp(argv);
+					
+						// Return failure
+						return EXIT_FAILURE;
+					}
+					
 					// Check if validating Tor proxy option failed
 					if(!TorProxy::validateOption(option, optarg, argv)) {
 					
@@ -415,6 +530,46 @@ int main(int argc, char *argv[]) {
 		// Automatically close database connection
 		static const unique_ptr<sqlite3, decltype(&sqlite3_close)> databaseConnectionUniquePointer(databaseConnection, sqlite3_close);
 		
+		// Get database synchronous from provided options
+		const char *databaseSynchronous = providedOptions.contains('S') ? providedOptions.at('S') : DEFAULT_DATABASE_SYNCHRONOUS;
+		
+		// Check if a database synchronous is provided
+		if(providedOptions.contains('S')) {
+		
+			// Display message
+			cout << "Using provided database synchronous: " << databaseSynchronous << endl;
+		}
+		
+		// Get database memory map size from provided options
+		const uint64_t databaseMemoryMapSize = providedOptions.contains('M') ? strtoull(providedOptions.at('M'), nullptr, Common::DECIMAL_NUMBER_BASE) : DEFAULT_DATABASE_MEMORY_MAP_SIZE;
+		
+		// Check if a database memory map size is provided
+		if(providedOptions.contains('M')) {
+		
+			// Display message
+			cout << "Using provided database memory map size: " << databaseMemoryMapSize << endl;
+		}
+		
+		// Get database cache size from provided options
+		const uint64_t databaseCacheSize = providedOptions.contains('K') ? strtoull(providedOptions.at('K'), nullptr, Common::DECIMAL_NUMBER_BASE) : DEFAULT_DATABASE_CACHE_SIZE;
+		
+		// Check if a database cache size is provided
+		if(providedOptions.contains('K')) {
+		
+			// Display message
+			cout << "Using provided database cache size: " << databaseCacheSize << endl;
+		}
+		
+		// Check if configuring database connection failed
+		if(sqlite3_exec(databaseConnection, ("PRAGMA journal_mode = WAL; PRAGMA synchronous = " + string(databaseSynchronous) + "; PRAGMA mmap_size = " + to_string(databaseMemoryMapSize) + "; PRAGMA cache_size = -" + to_string(databaseCacheSize) + ';').c_str(), nullptr, nullptr, nullptr) != SQLITE_OK) {
+		
+			// Display message
+			cout << "Configuring database connection failed" << endl;
+			
+			// Return failure
+			return EXIT_FAILURE;
+		}
+		
 		// Get provided password
 		const char *providedPassword = providedOptions.contains('w') ? providedOptions.at('w') : nullptr;
 		
@@ -487,7 +642,7 @@ int main(int argc, char *argv[]) {
 		#endif
 		
 		// Create payments
-		static Payments payments(databaseConnection);
+		static Payments payments(providedOptions, databaseConnection);
 		
 		// Get show completed payments from provided options
 		const bool showCompletedPayments = providedOptions.contains('l');
@@ -571,23 +726,35 @@ int main(int argc, char *argv[]) {
 			}
 		}
 		
+		// Create HTTP client
+		static HttpClient httpClient;
+		
+		// Create callback dispatcher
+		static CallbackDispatcher callbackDispatcher(payments, httpClient);
+		
 		// Create expired monitor
-		static const ExpiredMonitor expiredMonitor(payments);
+		static const ExpiredMonitor expiredMonitor(payments, httpClient);
 		
 		// Create Tor proxy
 		static const TorProxy torProxy(providedOptions, wallet);
 		
 		// Create price
-		static const Price price(providedOptions, torProxy);
+		static const Price price(providedOptions, torProxy, payments, databaseConnection);
 		
 		// Create node
-		static const Node node(providedOptions, torProxy, payments);
+		static const Node node(providedOptions, torProxy, payments, callbackDispatcher);
+		
+		// Create output precomputer
+		static OutputPrecomputer outputPrecomputer(providedOptions, wallet);
+		
+		// Create payment proof address cache
+		static PaymentProofAddressCache paymentProofAddressCache(wallet, payments);
 		
 		// Create private server
-		static const PrivateServer privateServer(providedOptions, currentDirectory, wallet, payments, price);
+		static const PrivateServer privateServer(providedOptions, currentDirectory, wallet, payments, price, outputPrecomputer, paymentProofAddressCache);
 		
 		// Create public server
-		static const PublicServer publicServer(providedOptions, currentDirectory, wallet, payments, price);
+		static const PublicServer publicServer(providedOptions, currentDirectory, wallet, payments, price, httpClient, outputPrecomputer, paymentProofAddressCache);
 		
 		// Check if creating event base failed
 		const unique_ptr<event_base, decltype(&event_base_free)> eventBase(event_base_new(), event_base_free);
@@ -718,6 +885,9 @@ void displayOptionsHelp(char *argv[]) {
 	cout << "\t-v, --version\t\t\tDisplays version information" << endl;
 	cout << "\t-d, --directory\t\t\tSets the directory to store application files (default: $HOME/" << DEFAULT_APPLICATION_DIRECTORY << ')' << endl;
 	cout << "\t-w, --password\t\t\tSets password to use for the wallet instead of being prompted for one" << endl;
+	cout << "\t-S, --database_synchronous\tSets the database's synchronous setting to off, normal, full, or extra (default: " << DEFAULT_DATABASE_SYNCHRONOUS << ')' << endl;
+	cout << "\t-M, --database_mmap_size\tSets the maximum number of bytes of the database to memory map (default: " << DEFAULT_DATABASE_MEMORY_MAP_SIZE << ')' << endl;
+	cout << "\t-K, --database_cache_size\tSets the size in kilobytes of the database's page cache (default: " << DEFAULT_DATABASE_CACHE_SIZE << ')' << endl;
 	cout << "\t-r, --recovery_passphrase\tDisplays wallet's recovery passphrase" << endl;
 	cout << "\t-u, --root_public_key\t\tDisplays wallet's root public key" << endl;
 	
@@ -732,6 +902,12 @@ void displayOptionsHelp(char *argv[]) {
 	cout << "\t-l, --show_completed_payments\tDisplays all completed payments" << endl;
 	cout << "\t-i, --show_payment\t\tDisplays the payment with a specified ID" << endl;
 	
+	// Display payments options help
+	Payments::displayOptionsHelp();
+	
+	// Display output precomputer options help
+	OutputPrecomputer::displayOptionsHelp();
+	
 	// Display Tor proxy options help
 	TorProxy::displayOptionsHelp();
 	
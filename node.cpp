@@ -32,7 +32,7 @@ static const char *STATE_FILE = "node_state.bin";
 // Supporting function implementation
 
 // Constructor
-Node::Node(const unordered_map<char, const char *> &providedOptions, const TorProxy &torProxy, Payments &payments) :
+Node::Node(const unordered_map<char, const char *> &providedOptions, const TorProxy &torProxy, Payments &payments, CallbackDispatcher &callbackDispatcher) :
 
 	// Set started
 	started(false),
@@ -41,7 +41,10 @@ Node::Node(const unordered_map<char, const char *> &providedOptions, const TorPr
 	failed(false),
 	
 	// Set payments
-	payments(payments)
+	payments(payments),
+	
+	// Set callback dispatcher
+	callbackDispatcher(callbackDispatcher)
 {
 
 	// Display message
@@ -1147,11 +1150,8 @@ bool Node::transactionHashSetOccurred(const MwcValidationNode::MerkleMountainRan
 	// Check if started
 	if(started.load()) {
 	
-		// Run pending confirmed payment callbacks
-		payments.runPendingConfirmedPaymentCallbacks();
-		
-		// Run unsuccessful completed payment callbacks
-		payments.runUnsuccessfulCompletedPaymentCallbacks();
+		// Dispatch pending callbacks
+		callbackDispatcher.dispatchPendingCallbacks();
 	}
 	
 	// Return true
@@ -1188,27 +1188,8 @@ bool Node::blockOccurred(const MwcValidationNode::Header &header, const MwcValid
 				throw runtime_error("Updating payments with reorg failed");
 			}
 			
-			// Go through all confirming payments
-			for(const tuple<uint64_t, uint64_t, uint64_t> &paymentInfo : payments.getConfirmingPayments()) {
-			
-				// Check if setting that payment is confirmed failed
-				const uint64_t &paymentId = get<0>(paymentInfo);
-				const uint64_t &paymentConfirmedHeight = get<2>(paymentInfo);
-				const uint64_t confirmations = header.getHeight() - paymentConfirmedHeight + 1;
-				if(!payments.setPaymentConfirmed(paymentId, min(confirmations, static_cast<uint64_t>(numeric_limits<uint32_t>::max())), paymentConfirmedHeight)) {
-				
-					// Throw exception
-					throw runtime_error("Setting that payment is confirmed failed");
-				}
-				
-				// Check if payment has the required number of confirmations
-				const uint64_t &paymentRequiredConfirmation = get<1>(paymentInfo);
-				if(confirmations >= paymentRequiredConfirmation) {
-				
-					// Add payment to list of completed payments
-					completedPayments.emplace_back(paymentId);
-				}
-			}
+			// Update confirming payments and add the payments that were completed to the list of completed payments
+			completedPayments = payments.updateConfirmingPayments(header.getHeight());
 			
 			// Go through all kernels in the block
 			for(const MwcValidationNode::Kernel &kernel : block.getKernels()) {
@@ -1342,11 +1323,8 @@ bool Node::blockOccurred(const MwcValidationNode::Header &header, const MwcValid
 	// Check if started
 	if(started.load()) {
 	
-		// Run pending confirmed payment callbacks
-		payments.runPendingConfirmedPaymentCallbacks();
-		
-		// Run unsuccessful completed payment callbacks
-		payments.runUnsuccessfulCompletedPaymentCallbacks();
+		// Dispatch pending callbacks
+		callbackDispatcher.dispatchPendingCallbacks();
 	}
 	
 	// Return true
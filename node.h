@@ -9,6 +9,7 @@
 #include <mutex>
 #include <unordered_map>
 #include <vector>
+#include "./callback_dispatcher.h"
 #include "./node/mwc_validation_node.h"
 #include "./payments.h"
 #include "./tor_proxy.h"
@@ -25,7 +26,7 @@ class Node final {
 	public:
 	
 		// Constructor
-		explicit Node(const unordered_map<char, const char *> &providedOptions, const TorProxy &torProxy, Payments &payments);
+		explicit Node(const unordered_map<char, const char *> &providedOptions, const TorProxy &torProxy, Payments &payments, CallbackDispatcher &callbackDispatcher);
 		
 		// Destructr
 		~Node();
@@ -69,6 +70,9 @@ class Node final {
 		// Payments
 		Payments &payments;
 		
+		// Callback dispatcher
+		CallbackDispatcher &callbackDispatcher;
+		
 		// Node
 		MwcValidationNode::Node node;
 };
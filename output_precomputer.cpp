@@ -0,0 +1,589 @@
+// Header files
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <signal.h>
+#include <sys/mman.h>
+#include <syncstream>
+#include "./common.h"
+#include "./output_precomputer.h"
+
+using namespace std;
+
+
+// Constants
+
+// Default cache size
+static const size_t DEFAULT_CACHE_SIZE = 64;
+
+// Cached output blinding factor offset
+static const size_t CACHED_OUTPUT_BLINDING_FACTOR_OFFSET = 0;
+
+// Cached output commitment offset
+static const size_t CACHED_OUTPUT_COMMITMENT_OFFSET = CACHED_OUTPUT_BLINDING_FACTOR_OFFSET + Crypto::BLINDING_FACTOR_SIZE;
+
+// Cached output bulletproof offset
+static const size_t CACHED_OUTPUT_BULLETPROOF_OFFSET = CACHED_OUTPUT_COMMITMENT_OFFSET + Crypto::COMMITMENT_SIZE;
+
+// Cached output Tor payment proof address public key offset
+static const size_t CACHED_OUTPUT_TOR_PAYMENT_PROOF_ADDRESS_PUBLIC_KEY_OFFSET = CACHED_OUTPUT_BULLETPROOF_OFFSET + Crypto::BULLETPROOF_SIZE;
+
+// Cached output size
+static const size_t CACHED_OUTPUT_SIZE = CACHED_OUTPUT_TOR_PAYMENT_PROOF_ADDRESS_PUBLIC_KEY_OFFSET + Crypto::ED25519_PUBLIC_KEY_SIZE;
+
+// No expiration
+static const chrono::time_point<chrono::steady_clock> NO_EXPIRATION = chrono::time_point<chrono::steady_clock>::max();
+
+
+// Supporting function implementation
+
+// Constructor
+OutputPrecomputer::OutputPrecomputer(const unordered_map<char, const char *> &providedOptions, const Wallet &wallet) :
+
+	// Set quit
+	quit(false),
+	
+	// Set wallet
+	wallet(wallet)
+{
+
+	// Display message
+	osyncstream(cout) << "Starting output precomputer" << endl;
+	
+	// Get cache size from provided options
+	cacheSize = providedOptions.contains('O') ? strtoul(providedOptions.at('O'), nullptr, Common::DECIMAL_NUMBER_BASE) : DEFAULT_CACHE_SIZE;
+	
+	// Check if an output precomputer cache size is provided
+	if(providedOptions.contains('O')) {
+	
+		// Display message
+		osyncstream(cout) << "Using provided output precomputer cache size: " << cacheSize << endl;
+	}
+	
+	// Check if cache is used
+	if(cacheSize) {
+	
+		// Create cache
+		cache = make_unique_for_overwrite<uint8_t[]>(cacheSize * CACHED_OUTPUT_SIZE);
+		
+		// Get requested cache size
+		const size_t requestedCacheSize = cacheSize;
+		
+		// Loop while locking cache in memory fails
+		while(mlock(cache.get(), cacheSize * CACHED_OUTPUT_SIZE)) {
+		
+			// Reduce cache size by half to fit in the locked memory limit
+			cacheSize /= 2;
+			
+			// Check if cache can't be reduced further
+			if(!cacheSize) {
+			
+				// Free cache
+				cache.reset();
+				
+				// Break
+				break;
+			}
+			
+			// Recreate cache
+			cache = make_unique_for_overwrite<uint8_t[]>(cacheSize * CACHED_OUTPUT_SIZE);
+		}
+		
+		// Check if cache size was reduced
+		if(cacheSize != requestedCacheSize) {
+		
+			// Check if cache isn't used
+			if(!cacheSize) {
+			
+				// Display message
+				osyncstream(cout) << "Locking output precomputer cache in memory failed so precomputing outputs is disabled" << endl;
+			}
+			
+			// Otherwise
+			else {
+			
+				// Display message
+				osyncstream(cout) << "Reduced output precomputer cache size to " << cacheSize << " to fit in the locked memory limit" << endl;
+			}
+		}
+	}
+	
+	// Check if cache is used
+	if(cacheSize) {
+		
+		// Go through all cache slots
+		for(size_t i = 0; i < cacheSize; ++i) {
+		
+			// Add cache slot to unused cache slots
+			unusedCacheSlots.push_back(cacheSize - i - 1);
+		}
+		
+		// Try
+		try {
+		
+			// Create main thread
+			mainThread = thread(&OutputPrecomputer::run, this);
+		}
+		
+		// Catch errors
+		catch(...) {
+		
+			// Unlock cache from memory
+			munlock(cache.get(), cacheSize * CACHED_OUTPUT_SIZE);
+			
+			// Throw exception
+			throw runtime_error("Creating output precomputer main thread failed");
+		}
+		
+		// Check if main thread is invalid
+		if(!mainThread.joinable()) {
+		
+			// Display message
+			osyncstream(cout) << "Output precomputer main thread is invalid" << endl;
+			
+			// Exit failure
+			exit(EXIT_FAILURE);
+		}
+	}
+	
+	// Display message
+	osyncstream(cout) << "Output precomputer started" << endl;
+}
+
+// Destructor
+OutputPrecomputer::~OutputPrecomputer() {
+
+	// Display message
+	osyncstream(cout) << "Closing output precomputer" << endl;
+	
+	// Check if cache is used
+	if(cacheSize) {
+	
+		// Try
+		try {
+		
+			{
+				// Lock
+				lock_guard guard(lock);
+				
+				// Set quit
+				quit.store(true);
+			}
+			
+			// Notify main thread
+			conditionVariable.notify_all();
+			
+			// Wait for main thread to finish
+			mainThread.join();
+		}
+		
+		// Catch errors
+		catch(...) {
+		
+			// Display message
+			osyncstream(cout) << "Waiting for output precomputer to finish failed" << endl;
+			
+			// Exit failure
+			exit(EXIT_FAILURE);
+		}
+		
+		// Securely clear cache
+		explicit_bzero(cache.get(), cacheSize * CACHED_OUTPUT_SIZE);
+		
+		// Unlock cache from memory
+		munlock(cache.get(), cacheSize * CACHED_OUTPUT_SIZE);
+	}
+	
+	// Display message
+	osyncstream(cout) << "Output precomputer closed" << endl;
+}
+
+// Get options
+vector<option> OutputPrecomputer::getOptions() {
+
+	// Return options
+	return {
+	
+		// Output precomputer cache size
+		{"output_cache_size", required_argument, nullptr, 'O'}
+	};
+}
+
+// Display options help
+void OutputPrecomputer::displayOptionsHelp() {
+
+	// Display message
+	cout << "\t-O, --output_cache_size\t\tSets the maximum number of outputs for payments with a price to precompute and keep in memory, or 0 to disable precomputing outputs (default: " << DEFAULT_CACHE_SIZE << ')' << endl;
+}
+
+// Validate option
+bool OutputPrecomputer::validateOption(const char option, const char *value, char *argv[]) {
+
+	// Check option
+	switch(option) {
+	
+		// Output precomputer cache size
+		case 'O': {
+		
+			// Check if output precomputer cache size is invalid
+			char *end;
+			errno = 0;
+			const unsigned long cacheSize = value ? strtoul(value, &end, Common::DECIMAL_NUMBER_BASE) : 0;
+			if(!value || end == value || *end || !isdigit(value[0]) || (value[0] == '0' && isdigit(value[1])) || errno || cacheSize > numeric_limits<uint16_t>::max()) {
+			
+				// Display message
+				cout << argv[0] << ": invalid output cache size -- '" << (value ? value : "") << '\'' << endl;
+				
+				// Return false
+				return false;
+			}
+			
+			// Break
+			break;
+		}
+	}
+	
+	// Return true
+	return true;
+}
+
+// Precompute output
+void OutputPrecomputer::precomputeOutput(const uint64_t identifierPath, const uint64_t value, const uint32_t timeout) {
+
+	// Check if cache isn't used
+	if(!cacheSize) {
+	
+		// Return
+		return;
+	}
+	
+	// Try
+	try {
+	
+		{
+			// Lock
+			lock_guard guard(lock);
+			
+			// Check if pending outputs is full
+			if(pendingOutputs.size() >= cacheSize) {
+			
+				// Remove oldest pending output
+				pendingOutputs.pop_front();
+			}
+			
+			// Add output to pending outputs
+			pendingOutputs.emplace_back(identifierPath, value, timeout ? chrono::steady_clock::now() + chrono::seconds(timeout) : NO_EXPIRATION);
+		}
+		
+		// Notify main thread
+		conditionVariable.notify_all();
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+	}
+}
+
+// Get output
+bool OutputPrecomputer::getOutput(uint8_t blindingFactor[Crypto::BLINDING_FACTOR_SIZE], uint8_t commitment[Crypto::COMMITMENT_SIZE], uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const uint64_t identifierPath, const uint64_t value) {
+
+	// Check if cache is used
+	if(cacheSize) {
+	
+		// Lock
+		lock_guard guard(lock);
+		
+		// Check if output is cached for the value
+		const unordered_map<uint64_t, tuple<uint64_t, chrono::time_point<chrono::steady_clock>, size_t, list<uint64_t>::iterator>>::iterator output = cachedOutputs.find(identifierPath);
+		if(output != cachedOutputs.end() && get<0>(output->second) == value) {
+		
+			// Get cached output
+			const uint8_t *cachedOutput = &cache[get<2>(output->second) * CACHED_OUTPUT_SIZE];
+			
+			// Set blinding factor, commitment, and bulletproof to the cached output's
+			memcpy(blindingFactor, &cachedOutput[CACHED_OUTPUT_BLINDING_FACTOR_OFFSET], Crypto::BLINDING_FACTOR_SIZE);
+			memcpy(commitment, &cachedOutput[CACHED_OUTPUT_COMMITMENT_OFFSET], Crypto::COMMITMENT_SIZE);
+			memcpy(bulletproof, &cachedOutput[CACHED_OUTPUT_BULLETPROOF_OFFSET], Crypto::BULLETPROOF_SIZE);
+			
+			// Return true
+			return true;
+		}
+	}
+	
+	// Return getting wallet's output at the identifier path for the value
+	return wallet.getOutput(blindingFactor, commitment, bulletproof, identifierPath, value);
+}
+
+// Remove received output
+void OutputPrecomputer::removeReceivedOutput(const uint64_t identifierPath) {
+
+	// Check if cache is used
+	if(cacheSize) {
+	
+		// Lock
+		lock_guard guard(lock);
+		
+		// Check if output is cached
+		const unordered_map<uint64_t, tuple<uint64_t, chrono::time_point<chrono::steady_clock>, size_t, list<uint64_t>::iterator>>::iterator output = cachedOutputs.find(identifierPath);
+		if(output != cachedOutputs.end()) {
+		
+			// Remove output since its payment was received
+			removeOutput(output);
+		}
+	}
+}
+
+// Get Tor payment proof address public key
+bool OutputPrecomputer::getTorPaymentProofAddressPublicKey(uint8_t publicKey[Crypto::ED25519_PUBLIC_KEY_SIZE], const uint64_t index) {
+
+	// Check if cache is used
+	if(cacheSize) {
+	
+		// Lock
+		lock_guard guard(lock);
+		
+		// Check if output is cached for the index
+		const unordered_map<uint64_t, tuple<uint64_t, chrono::time_point<chrono::steady_clock>, size_t, list<uint64_t>::iterator>>::const_iterator output = cachedOutputs.find(index);
+		if(output != cachedOutputs.end()) {
+		
+			// Set public key to the cached output's Tor payment proof address public key
+			memcpy(publicKey, &cache[get<2>(output->second) * CACHED_OUTPUT_SIZE + CACHED_OUTPUT_TOR_PAYMENT_PROOF_ADDRESS_PUBLIC_KEY_OFFSET], Crypto::ED25519_PUBLIC_KEY_SIZE);
+			
+			// Return true
+			return true;
+		}
+	}
+	
+	// Return getting wallet's Tor payment proof address public key at the index
+	return wallet.getTorPaymentProofAddressPublicKey(publicKey, index);
+}
+
+// Run
+void OutputPrecomputer::run() {
+
+	// Try
+	try {
+	
+		// Initialize next expiration
+		chrono::time_point<chrono::steady_clock> nextExpiration = NO_EXPIRATION;
+		
+		// Loop forever
+		while(true) {
+		
+			// Initialize identifier path
+			uint64_t identifierPath;
+			
+			// Initialize value
+			uint64_t value;
+			
+			// Initialize expires
+			chrono::time_point<chrono::steady_clock> expires;
+			
+			{
+				// Lock
+				unique_lock uniqueLock(lock);
+				
+				// Check if no cached outputs expire
+				if(nextExpiration == NO_EXPIRATION) {
+				
+					// Wait until quitting or an output is pending
+					conditionVariable.wait(uniqueLock, [this]() {
+					
+						// Return if quitting or an output is pending
+						return quit.load() || !pendingOutputs.empty();
+					});
+				}
+				
+				// Otherwise
+				else {
+				
+					// Wait until quitting, an output is pending, or the next cached output expires
+					conditionVariable.wait_until(uniqueLock, nextExpiration, [this]() {
+					
+						// Return if quitting or an output is pending
+						return quit.load() || !pendingOutputs.empty();
+					});
+				}
+				
+				// Check if quitting
+				if(quit.load()) {
+				
+					// Break
+					break;
+				}
+				
+				// Remove expired outputs and get the next expiration
+				nextExpiration = removeExpiredOutputs();
+				
+				// Check if no outputs are pending
+				if(pendingOutputs.empty()) {
+				
+					// Go to next iteration
+					continue;
+				}
+				
+				// Get oldest pending output
+				tie(identifierPath, value, expires) = pendingOutputs.front();
+				
+				// Remove oldest pending output
+				pendingOutputs.pop_front();
+				
+				// Check if output is already cached
+				if(cachedOutputs.contains(identifierPath)) {
+				
+					// Go to next iteration
+					continue;
+				}
+			}
+			
+			// Check if getting wallet's blinding factor, commitment, bulletproof, and Tor payment proof address public key for the output failed
+			uint8_t cachedOutput[CACHED_OUTPUT_SIZE];
+			if(!wallet.getOutput(&cachedOutput[CACHED_OUTPUT_BLINDING_FACTOR_OFFSET], &cachedOutput[CACHED_OUTPUT_COMMITMENT_OFFSET], &cachedOutput[CACHED_OUTPUT_BULLETPROOF_OFFSET], identifierPath, value) || !wallet.getTorPaymentProofAddressPublicKey(&cachedOutput[CACHED_OUTPUT_TOR_PAYMENT_PROOF_ADDRESS_PUBLIC_KEY_OFFSET], identifierPath)) {
+			
+				// Securely clear cached output
+				explicit_bzero(cachedOutput, sizeof(cachedOutput));
+				
+				// Go to next iteration
+				continue;
+			}
+			
+			{
+				// Lock
+				lock_guard guard(lock);
+				
+				// Check if output isn't already cached and it hasn't expired
+				if(!cachedOutputs.contains(identifierPath) && expires > chrono::steady_clock::now()) {
+				
+					// Check if no cache slots are unused
+					if(unusedCacheSlots.empty()) {
+					
+						// Remove oldest cached output
+						removeOutput(cachedOutputs.find(cachedOutputsOrder.front()));
+					}
+					
+					// Get unused cache slot
+					const size_t cacheSlot = unusedCacheSlots.back();
+					
+					// Add output to cached outputs order
+					cachedOutputsOrder.push_back(identifierPath);
+					
+					// Try
+					try {
+					
+						// Add output to cached outputs
+						cachedOutputs.emplace(identifierPath, make_tuple(value, expires, cacheSlot, prev(cachedOutputsOrder.end())));
+					}
+					
+					// Catch errors
+					catch(...) {
+					
+						// Remove output from cached outputs order
+						cachedOutputsOrder.pop_back();
+						
+						// Securely clear cached output
+						explicit_bzero(cachedOutput, sizeof(cachedOutput));
+						
+						// Throw exception
+						throw;
+					}
+					
+					// Remove cache slot from unused cache slots
+					unusedCacheSlots.pop_back();
+					
+					// Copy output to the cache slot
+					memcpy(&cache[cacheSlot * CACHED_OUTPUT_SIZE], cachedOutput, sizeof(cachedOutput));
+					
+					// Check if output expires before the next expiration
+					if(expires < nextExpiration) {
+					
+						// Set next expiration to when the output expires
+						nextExpiration = expires;
+					}
+				}
+			}
+			
+			// Securely clear cached output
+			explicit_bzero(cachedOutput, sizeof(cachedOutput));
+		}
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Display message
+		osyncstream(cout) << "Output precomputer failed for unknown reason" << endl;
+		
+		// Set error occurred
+		Common::setErrorOccurred();
+		
+		// Raise interrupt signal
+		kill(getpid(), SIGINT);
+	}
+}
+
+// Remove output
+void OutputPrecomputer::removeOutput(const unordered_map<uint64_t, tuple<uint64_t, chrono::time_point<chrono::steady_clock>, size_t, list<uint64_t>::iterator>>::iterator output) {
+
+	// Get output's cache slot
+	const size_t cacheSlot = get<2>(output->second);
+	
+	// Securely clear output's cache slot
+	explicit_bzero(&cache[cacheSlot * CACHED_OUTPUT_SIZE], CACHED_OUTPUT_SIZE);
+	
+	// Add output's cache slot to unused cache slots
+	unusedCacheSlots.push_back(cacheSlot);
+	
+	// Remove output from cached outputs order
+	cachedOutputsOrder.erase(get<3>(output->second));
+	
+	// Remove output from cached outputs
+	cachedOutputs.erase(output);
+}
+
+// Remove expired outputs
+chrono::time_point<chrono::steady_clock> OutputPrecomputer::removeExpiredOutputs() {
+
+	// Initialize next expiration
+	chrono::time_point<chrono::steady_clock> nextExpiration = NO_EXPIRATION;
+	
+	// Get current time
+	const chrono::time_point currentTime = chrono::steady_clock::now();
+	
+	// Go through all cached outputs
+	for(unordered_map<uint64_t, tuple<uint64_t, chrono::time_point<chrono::steady_clock>, size_t, list<uint64_t>::iterator>>::iterator i = cachedOutputs.begin(); i != cachedOutputs.end();) {
+	
+		// Get cached output's expires
+		const chrono::time_point<chrono::steady_clock> expires = get<1>(i->second);
+		
+		// Check if cached output expired
+		if(expires <= currentTime) {
+		
+			// Get next cached output
+			const unordered_map<uint64_t, tuple<uint64_t, chrono::time_point<chrono::steady_clock>, size_t, list<uint64_t>::iterator>>::iterator next = std::next(i);
+			
+			// Remove cached output
+			removeOutput(i);
+			
+			// Go to next cached output
+			i = next;
+		}
+		
+		// Otherwise
+		else {
+		
+			// Check if cached output expires before the next expiration
+			if(expires < nextExpiration) {
+			
+				// Set next expiration to when the cached output expires
+				nextExpiration = expires;
+			}
+			
+			// Go to next cached output
+			++i;
+		}
+	}
+	
+	// Return next expiration
+	return nextExpiration;
+}
@@ -0,0 +1,106 @@
+// Header guard
+#ifndef OUTPUT_PRECOMPUTER_H
+#define OUTPUT_PRECOMPUTER_H
+
+
+// Header files
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <getopt.h>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+#include "./crypto.h"
+#include "./wallet.h"
+
+using namespace std;
+
+
+// Classes
+
+// Output precomputer class
+class OutputPrecomputer final {
+
+	// Public
+	public:
+	
+		// Constructor
+		explicit OutputPrecomputer(const unordered_map<char, const char *> &providedOptions, const Wallet &wallet);
+		
+		// Destructor
+		~OutputPrecomputer();
+		
+		// Get options
+		static vector<option> getOptions();
+		
+		// Display options help
+		static void displayOptionsHelp();
+		
+		// Validate option
+		static bool validateOption(const char option, const char *value, char *argv[]);
+		
+		// Precompute output
+		void precomputeOutput(const uint64_t identifierPath, const uint64_t value, const uint32_t timeout);
+		
+		// Get output
+		bool getOutput(uint8_t blindingFactor[Crypto::BLINDING_FACTOR_SIZE], uint8_t commitment[Crypto::COMMITMENT_SIZE], uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const uint64_t identifierPath, const uint64_t value);
+		
+		// Remove received output
+		void removeReceivedOutput(const uint64_t identifierPath);
+		
+		// Get Tor payment proof address public key
+		bool getTorPaymentProofAddressPublicKey(uint8_t publicKey[Crypto::ED25519_PUBLIC_KEY_SIZE], const uint64_t index);
+	
+	// Private
+	private:
+	
+		// Run
+		void run();
+		
+		// Remove output
+		void removeOutput(const unordered_map<uint64_t, tuple<uint64_t, chrono::time_point<chrono::steady_clock>, size_t, list<uint64_t>::iterator>>::iterator output);
+		
+		// Remove expired outputs
+		chrono::time_point<chrono::steady_clock> removeExpiredOutputs();
+		
+		// Quit
+		atomic_bool quit;
+		
+		// Wallet
+		const Wallet &wallet;
+		
+		// Cache size
+		size_t cacheSize;
+		
+		// Cache
+		unique_ptr<uint8_t[]> cache;
+		
+		// Cached outputs
+		unordered_map<uint64_t, tuple<uint64_t, chrono::time_point<chrono::steady_clock>, size_t, list<uint64_t>::iterator>> cachedOutputs;
+		
+		// Cached outputs order
+		list<uint64_t> cachedOutputsOrder;
+		
+		// Unused cache slots
+		vector<size_t> unusedCacheSlots;
+		
+		// Pending outputs
+		list<tuple<uint64_t, uint64_t, chrono::time_point<chrono::steady_clock>>> pendingOutputs;
+		
+		// Lock
+		mutex lock;
+		
+		// Condition variable
+		condition_variable conditionVariable;
+		
+		// Main thread
+		thread mainThread;
+};
+
+
+#endif
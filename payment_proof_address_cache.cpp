@@ -0,0 +1,280 @@
+// Header files
+#include <iostream>
+#include <signal.h>
+#include <syncstream>
+#include "./common.h"
+#include "./payment_proof_address_cache.h"
+
+using namespace std;
+
+
+// Constants
+
+// Number of upcoming addresses
+static const uint64_t NUMBER_OF_UPCOMING_ADDRESSES = 32;
+
+// Maximum number of recent addresses
+static const size_t MAXIMUM_NUMBER_OF_RECENT_ADDRESSES = 1024;
+
+// No missing upcoming index
+static const uint64_t NO_MISSING_UPCOMING_INDEX = 0;
+
+
+// Supporting function implementation
+
+// Constructor
+PaymentProofAddressCache::PaymentProofAddressCache(const Wallet &wallet, Payments &payments) :
+
+	// Set quit
+	quit(false),
+	
+	// Set wallet
+	wallet(wallet),
+	
+	// Set next index
+	nextIndex(payments.getNextUniqueNumber())
+{
+
+	// Display message
+	osyncstream(cout) << "Starting payment proof address cache" << endl;
+	
+	// Try
+	try {
+	
+		// Create main thread
+		mainThread = thread(&PaymentProofAddressCache::run, this);
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Throw exception
+		throw runtime_error("Creating payment proof address cache main thread failed");
+	}
+	
+	// Check if main thread is invalid
+	if(!mainThread.joinable()) {
+	
+		// Display message
+		osyncstream(cout) << "Payment proof address cache main thread is invalid" << endl;
+		
+		// Exit failure
+		exit(EXIT_FAILURE);
+	}
+	
+	// Display message
+	osyncstream(cout) << "Payment proof address cache started" << endl;
+}
+
+// Destructor
+PaymentProofAddressCache::~PaymentProofAddressCache() {
+
+	// Display message
+	osyncstream(cout) << "Closing payment proof address cache" << endl;
+	
+	// Try
+	try {
+	
+		{
+			// Lock
+			lock_guard guard(lock);
+			
+			// Set quit
+			quit.store(true);
+		}
+		
+		// Notify main thread
+		conditionVariable.notify_all();
+		
+		// Wait for main thread to finish
+		mainThread.join();
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Display message
+		osyncstream(cout) << "Waiting for payment proof address cache to finish failed" << endl;
+		
+		// Exit failure
+		exit(EXIT_FAILURE);
+	}
+	
+	// Display message
+	osyncstream(cout) << "Payment proof address cache closed" << endl;
+}
+
+// Get Tor payment proof address
+string PaymentProofAddressCache::getTorPaymentProofAddress(const uint64_t index) {
+
+	{
+		// Lock
+		lock_guard guard(lock);
+		
+		// Check if address is a recent address
+		const unordered_map<uint64_t, pair<string, list<uint64_t>::iterator>>::iterator recentAddress = recentAddresses.find(index);
+		if(recentAddress != recentAddresses.end()) {
+		
+			// Move address to the end of the recent addresses order
+			recentAddressesOrder.splice(recentAddressesOrder.end(), recentAddressesOrder, recentAddress->second.second);
+			
+			// Return address
+			return recentAddress->second.first;
+		}
+		
+		// Check if index is at or after the next index
+		if(index >= nextIndex) {
+		
+			// Initialize address
+			string address;
+			
+			// Check if address is an upcoming address
+			const unordered_map<uint64_t, string>::iterator upcomingAddress = upcomingAddresses.find(index);
+			if(upcomingAddress != upcomingAddresses.end()) {
+			
+				// Get address from the upcoming address
+				address = move(upcomingAddress->second);
+			}
+			
+			// Set next index to after the index
+			nextIndex = index + 1;
+			
+			// Remove upcoming addresses before the next index
+			erase_if(upcomingAddresses, [this](const pair<const uint64_t, string> &upcomingAddress) {
+			
+				// Return if upcoming address is before the next index
+				return upcomingAddress.first < nextIndex;
+			});
+			
+			// Notify main thread
+			conditionVariable.notify_all();
+			
+			// Check if address was an upcoming address
+			if(!address.empty()) {
+			
+				// Add address to recent addresses
+				addRecentAddress(index, address);
+				
+				// Return address
+				return address;
+			}
+		}
+	}
+	
+	// Get wallet's Tor payment proof address at the index
+	const string address = wallet.getTorPaymentProofAddress(index);
+	
+	{
+		// Lock
+		lock_guard guard(lock);
+		
+		// Check if address isn't a recent address
+		if(!recentAddresses.contains(index)) {
+		
+			// Add address to recent addresses
+			addRecentAddress(index, address);
+		}
+	}
+	
+	// Return address
+	return address;
+}
+
+// Run
+void PaymentProofAddressCache::run() {
+
+	// Try
+	try {
+	
+		// Loop forever
+		while(true) {
+		
+			// Initialize index
+			uint64_t index;
+			
+			{
+				// Lock
+				unique_lock uniqueLock(lock);
+				
+				// Wait until quitting or an upcoming address is missing
+				conditionVariable.wait(uniqueLock, [this, &index]() {
+				
+					// Get next missing upcoming index
+					index = getNextMissingUpcomingIndex();
+					
+					// Return if quitting or an upcoming address is missing
+					return quit.load() || index != NO_MISSING_UPCOMING_INDEX;
+				});
+				
+				// Check if quitting
+				if(quit.load()) {
+				
+					// Break
+					break;
+				}
+			}
+			
+			// Get wallet's Tor payment proof address at the index
+			string address = wallet.getTorPaymentProofAddress(index);
+			
+			{
+				// Lock
+				lock_guard guard(lock);
+				
+				// Check if index is still upcoming
+				if(index >= nextIndex && index - nextIndex < NUMBER_OF_UPCOMING_ADDRESSES) {
+				
+					// Add address to upcoming addresses
+					upcomingAddresses.emplace(index, move(address));
+				}
+			}
+		}
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Display message
+		osyncstream(cout) << "Payment proof address cache failed for unknown reason" << endl;
+		
+		// Set error occurred
+		Common::setErrorOccurred();
+		
+		// Raise interrupt signal
+		kill(getpid(), SIGINT);
+	}
+}
+
+// Get next missing upcoming index
+uint64_t PaymentProofAddressCache::getNextMissingUpcomingIndex() const {
+
+	// Go through all upcoming indices
+	for(uint64_t i = 0; i < NUMBER_OF_UPCOMING_ADDRESSES; ++i) {
+	
+		// Check if upcoming index's address is missing
+		if(!upcomingAddresses.contains(nextIndex + i)) {
+		
+			// Return upcoming index
+			return nextIndex + i;
+		}
+	}
+	
+	// Return no missing upcoming index
+	return NO_MISSING_UPCOMING_INDEX;
+}
+
+// Add recent address
+void PaymentProofAddressCache::addRecentAddress(const uint64_t index, const string &address) {
+
+	// Check if recent addresses is full
+	if(recentAddresses.size() >= MAXIMUM_NUMBER_OF_RECENT_ADDRESSES) {
+	
+		// Remove least recently used address from recent addresses
+		recentAddresses.erase(recentAddressesOrder.front());
+		recentAddressesOrder.pop_front();
+	}
+	
+	// Add address to recent addresses
+	recentAddressesOrder.push_back(index);
+	recentAddresses.emplace(index, make_pair(address, prev(recentAddressesOrder.end())));
+}
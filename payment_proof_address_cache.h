@@ -0,0 +1,78 @@
+// Header guard
+#ifndef PAYMENT_PROOF_ADDRESS_CACHE_H
+#define PAYMENT_PROOF_ADDRESS_CACHE_H
+
+
+// Header files
+#include <atomic>
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include "./payments.h"
+#include "./wallet.h"
+
+using namespace std;
+
+
+// Classes
+
+// Payment proof address cache class
+class PaymentProofAddressCache final {
+
+	// Public
+	public:
+	
+		// Constructor
+		explicit PaymentProofAddressCache(const Wallet &wallet, Payments &payments);
+		
+		// Destructor
+		~PaymentProofAddressCache();
+		
+		// Get Tor payment proof address
+		string getTorPaymentProofAddress(const uint64_t index);
+	
+	// Private
+	private:
+	
+		// Run
+		void run();
+		
+		// Get next missing upcoming index
+		uint64_t getNextMissingUpcomingIndex() const;
+		
+		// Add recent address
+		void addRecentAddress(const uint64_t index, const string &address);
+		
+		// Quit
+		atomic_bool quit;
+		
+		// Wallet
+		const Wallet &wallet;
+		
+		// Next index
+		uint64_t nextIndex;
+		
+		// Upcoming addresses
+		unordered_map<uint64_t, string> upcomingAddresses;
+		
+		// Recent addresses
+		unordered_map<uint64_t, pair<string, list<uint64_t>::iterator>> recentAddresses;
+		
+		// Recent addresses order
+		list<uint64_t> recentAddressesOrder;
+		
+		// Lock
+		mutex lock;
+		
+		// Condition variable
+		condition_variable conditionVariable;
+		
+		// Main thread
+		thread mainThread;
+};
+
+
+#endif
@@ -1,9 +1,13 @@
 // Header files
+#include <cctype>
+#include <chrono>
 #include <cstring>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <memory>
 #include <syncstream>
+#include <thread>
 #include "./common.h"
 #include "./consensus.h"
 #include "./payments.h"
@@ -53,16 +57,44 @@ const size_t Payments::MAXIMUM_NOTES_SIZE = 1 * Common::BYTES_IN_A_KILOBYTE;
 // No notes
 const char *Payments::NO_NOTES = nullptr;
 
+// Callback retry initial delay
+static const uint64_t CALLBACK_RETRY_INITIAL_DELAY = 1 * Common::SECONDS_IN_A_MINUTE;
+
+// Default callback retry maximum delay
+static const uint64_t DEFAULT_CALLBACK_RETRY_MAXIMUM_DELAY = 1 * Common::MINUTES_IN_AN_HOUR * Common::SECONDS_IN_A_MINUTE;
+
+// Callback retry maximum backoff exponent
+static const uint64_t CALLBACK_RETRY_MAXIMUM_BACKOFF_EXPONENT = 32;
+
+// Expired callback recheck delay
+static const uint64_t EXPIRED_CALLBACK_RECHECK_DELAY = 1;
+
 
 // Supporting function implementation
 
 // Constructor
-Payments::Payments(sqlite3 *databaseConnection) :
+Payments::Payments(const unordered_map<char, const char *> &providedOptions, sqlite3 *databaseConnection) :
 
 	// Set database connection
-	databaseConnection(databaseConnection)
+	databaseConnection(databaseConnection),
+	
+	// Set maximum confirmed height
+	maximumConfirmedHeight(numeric_limits<uint64_t>::max()),
+	
+	// Set next payment change sequence to the current time in microseconds so sequences from a previous run are older than the oldest payment change
+	nextPaymentChangeSequence(chrono::duration_cast<chrono::microseconds>(chrono::system_clock::now().time_since_epoch()).count())
 {
 
+	// Get callback retry maximum delay from provided options
+	callbackRetryMaximumDelay = providedOptions.contains('C') ? strtoull(providedOptions.at('C'), nullptr, Common::DECIMAL_NUMBER_BASE) : DEFAULT_CALLBACK_RETRY_MAXIMUM_DELAY;
+	
+	// Check if a callback retry maximum delay is provided
+	if(providedOptions.contains('C')) {
+	
+		// Display message
+		osyncstream(cout) << "Using provided callback retry maximum delay: " << callbackRetryMaximumDelay << endl;
+	}
+
 	// Check if creating payments table in the database failed
 	if(sqlite3_exec(databaseConnection, ("CREATE TABLE IF NOT EXISTS \"Payments\" ("
 	
@@ -145,7 +177,13 @@ Payments::Payments(sqlite3 *databaseConnection) :
 		"\"Currency Price\" TEXT NULL DEFAULT(NULL) CHECK(\"Currency Price\" IS NULL OR (\"Price\" IS NOT NULL AND \"Currency Price\" != '')),"
 		
 		// Notes (Merchant provided notes)
-		"\"Notes\" TEXT NULL DEFAULT(NULL) CHECK(\"Notes\" IS NULL OR \"Notes\" != '')"
+		"\"Notes\" TEXT NULL DEFAULT(NULL) CHECK(\"Notes\" IS NULL OR \"Notes\" != ''),"
+		
+		// Callback attempts (Number of failed completed or expired callback requests)
+		"\"Callback Attempts\" INTEGER NOT NULL DEFAULT(0) CHECK(\"Callback Attempts\" >= 0),"
+		
+		// Next callback attempt (Timestamp when the completed or expired callback request can be retried)
+		"\"Next Callback Attempt\" INTEGER NOT NULL DEFAULT(0) CHECK(\"Next Callback Attempt\" >= 0)"
 		
 	") STRICT;").c_str(), nullptr, nullptr, nullptr) != SQLITE_OK) {
 	
@@ -392,6 +430,66 @@ Payments::Payments(sqlite3 *databaseConnection) :
 			throw runtime_error("Adding notes column to payments table in the database failed");
 		}
 	}
+
+	// Check if getting if callback attempts column exists in the payments table in the database failed
+	bool callbackAttemptsColumnExists;
+	if(sqlite3_exec(databaseConnection, "SELECT COUNT() > 0 FROM pragma_table_info(\"Payments\") WHERE \"name\"='Callback Attempts';", [](void *argument, int numberOfRows, char **rows, char **columnNames) -> int {
+	
+		// Get callback attempts column exists from argument
+		bool *callbackAttemptsColumnExists = reinterpret_cast<bool *>(argument);
+		
+		// Set callback attempts column exists
+		*callbackAttemptsColumnExists = numberOfRows && !strcmp(rows[0], "1");
+		
+		// Return success
+		return 0;
+		
+	}, &callbackAttemptsColumnExists, nullptr) != SQLITE_OK) {
+	
+		// Throw exception
+		throw runtime_error("Getting if callback attempts column exists in the payments table in the database failed");
+	}
+	
+	// Check if callback attempts column doesn't exist
+	if(!callbackAttemptsColumnExists) {
+	
+		// Check if adding callback attempts column to payments table in the database failed
+		if(sqlite3_exec(databaseConnection, "ALTER TABLE \"Payments\" ADD COLUMN \"Callback Attempts\" INTEGER NOT NULL DEFAULT(0) CHECK(\"Callback Attempts\" >= 0);", nullptr, nullptr, nullptr) != SQLITE_OK) {
+		
+			// Throw exception
+			throw runtime_error("Adding callback attempts column to payments table in the database failed");
+		}
+	}
+
+	// Check if getting if next callback attempt column exists in the payments table in the database failed
+	bool nextCallbackAttemptColumnExists;
+	if(sqlite3_exec(databaseConnection, "SELECT COUNT() > 0 FROM pragma_table_info(\"Payments\") WHERE \"name\"='Next Callback Attempt';", [](void *argument, int numberOfRows, char **rows, char **columnNames) -> int {
+	
+		// Get next callback attempt column exists from argument
+		bool *nextCallbackAttemptColumnExists = reinterpret_cast<bool *>(argument);
+		
+		// Set next callback attempt column exists
+		*nextCallbackAttemptColumnExists = numberOfRows && !strcmp(rows[0], "1");
+		
+		// Return success
+		return 0;
+		
+	}, &nextCallbackAttemptColumnExists, nullptr) != SQLITE_OK) {
+	
+		// Throw exception
+		throw runtime_error("Getting if next callback attempt column exists in the payments table in the database failed");
+	}
+	
+	// Check if next callback attempt column doesn't exist
+	if(!nextCallbackAttemptColumnExists) {
+	
+		// Check if adding next callback attempt column to payments table in the database failed
+		if(sqlite3_exec(databaseConnection, "ALTER TABLE \"Payments\" ADD COLUMN \"Next Callback Attempt\" INTEGER NOT NULL DEFAULT(0) CHECK(\"Next Callback Attempt\" >= 0);", nullptr, nullptr, nullptr) != SQLITE_OK) {
+		
+			// Throw exception
+			throw runtime_error("Adding next callback attempt column to payments table in the database failed");
+		}
+	}
 	
 	// Check if creating triggers in the database failed
 	if(sqlite3_exec(databaseConnection, ""
@@ -515,6 +613,11 @@ Payments::Payments(sqlite3 *databaseConnection) :
 		"CREATE TRIGGER IF NOT EXISTS \"Payments Keep Notes Trigger\" BEFORE UPDATE OF \"Notes\" ON \"Payments\" BEGIN "
 			"SELECT RAISE(ABORT, 'notes can''t change');"
 		"END;"
+		
+		// Require default callback attempts trigger
+		"CREATE TRIGGER IF NOT EXISTS \"Payments Require Default Callback Attempts Trigger\" BEFORE INSERT ON \"Payments\" FOR EACH ROW WHEN NEW.\"Callback Attempts\" != 0 OR NEW.\"Next Callback Attempt\" != 0 BEGIN "
+			"SELECT RAISE(ABORT, 'default callback attempts is required');"
+		"END;"
 	
 	"", nullptr, nullptr, nullptr) != SQLITE_OK) {
 	
@@ -534,8 +637,11 @@ Payments::Payments(sqlite3 *databaseConnection) :
 		// Confirming index
 		"CREATE INDEX IF NOT EXISTS \"Payments Confirming Index\" ON \"Payments\" (\"Completed\", \"Confirmed Height\") WHERE \"Completed\" IS NULL AND \"Confirmed Height\" IS NOT NULL;"
 		
-		// Unsuccessful completed callback index
-		"CREATE INDEX IF NOT EXISTS \"Payments Unsuccessful Completed Callback Index\" ON \"Payments\" (\"Completed\", \"Completed Callback Successful\") WHERE \"Completed\" IS NOT NULL AND \"Completed Callback Successful\" = FALSE;"
+		// Remove unsuccessful completed callback index
+		"DROP INDEX IF EXISTS \"Payments Unsuccessful Completed Callback Index\";"
+		
+		// Unsuccessful completed callback index 2
+		"CREATE INDEX IF NOT EXISTS \"Payments Unsuccessful Completed Callback Index 2\" ON \"Payments\" (\"Next Callback Attempt\") WHERE \"Completed\" IS NOT NULL AND \"Completed Callback Successful\" = FALSE;"
 		
 		// Pending confirmed callback index
 		"CREATE INDEX IF NOT EXISTS \"Payments Pending Confirmed Callback Index\" ON \"Payments\" (\"Confirmed Callback\", \"Confirmations Changed\") WHERE \"Confirmed Callback\" IS NOT NULL AND \"Confirmations Changed\" = TRUE;"
@@ -543,8 +649,20 @@ Payments::Payments(sqlite3 *databaseConnection) :
 		// Remove unsuccessful expired callback index
 		"DROP INDEX IF EXISTS \"Payments Unsuccessful Expired Callback Index\";"
 		
-		// Unsuccessful expired callback index 2
-		"CREATE INDEX IF NOT EXISTS \"Payments Unsuccessful Expired Callback Index 2\" ON \"Payments\" (\"Received\", \"Expired Callback\", \"Expired Callback Successful\", \"Expires\") WHERE \"Received\" IS NULL AND \"Expired Callback Successful\" = FALSE AND \"Expires\" IS NOT NULL;"
+		// Remove unsuccessful expired callback index 2
+		"DROP INDEX IF EXISTS \"Payments Unsuccessful Expired Callback Index 2\";"
+		
+		// Unsuccessful expired callback index 3
+		"CREATE INDEX IF NOT EXISTS \"Payments Unsuccessful Expired Callback Index 3\" ON \"Payments\" (\"Next Callback Attempt\", \"Expires\") WHERE \"Received\" IS NULL AND \"Expired Callback Successful\" = FALSE AND \"Expires\" IS NOT NULL;"
+		
+		// Not received list index
+		"CREATE INDEX IF NOT EXISTS \"Payments Not Received List Index\" ON \"Payments\" (\"Unique Number\") WHERE \"Received\" IS NULL;"
+		
+		// Incomplete list index
+		"CREATE INDEX IF NOT EXISTS \"Payments Incomplete List Index\" ON \"Payments\" (\"Unique Number\") WHERE \"Completed\" IS NULL AND \"Received\" IS NOT NULL;"
+		
+		// Completed list index
+		"CREATE INDEX IF NOT EXISTS \"Payments Completed List Index\" ON \"Payments\" (\"Unique Number\") WHERE \"Completed\" IS NOT NULL;"
 	
 	"", nullptr, nullptr, nullptr) != SQLITE_OK) {
 	
@@ -563,7 +681,7 @@ Payments::Payments(sqlite3 *databaseConnection) :
 	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> createPaymentStatementUniquePointer(createPaymentStatement, sqlite3_finalize);
 	
 	// Check if preparing create payment with expiration statement failed
-	if(sqlite3_prepare_v3(databaseConnection, "INSERT INTO \"Payments\" (\"ID\", \"URL\", \"Price\", \"Required Confirmations\", \"Expires\", \"Completed Callback\", \"Received Callback\", \"Confirmed Callback\", \"Expired Callback\", \"Has Price\", \"Currency Price\", \"Notes\") VALUES (?, ?, ?, ?, UNIXEPOCH('now') + ?, ?, ?, ?, ?, IIF(?3 IS NULL, FALSE, TRUE), ?, ?);", -1, SQLITE_PREPARE_PERSISTENT, &createPaymentWithExpirationStatement, nullptr) != SQLITE_OK) {
+	if(sqlite3_prepare_v3(databaseConnection, "INSERT INTO \"Payments\" (\"ID\", \"URL\", \"Price\", \"Required Confirmations\", \"Expires\", \"Completed Callback\", \"Received Callback\", \"Confirmed Callback\", \"Expired Callback\", \"Has Price\", \"Currency Price\", \"Notes\") VALUES (?, ?, ?, ?, UNIXEPOCH('now') + ?, ?, ?, ?, ?, IIF(?3 IS NULL, FALSE, TRUE), ?, ?) RETURNING \"Expires\";", -1, SQLITE_PREPARE_PERSISTENT, &createPaymentWithExpirationStatement, nullptr) != SQLITE_OK) {
 	
 		// Throw exception
 		throw runtime_error("Preparing create payment with expiration statement failed");
@@ -572,26 +690,6 @@ Payments::Payments(sqlite3 *databaseConnection) :
 	// Automatically free create payment with expiration statement
 	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> createPaymentWithExpirationStatementUniquePointer(createPaymentWithExpirationStatement, sqlite3_finalize);
 	
-	// Check if preparing get payment info statement failed
-	if(sqlite3_prepare_v3(databaseConnection, "SELECT \"Unique Number\", \"URL\", \"Price\", \"Required Confirmations\", \"Received\", \"Confirmations\", IIF(\"Expires\" IS NULL, NULL, MAX(\"Expires\" - UNIXEPOCH('now'), 0)) AS \"Time Remaining\", IIF(\"Received\" IS NULL AND \"Expires\" IS NOT NULL AND \"Expires\" <= UNIXEPOCH('now'), 'Expired', IIF(\"Received\" IS NULL, 'Not received', IIF(\"Confirmations\" = 0, 'Received', IIF(\"Completed\" IS NULL, 'Confirmed', 'Completed')))) AS \"Status\" FROM \"Payments\" WHERE \"ID\" = ?;", -1, SQLITE_PREPARE_PERSISTENT, &getPaymentInfoStatement, nullptr) != SQLITE_OK) {
-	
-		// Throw exception
-		throw runtime_error("Preparing get payment info statement failed");
-	}
-	
-	// Automatically free get payment info statement
-	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> getPaymentInfoStatementUniquePointer(getPaymentInfoStatement, sqlite3_finalize);
-	
-	// Check if preparing get payment price statement failed
-	if(sqlite3_prepare_v3(databaseConnection, "SELECT \"Unique Number\", IIF(\"Has Price\" = TRUE, \"Price\", NULL) AS \"Initial Price\" FROM \"Payments\" WHERE \"URL\" = ?;", -1, SQLITE_PREPARE_PERSISTENT, &getPaymentPriceStatement, nullptr) != SQLITE_OK) {
-	
-		// Throw exception
-		throw runtime_error("Preparing get payment price statement failed");
-	}
-	
-	// Automatically free get payment price statement
-	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> getPaymentPriceStatementUniquePointer(getPaymentPriceStatement, sqlite3_finalize);
-	
 	// Check if preparing get receiving payment for URL statement failed
 	if(sqlite3_prepare_v3(databaseConnection, "SELECT \"Unique Number\", \"ID\", \"Price\", \"Received Callback\", \"Currency Price\" FROM \"Payments\" WHERE \"URL\" = ? AND \"Received\" IS NULL AND (\"Expires\" IS NULL OR \"Expires\" > UNIXEPOCH('now'));", -1, SQLITE_PREPARE_PERSISTENT, &getReceivingPaymentForUrlStatement, nullptr) != SQLITE_OK) {
 	
@@ -602,26 +700,6 @@ Payments::Payments(sqlite3 *databaseConnection) :
 	// Automatically free get receiving payment for URL statement
 	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> getReceivingPaymentForUrlStatementUniquePointer(getReceivingPaymentForUrlStatement, sqlite3_finalize);
 	
-	// Check if preparing get completed payments statement failed
-	if(sqlite3_prepare_v3(databaseConnection, "SELECT \"Unique Number\", \"ID\", \"URL\", \"Created\", \"Completed\", \"Price\", \"Required Confirmations\", \"Expires\", \"Received\", \"Completed Callback\", \"Completed Callback Successful\", \"Sender Payment Proof Address\", \"Kernel Commitment\", \"Confirmed Height\", \"Received Callback\", \"Confirmed Callback\", \"Expired Callback\", \"Expired Callback Successful\", \"Currency Price\", \"Notes\" FROM \"Payments\" WHERE \"Completed\" IS NOT NULL ORDER BY \"Completed\" ASC;", -1, 0, &getCompletedPaymentsStatement, nullptr) != SQLITE_OK) {
-	
-		// Throw exception
-		throw runtime_error("Preparing get completed payments statement failed");
-	}
-	
-	// Automatically free get completed payments statement
-	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> getCompletedPaymentsStatementUniquePointer(getCompletedPaymentsStatement, sqlite3_finalize);
-	
-	// Check if preparing get payment statement failed
-	if(sqlite3_prepare_v3(databaseConnection, "SELECT \"Unique Number\", \"URL\", \"Created\", \"Completed\", \"Price\", \"Required Confirmations\", \"Expires\", \"Received\", \"Completed Callback\", \"Completed Callback Successful\", \"Sender Payment Proof Address\", \"Kernel Commitment\", \"Confirmed Height\", \"Received Callback\", \"Confirmed Callback\", \"Expired Callback\", \"Expired Callback Successful\", \"Currency Price\", \"Notes\", IIF(\"Received\" IS NULL AND \"Expires\" IS NOT NULL AND \"Expires\" <= UNIXEPOCH('now'), 'Expired', IIF(\"Received\" IS NULL, 'Not received', IIF(\"Confirmations\" = 0, 'Received', IIF(\"Completed\" IS NULL, 'Confirmed', 'Completed')))) AS \"Status\" FROM \"Payments\" WHERE \"ID\" = ?;", -1, 0, &getPaymentStatement, nullptr) != SQLITE_OK) {
-	
-		// Throw exception
-		throw runtime_error("Preparing get payment statement failed");
-	}
-	
-	// Automatically free get payment statement
-	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> getPaymentStatementUniquePointer(getPaymentStatement, sqlite3_finalize);
-	
 	// Check if preparing get unconfirmed payment statement failed
 	if(sqlite3_prepare_v3(databaseConnection, "SELECT \"Unique Number\", \"ID\", \"Required Confirmations\", \"Sender Public Blind Excess\", \"Recipient Partial Signature\", \"Public Nonce Sum\", \"Kernel Data\" FROM \"Payments\" WHERE \"Kernel Commitment\" = ? AND \"Confirmed Height\" IS NULL;", -1, SQLITE_PREPARE_PERSISTENT, &getUnconfirmedPaymentStatement, nullptr) != SQLITE_OK) {
 	
@@ -642,18 +720,28 @@ Payments::Payments(sqlite3 *databaseConnection) :
 	// Automatically free get incomplete payments statement
 	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> getIncompletePaymentsStatementUniquePointer(getIncompletePaymentsStatement, sqlite3_finalize);
 	
-	// Check if preparing get confirming payments statement failed
-	if(sqlite3_prepare_v3(databaseConnection, "SELECT \"ID\", \"Required Confirmations\", \"Confirmed Height\" FROM \"Payments\" WHERE \"Completed\" IS NULL AND \"Confirmed Height\" IS NOT NULL;", -1, SQLITE_PREPARE_PERSISTENT, &getConfirmingPaymentsStatement, nullptr) != SQLITE_OK) {
+	// Check if preparing update confirming payments statement failed
+	if(sqlite3_prepare_v3(databaseConnection, "UPDATE \"Payments\" SET \"Confirmations\" = MIN(?1 - \"Confirmed Height\" + 1, \"Required Confirmations\"), \"Completed\" = IIF(?1 - \"Confirmed Height\" + 1 >= \"Required Confirmations\", UNIXEPOCH('now'), NULL), \"Confirmations Changed\" = IIF(?1 - \"Confirmed Height\" + 1 >= \"Required Confirmations\", FALSE, TRUE) WHERE \"Completed\" IS NULL AND \"Confirmed Height\" IS NOT NULL AND \"Confirmed Height\" <= ?1 AND \"Confirmations\" != MIN(?1 - \"Confirmed Height\" + 1, \"Required Confirmations\") RETURNING \"ID\", \"Completed\" IS NOT NULL, \"Confirmations\";", -1, SQLITE_PREPARE_PERSISTENT, &updateConfirmingPaymentsStatement, nullptr) != SQLITE_OK) {
 	
 		// Throw exception
-		throw runtime_error("Preparing get confirming payments statement failed");
+		throw runtime_error("Preparing update confirming payments statement failed");
 	}
 	
-	// Automatically free get confirming payments statement
-	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> getConfirmingPaymentsStatementUniquePointer(getConfirmingPaymentsStatement, sqlite3_finalize);
+	// Automatically free update confirming payments statement
+	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> updateConfirmingPaymentsStatementUniquePointer(updateConfirmingPaymentsStatement, sqlite3_finalize);
+	
+	// Check if preparing get unconfirmed kernel commitments statement failed
+	if(sqlite3_prepare_v3(databaseConnection, "SELECT \"Kernel Commitment\" FROM \"Payments\" WHERE \"Completed\" IS NULL AND \"Received\" IS NOT NULL AND \"Confirmed Height\" IS NULL;", -1, SQLITE_PREPARE_PERSISTENT, &getUnconfirmedKernelCommitmentsStatement, nullptr) != SQLITE_OK) {
+	
+		// Throw exception
+		throw runtime_error("Preparing get unconfirmed kernel commitments statement failed");
+	}
+	
+	// Automatically free get unconfirmed kernel commitments statement
+	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> getUnconfirmedKernelCommitmentsStatementUniquePointer(getUnconfirmedKernelCommitmentsStatement, sqlite3_finalize);
 	
 	// Check if preparing get unsuccessful completed callback payments statement
-	if(sqlite3_prepare_v3(databaseConnection, "SELECT \"ID\", \"Completed\", \"Received\", \"Completed Callback\" FROM \"Payments\" WHERE \"Completed\" IS NOT NULL AND \"Completed Callback Successful\" = FALSE;", -1, SQLITE_PREPARE_PERSISTENT, &getUnsuccessfulCompletedCallbackPaymentsStatement, nullptr) != SQLITE_OK) {
+	if(sqlite3_prepare_v3(databaseConnection, "SELECT \"ID\", \"Completed\", \"Received\", \"Completed Callback\" FROM \"Payments\" WHERE \"Completed\" IS NOT NULL AND \"Completed Callback Successful\" = FALSE AND \"Next Callback Attempt\" <= UNIXEPOCH('now');", -1, SQLITE_PREPARE_PERSISTENT, &getUnsuccessfulCompletedCallbackPaymentsStatement, nullptr) != SQLITE_OK) {
 	
 		// Throw exception
 		throw runtime_error("Preparing get unsuccessful completed callback payments statement failed");
@@ -662,6 +750,16 @@ Payments::Payments(sqlite3 *databaseConnection) :
 	// Automatically free get unsuccessful completed callback payments statement
 	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> getUnsuccessfulCompletedCallbackPaymentsStatementUniquePointer(getUnsuccessfulCompletedCallbackPaymentsStatement, sqlite3_finalize);
 	
+	// Check if preparing get next completed callback attempt statement
+	if(sqlite3_prepare_v3(databaseConnection, "SELECT MIN(\"Next Callback Attempt\") FROM \"Payments\" WHERE \"Completed\" IS NOT NULL AND \"Completed Callback Successful\" = FALSE AND \"Next Callback Attempt\" > ?;", -1, SQLITE_PREPARE_PERSISTENT, &getNextCompletedCallbackAttemptStatement, nullptr) != SQLITE_OK) {
+	
+		// Throw exception
+		throw runtime_error("Preparing get next completed callback attempt statement failed");
+	}
+	
+	// Automatically free get next completed callback attempt statement
+	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> getNextCompletedCallbackAttemptStatementUniquePointer(getNextCompletedCallbackAttemptStatement, sqlite3_finalize);
+	
 	// Check if preparing get pending confirmed callback payments statement
 	if(sqlite3_prepare_v3(databaseConnection, "SELECT \"ID\", \"Confirmations\", \"Confirmed Callback\" FROM \"Payments\" WHERE \"Confirmed Callback\" IS NOT NULL AND \"Confirmations Changed\" = TRUE;", -1, SQLITE_PREPARE_PERSISTENT, &getPendingConfirmedCallbackPaymentsStatement, nullptr) != SQLITE_OK) {
 	
@@ -673,7 +771,7 @@ Payments::Payments(sqlite3 *databaseConnection) :
 	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> getPendingConfirmedCallbackPaymentsStatementUniquePointer(getPendingConfirmedCallbackPaymentsStatement, sqlite3_finalize);
 	
 	// Check if preparing get unsuccessful expired callback payments statement
-	if(sqlite3_prepare_v3(databaseConnection, "SELECT \"ID\", \"Expired Callback\" FROM \"Payments\" WHERE \"Received\" IS NULL AND \"Expired Callback Successful\" = FALSE AND \"Expires\" IS NOT NULL AND \"Expires\" <= UNIXEPOCH('now');", -1, SQLITE_PREPARE_PERSISTENT, &getUnsuccessfulExpiredCallbackPaymentsStatement, nullptr) != SQLITE_OK) {
+	if(sqlite3_prepare_v3(databaseConnection, "SELECT \"ID\", \"Expired Callback\" FROM \"Payments\" WHERE \"Received\" IS NULL AND \"Expired Callback Successful\" = FALSE AND \"Expires\" IS NOT NULL AND \"Expires\" <= UNIXEPOCH('now') AND \"Next Callback Attempt\" <= UNIXEPOCH('now');", -1, SQLITE_PREPARE_PERSISTENT, &getUnsuccessfulExpiredCallbackPaymentsStatement, nullptr) != SQLITE_OK) {
 	
 		// Throw exception
 		throw runtime_error("Preparing get unsuccessful expired callback payments statement failed");
@@ -683,7 +781,7 @@ Payments::Payments(sqlite3 *databaseConnection) :
 	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> getUnsuccessfulExpiredCallbackPaymentsStatementUniquePointer(getUnsuccessfulExpiredCallbackPaymentsStatement, sqlite3_finalize);
 	
 	// Check if preparing set payment received statement failed
-	if(sqlite3_prepare_v3(databaseConnection, "UPDATE \"Payments\" SET \"Price\" = ?, \"Received\" = UNIXEPOCH('now'), \"Sender Payment Proof Address\" = ?, \"Kernel Commitment\" = ?, \"Sender Public Blind Excess\" = ?, \"Recipient Partial Signature\" = ?, \"Public Nonce Sum\" = ?, \"Kernel Data\" = ?, \"Currency Price\" = ? WHERE \"ID\" = ?;", -1, SQLITE_PREPARE_PERSISTENT, &setPaymentReceivedStatement, nullptr) != SQLITE_OK) {
+	if(sqlite3_prepare_v3(databaseConnection, "UPDATE \"Payments\" SET \"Price\" = ?, \"Received\" = UNIXEPOCH('now'), \"Sender Payment Proof Address\" = ?, \"Kernel Commitment\" = ?, \"Sender Public Blind Excess\" = ?, \"Recipient Partial Signature\" = ?, \"Public Nonce Sum\" = ?, \"Kernel Data\" = ?, \"Currency Price\" = ? WHERE \"ID\" = ? AND \"Received\" IS NULL;", -1, SQLITE_PREPARE_PERSISTENT, &setPaymentReceivedStatement, nullptr) != SQLITE_OK) {
 	
 		// Throw exception
 		throw runtime_error("Preparing set payment received statement failed");
@@ -693,7 +791,7 @@ Payments::Payments(sqlite3 *databaseConnection) :
 	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> setPaymentReceivedStatementUniquePointer(setPaymentReceivedStatement, sqlite3_finalize);
 	
 	// Check if preparing reorg incomplete payments statement failed
-	if(sqlite3_prepare_v3(databaseConnection, "UPDATE \"Payments\" SET \"Confirmations\" = 0, \"Confirmed Height\" = NULL, \"Confirmations Changed\" = TRUE WHERE \"Completed\" IS NULL AND \"Confirmed Height\" IS NOT NULL AND \"Confirmed Height\" >= ?;", -1, SQLITE_PREPARE_PERSISTENT, &reorgIncompletePaymentsStatement, nullptr) != SQLITE_OK) {
+	if(sqlite3_prepare_v3(databaseConnection, "UPDATE \"Payments\" SET \"Confirmations\" = 0, \"Confirmed Height\" = NULL, \"Confirmations Changed\" = TRUE WHERE \"Completed\" IS NULL AND \"Confirmed Height\" IS NOT NULL AND \"Confirmed Height\" >= ? RETURNING \"Kernel Commitment\";", -1, SQLITE_PREPARE_PERSISTENT, &reorgIncompletePaymentsStatement, nullptr) != SQLITE_OK) {
 	
 		// Throw exception
 		throw runtime_error("Preparing reorg incomplete payments statement failed");
@@ -703,7 +801,7 @@ Payments::Payments(sqlite3 *databaseConnection) :
 	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> reorgIncompletePaymentsStatementUniquePointer(reorgIncompletePaymentsStatement, sqlite3_finalize);
 	
 	// Check if preparing set payment confirmations statement failed
-	if(sqlite3_prepare_v3(databaseConnection, "UPDATE \"Payments\" SET \"Confirmations\" = MIN(?, \"Required Confirmations\"), \"Completed\" = IIF(?1 >= \"Required Confirmations\", UNIXEPOCH('now'), NULL), \"Confirmed Height\" = IIF(?1 > 0, ?, NULL), \"Confirmations Changed\" = IIF(?1 >= \"Required Confirmations\", FALSE, TRUE) WHERE \"ID\" = ?;", -1, SQLITE_PREPARE_PERSISTENT, &setPaymentConfirmationsStatement, nullptr) != SQLITE_OK) {
+	if(sqlite3_prepare_v3(databaseConnection, "UPDATE \"Payments\" SET \"Confirmations\" = MIN(?, \"Required Confirmations\"), \"Completed\" = IIF(?1 >= \"Required Confirmations\", UNIXEPOCH('now'), NULL), \"Confirmed Height\" = IIF(?1 > 0, ?, NULL), \"Confirmations Changed\" = IIF(?1 >= \"Required Confirmations\", FALSE, TRUE) WHERE \"ID\" = ? RETURNING \"Kernel Commitment\", \"Confirmed Height\", \"Confirmations\", \"Completed\" IS NOT NULL;", -1, SQLITE_PREPARE_PERSISTENT, &setPaymentConfirmationsStatement, nullptr) != SQLITE_OK) {
 	
 		// Throw exception
 		throw runtime_error("Preparing set payment confirmations statement failed");
@@ -723,7 +821,7 @@ Payments::Payments(sqlite3 *databaseConnection) :
 	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> setPaymentSuccessfulCompletedCallbackStatementUniquePointer(setPaymentSuccessfulCompletedCallbackStatement, sqlite3_finalize);
 	
 	// Check if preparing set payment acknowledged confirmed callback statement failed
-	if(sqlite3_prepare_v3(databaseConnection, "UPDATE \"Payments\" SET \"Confirmations Changed\" = FALSE WHERE \"ID\" = ?;", -1, SQLITE_PREPARE_PERSISTENT, &setPaymentAcknowledgedConfirmedCallbackStatement, nullptr) != SQLITE_OK) {
+	if(sqlite3_prepare_v3(databaseConnection, "UPDATE \"Payments\" SET \"Confirmations Changed\" = FALSE WHERE \"ID\" = ? AND \"Confirmations\" = ?;", -1, SQLITE_PREPARE_PERSISTENT, &setPaymentAcknowledgedConfirmedCallbackStatement, nullptr) != SQLITE_OK) {
 	
 		// Throw exception
 		throw runtime_error("Preparing set payment acknowledged confirmed callback statement failed");
@@ -742,6 +840,16 @@ Payments::Payments(sqlite3 *databaseConnection) :
 	// Automatically free set payment successful expired callback statement
 	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> setPaymentSuccessfulExpiredCallbackStatementUniquePointer(setPaymentSuccessfulExpiredCallbackStatement, sqlite3_finalize);
 	
+	// Check if preparing set payment failed callback statement failed
+	if(sqlite3_prepare_v3(databaseConnection, "UPDATE \"Payments\" SET \"Callback Attempts\" = \"Callback Attempts\" + 1, \"Next Callback Attempt\" = UNIXEPOCH('now') + MIN(?2, ?3 << MIN(\"Callback Attempts\", ?4)) / 2 + ABS(RANDOM() % (MIN(?2, ?3 << MIN(\"Callback Attempts\", ?4)) / 2 + 1)) WHERE \"ID\" = ?1 RETURNING \"Next Callback Attempt\", \"Received\" IS NULL;", -1, SQLITE_PREPARE_PERSISTENT, &setPaymentFailedCallbackStatement, nullptr) != SQLITE_OK) {
+	
+		// Throw exception
+		throw runtime_error("Preparing set payment failed callback statement failed");
+	}
+	
+	// Automatically free set payment failed callback statement
+	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> setPaymentFailedCallbackStatementUniquePointer(setPaymentFailedCallbackStatement, sqlite3_finalize);
+	
 	// Check if preparing begin transaction statement failed
 	if(sqlite3_prepare_v3(databaseConnection, "BEGIN;", -1, SQLITE_PREPARE_PERSISTENT, &beginTransactionStatement, nullptr) != SQLITE_OK) {
 	
@@ -772,39 +880,198 @@ Payments::Payments(sqlite3 *databaseConnection) :
 	// Automatically free rollback transaction statement
 	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> rollbackTransactionStatementUniquePointer(rollbackTransactionStatement, sqlite3_finalize);
 	
+	// Check if getting database file failed
+	const char *databaseFile = sqlite3_db_filename(databaseConnection, "main");
+	if(!databaseFile || !strlen(databaseFile)) {
+	
+		// Throw exception
+		throw runtime_error("Getting database file failed");
+	}
+	
+	// Check if getting database memory map size and cache size failed
+	string readConnectionSettings;
+	if(sqlite3_exec(databaseConnection, "PRAGMA mmap_size; PRAGMA cache_size;", [](void *argument, int numberOfRows, char **rows, char **columnNames) -> int {
+	
+		// Get read connection settings from argument
+		string *readConnectionSettings = reinterpret_cast<string *>(argument);
+		
+		// Check if setting exists
+		if(numberOfRows && rows[0]) {
+		
+			// Add setting to read connection settings
+			*readConnectionSettings += string("PRAGMA ") + columnNames[0] + " = " + rows[0] + ';';
+		}
+		
+		// Return success
+		return 0;
+		
+	}, &readConnectionSettings, nullptr) != SQLITE_OK) {
+	
+		// Throw exception
+		throw runtime_error("Getting database memory map size and cache size failed");
+	}
+	
+	// Initialize read connections unique pointers
+	list<unique_ptr<sqlite3, decltype(&sqlite3_close)>> readConnectionsUniquePointers;
+	
+	// Initialize read statements unique pointers
+	list<unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)>> readStatementsUniquePointers;
+	
+	// Go through all read connections
+	for(size_t i = 0; i < NUMBER_OF_READ_CONNECTIONS; ++i) {
+	
+		// Check if connecting to database as read-only failed
+		if(sqlite3_open_v2(databaseFile, &readConnections[i], SQLITE_OPEN_READONLY, nullptr) != SQLITE_OK) {
+		
+			// Check if read connection exists
+			if(readConnections[i]) {
+			
+				// Close read connection
+				sqlite3_close(readConnections[i]);
+			}
+			
+			// Throw exception
+			throw runtime_error("Connecting to database as read-only failed");
+		}
+		
+		// Automatically close read connection
+		readConnectionsUniquePointers.emplace_back(readConnections[i], sqlite3_close);
+		
+		// Check if configuring read connection failed
+		if(sqlite3_exec(readConnections[i], readConnectionSettings.c_str(), nullptr, nullptr, nullptr) != SQLITE_OK) {
+		
+			// Throw exception
+			throw runtime_error("Configuring read connection failed");
+		}
+		
+		// Check if preparing get payment info statement failed
+		if(sqlite3_prepare_v3(readConnections[i], "SELECT \"Unique Number\", \"URL\", \"Price\", \"Required Confirmations\", \"Received\", \"Confirmations\", IIF(\"Expires\" IS NULL, NULL, MAX(\"Expires\" - UNIXEPOCH('now'), 0)) AS \"Time Remaining\", IIF(\"Received\" IS NULL AND \"Expires\" IS NOT NULL AND \"Expires\" <= UNIXEPOCH('now'), 'Expired', IIF(\"Received\" IS NULL, 'Not received', IIF(\"Confirmations\" = 0, 'Received', IIF(\"Completed\" IS NULL, 'Confirmed', 'Completed')))) AS \"Status\" FROM \"Payments\" WHERE \"ID\" = ?;", -1, SQLITE_PREPARE_PERSISTENT, &getPaymentInfoStatements[i], nullptr) != SQLITE_OK) {
+		
+			// Throw exception
+			throw runtime_error("Preparing get payment info statement failed");
+		}
+		
+		// Automatically free get payment info statement
+		readStatementsUniquePointers.emplace_back(getPaymentInfoStatements[i], sqlite3_finalize);
+		
+		// Check if preparing get payment price statement failed
+		if(sqlite3_prepare_v3(readConnections[i], "SELECT \"Unique Number\", IIF(\"Has Price\" = TRUE, \"Price\", NULL) AS \"Initial Price\", \"ID\" FROM \"Payments\" WHERE \"URL\" = ?;", -1, SQLITE_PREPARE_PERSISTENT, &getPaymentPriceStatements[i], nullptr) != SQLITE_OK) {
+		
+			// Throw exception
+			throw runtime_error("Preparing get payment price statement failed");
+		}
+		
+		// Automatically free get payment price statement
+		readStatementsUniquePointers.emplace_back(getPaymentPriceStatements[i], sqlite3_finalize);
+		
+		// Check if preparing get completed payments statement failed
+		if(sqlite3_prepare_v3(readConnections[i], "SELECT \"Unique Number\", \"ID\", \"URL\", \"Created\", \"Completed\", \"Price\", \"Required Confirmations\", \"Expires\", \"Received\", \"Completed Callback\", \"Completed Callback Successful\", \"Sender Payment Proof Address\", \"Kernel Commitment\", \"Confirmed Height\", \"Received Callback\", \"Confirmed Callback\", \"Expired Callback\", \"Expired Callback Successful\", \"Currency Price\", \"Notes\" FROM \"Payments\" WHERE \"Completed\" IS NOT NULL ORDER BY \"Completed\" ASC;", -1, 0, &getCompletedPaymentsStatements[i], nullptr) != SQLITE_OK) {
+		
+			// Throw exception
+			throw runtime_error("Preparing get completed payments statement failed");
+		}
+		
+		// Automatically free get completed payments statement
+		readStatementsUniquePointers.emplace_back(getCompletedPaymentsStatements[i], sqlite3_finalize);
+		
+		// Check if preparing get payment statement failed
+		if(sqlite3_prepare_v3(readConnections[i], "SELECT \"Unique Number\", \"URL\", \"Created\", \"Completed\", \"Price\", \"Required Confirmations\", \"Expires\", \"Received\", \"Completed Callback\", \"Completed Callback Successful\", \"Sender Payment Proof Address\", \"Kernel Commitment\", \"Confirmed Height\", \"Received Callback\", \"Confirmed Callback\", \"Expired Callback\", \"Expired Callback Successful\", \"Currency Price\", \"Notes\", IIF(\"Received\" IS NULL AND \"Expires\" IS NOT NULL AND \"Expires\" <= UNIXEPOCH('now'), 'Expired', IIF(\"Received\" IS NULL, 'Not received', IIF(\"Confirmations\" = 0, 'Received', IIF(\"Completed\" IS NULL, 'Confirmed', 'Completed')))) AS \"Status\" FROM \"Payments\" WHERE \"ID\" = ?;", -1, 0, &getPaymentStatements[i], nullptr) != SQLITE_OK) {
+		
+			// Throw exception
+			throw runtime_error("Preparing get payment statement failed");
+		}
+		
+		// Automatically free get payment statement
+		readStatementsUniquePointers.emplace_back(getPaymentStatements[i], sqlite3_finalize);
+		
+		// Check if preparing list payments statement failed
+		if(sqlite3_prepare_v3(readConnections[i], "SELECT \"Unique Number\", \"URL\", \"Price\", \"Required Confirmations\", \"Received\", \"Confirmations\", IIF(\"Expires\" IS NULL, NULL, MAX(\"Expires\" - UNIXEPOCH('now'), 0)) AS \"Time Remaining\", IIF(\"Received\" IS NULL AND \"Expires\" IS NOT NULL AND \"Expires\" <= UNIXEPOCH('now'), 'Expired', IIF(\"Received\" IS NULL, 'Not received', IIF(\"Confirmations\" = 0, 'Received', IIF(\"Completed\" IS NULL, 'Confirmed', 'Completed')))) AS \"Status\", \"ID\" FROM \"Payments\" WHERE \"Unique Number\" > ? AND \"Created\" BETWEEN ? AND ? AND (?4 IS NULL OR \"Status\" = ?4) ORDER BY \"Unique Number\" ASC LIMIT ?;", -1, SQLITE_PREPARE_PERSISTENT, &listPaymentsStatements[i], nullptr) != SQLITE_OK) {
+		
+			// Throw exception
+			throw runtime_error("Preparing list payments statement failed");
+		}
+		
+		// Automatically free list payments statement
+		readStatementsUniquePointers.emplace_back(listPaymentsStatements[i], sqlite3_finalize);
+		
+		// Check if preparing list not received payments statement failed
+		if(sqlite3_prepare_v3(readConnections[i], "SELECT \"Unique Number\", \"URL\", \"Price\", \"Required Confirmations\", \"Received\", \"Confirmations\", IIF(\"Expires\" IS NULL, NULL, MAX(\"Expires\" - UNIXEPOCH('now'), 0)) AS \"Time Remaining\", IIF(\"Received\" IS NULL AND \"Expires\" IS NOT NULL AND \"Expires\" <= UNIXEPOCH('now'), 'Expired', IIF(\"Received\" IS NULL, 'Not received', IIF(\"Confirmations\" = 0, 'Received', IIF(\"Completed\" IS NULL, 'Confirmed', 'Completed')))) AS \"Status\", \"ID\" FROM \"Payments\" WHERE \"Received\" IS NULL AND \"Unique Number\" > ? AND \"Created\" BETWEEN ? AND ? AND (?4 IS NULL OR \"Status\" = ?4) ORDER BY \"Unique Number\" ASC LIMIT ?;", -1, SQLITE_PREPARE_PERSISTENT, &listNotReceivedPaymentsStatements[i], nullptr) != SQLITE_OK) {
+		
+			// Throw exception
+			throw runtime_error("Preparing list not received payments statement failed");
+		}
+		
+		// Automatically free list not received payments statement
+		readStatementsUniquePointers.emplace_back(listNotReceivedPaymentsStatements[i], sqlite3_finalize);
+		
+		// Check if preparing list incomplete payments statement failed
+		if(sqlite3_prepare_v3(readConnections[i], "SELECT \"Unique Number\", \"URL\", \"Price\", \"Required Confirmations\", \"Received\", \"Confirmations\", IIF(\"Expires\" IS NULL, NULL, MAX(\"Expires\" - UNIXEPOCH('now'), 0)) AS \"Time Remaining\", IIF(\"Received\" IS NULL AND \"Expires\" IS NOT NULL AND \"Expires\" <= UNIXEPOCH('now'), 'Expired', IIF(\"Received\" IS NULL, 'Not received', IIF(\"Confirmations\" = 0, 'Received', IIF(\"Completed\" IS NULL, 'Confirmed', 'Completed')))) AS \"Status\", \"ID\" FROM \"Payments\" WHERE \"Completed\" IS NULL AND \"Received\" IS NOT NULL AND \"Unique Number\" > ? AND \"Created\" BETWEEN ? AND ? AND (?4 IS NULL OR \"Status\" = ?4) ORDER BY \"Unique Number\" ASC LIMIT ?;", -1, SQLITE_PREPARE_PERSISTENT, &listIncompletePaymentsStatements[i], nullptr) != SQLITE_OK) {
+		
+			// Throw exception
+			throw runtime_error("Preparing list incomplete payments statement failed");
+		}
+		
+		// Automatically free list incomplete payments statement
+		readStatementsUniquePointers.emplace_back(listIncompletePaymentsStatements[i], sqlite3_finalize);
+		
+		// Check if preparing list completed payments statement failed
+		if(sqlite3_prepare_v3(readConnections[i], "SELECT \"Unique Number\", \"URL\", \"Price\", \"Required Confirmations\", \"Received\", \"Confirmations\", IIF(\"Expires\" IS NULL, NULL, MAX(\"Expires\" - UNIXEPOCH('now'), 0)) AS \"Time Remaining\", IIF(\"Received\" IS NULL AND \"Expires\" IS NOT NULL AND \"Expires\" <= UNIXEPOCH('now'), 'Expired', IIF(\"Received\" IS NULL, 'Not received', IIF(\"Confirmations\" = 0, 'Received', IIF(\"Completed\" IS NULL, 'Confirmed', 'Completed')))) AS \"Status\", \"ID\" FROM \"Payments\" WHERE \"Completed\" IS NOT NULL AND \"Unique Number\" > ? AND \"Created\" BETWEEN ? AND ? AND (?4 IS NULL OR \"Status\" = ?4) ORDER BY \"Unique Number\" ASC LIMIT ?;", -1, SQLITE_PREPARE_PERSISTENT, &listCompletedPaymentsStatements[i], nullptr) != SQLITE_OK) {
+		
+			// Throw exception
+			throw runtime_error("Preparing list completed payments statement failed");
+		}
+		
+		// Automatically free list completed payments statement
+		readStatementsUniquePointers.emplace_back(listCompletedPaymentsStatements[i], sqlite3_finalize);
+	}
+	
+	// Load unconfirmed kernel commitments
+	loadUnconfirmedKernelCommitments();
+	
+	// Load expirations
+	loadExpirations();
+	
+	// Go through all read statements unique pointers
+	for(unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> &readStatementUniquePointer : readStatementsUniquePointers) {
+	
+		// Release read statement unique pointer
+		readStatementUniquePointer.release();
+	}
+	
+	// Go through all read connections unique pointers
+	for(unique_ptr<sqlite3, decltype(&sqlite3_close)> &readConnectionUniquePointer : readConnectionsUniquePointers) {
+	
+		// Release read connection unique pointer
+		readConnectionUniquePointer.release();
+	}
+	
 	// Release create payment statement unique pointer
 	createPaymentStatementUniquePointer.release();
 	
 	// Release create payment with expiration statement unique pointer
 	createPaymentWithExpirationStatementUniquePointer.release();
 	
-	// Release get payment info statement unique pointer
-	getPaymentInfoStatementUniquePointer.release();
-	
-	// Release get payment price statement unique pointer
-	getPaymentPriceStatementUniquePointer.release();
-	
 	// Release get receiving payment for URL statement unique pointer
 	getReceivingPaymentForUrlStatementUniquePointer.release();
 	
-	// Release get completed payments statement unique pointer
-	getCompletedPaymentsStatementUniquePointer.release();
-	
-	// Release get payment statement unique pointer
-	getPaymentStatementUniquePointer.release();
-	
 	// Release get unconfirmed payment statement unique pointer
 	getUnconfirmedPaymentStatementUniquePointer.release();
 	
 	// Release get incomplete payments statement unique pointer
 	getIncompletePaymentsStatementUniquePointer.release();
 	
-	// Release get confirming payments statement unique pointer
-	getConfirmingPaymentsStatementUniquePointer.release();
+	// Release update confirming payments statement unique pointer
+	updateConfirmingPaymentsStatementUniquePointer.release();
+	
+	// Release get unconfirmed kernel commitments statement unique pointer
+	getUnconfirmedKernelCommitmentsStatementUniquePointer.release();
 	
 	// Release get unsuccessful completed callback payments statement unique pointer
 	getUnsuccessfulCompletedCallbackPaymentsStatementUniquePointer.release();
 	
+	// Release get next completed callback attempt statement unique pointer
+	getNextCompletedCallbackAttemptStatementUniquePointer.release();
+	
 	// Release get pending confirmed callback payments statement unique pointer
 	getPendingConfirmedCallbackPaymentsStatementUniquePointer.release();
 	
@@ -829,6 +1096,9 @@ Payments::Payments(sqlite3 *databaseConnection) :
 	// Release set payment successful expired callback statement unique pointer
 	setPaymentSuccessfulExpiredCallbackStatementUniquePointer.release();
 	
+	// Release set payment failed callback statement unique pointer
+	setPaymentFailedCallbackStatementUniquePointer.release();
+	
 	// Release begin transaction statement unique pointer
 	beginTransactionStatementUniquePointer.release();
 	
@@ -862,26 +1132,6 @@ Payments::~Payments() {
 		Common::setErrorOccurred();
 	}
 	
-	// Check if freeing get payment info statement failed
-	if(sqlite3_finalize(getPaymentInfoStatement) != SQLITE_OK) {
-	
-		// Display message
-		cout << "Freeing get payment info statement failed" << endl;
-		
-		// Set error occurred
-		Common::setErrorOccurred();
-	}
-	
-	// Check if freeing get payment price statement failed
-	if(sqlite3_finalize(getPaymentPriceStatement) != SQLITE_OK) {
-	
-		// Display message
-		cout << "Freeing get payment price statement failed" << endl;
-		
-		// Set error occurred
-		Common::setErrorOccurred();
-	}
-	
 	// Check if freeing get receiving payment for URL statement failed
 	if(sqlite3_finalize(getReceivingPaymentForUrlStatement) != SQLITE_OK) {
 	
@@ -892,61 +1142,61 @@ Payments::~Payments() {
 		Common::setErrorOccurred();
 	}
 	
-	// Check if freeing get completed payments statement failed
-	if(sqlite3_finalize(getCompletedPaymentsStatement) != SQLITE_OK) {
+	// Check if freeing get unconfirmed payment statement failed
+	if(sqlite3_finalize(getUnconfirmedPaymentStatement) != SQLITE_OK) {
 	
 		// Display message
-		cout << "Freeing get completed payments statement failed" << endl;
+		cout << "Freeing get unconfirmed payment statement failed" << endl;
 		
 		// Set error occurred
 		Common::setErrorOccurred();
 	}
 	
-	// Check if freeing get payment statement failed
-	if(sqlite3_finalize(getPaymentStatement) != SQLITE_OK) {
+	// Check if freeing get incomplete payments statement failed
+	if(sqlite3_finalize(getIncompletePaymentsStatement) != SQLITE_OK) {
 	
 		// Display message
-		cout << "Freeing get payment statement failed" << endl;
+		cout << "Freeing get incomplete payments statement failed" << endl;
 		
 		// Set error occurred
 		Common::setErrorOccurred();
 	}
 	
-	// Check if freeing get unconfirmed payment statement failed
-	if(sqlite3_finalize(getUnconfirmedPaymentStatement) != SQLITE_OK) {
+	// Check if freeing update confirming payments statement failed
+	if(sqlite3_finalize(updateConfirmingPaymentsStatement) != SQLITE_OK) {
 	
 		// Display message
-		cout << "Freeing get unconfirmed payment statement failed" << endl;
+		cout << "Freeing update confirming payments statement failed" << endl;
 		
 		// Set error occurred
 		Common::setErrorOccurred();
 	}
 	
-	// Check if freeing get incomplete payments statement failed
-	if(sqlite3_finalize(getIncompletePaymentsStatement) != SQLITE_OK) {
+	// Check if freeing get unconfirmed kernel commitments statement failed
+	if(sqlite3_finalize(getUnconfirmedKernelCommitmentsStatement) != SQLITE_OK) {
 	
 		// Display message
-		cout << "Freeing get incomplete payments statement failed" << endl;
+		cout << "Freeing get unconfirmed kernel commitments statement failed" << endl;
 		
 		// Set error occurred
 		Common::setErrorOccurred();
 	}
 	
-	// Check if freeing get confirming payments statement failed
-	if(sqlite3_finalize(getConfirmingPaymentsStatement) != SQLITE_OK) {
+	// Check if freeing get unsuccessful completed callback payments statement failed
+	if(sqlite3_finalize(getUnsuccessfulCompletedCallbackPaymentsStatement) != SQLITE_OK) {
 	
 		// Display message
-		cout << "Freeing get confirming payments statement failed" << endl;
+		cout << "Freeing get unsuccessful completed callback payments statement failed" << endl;
 		
 		// Set error occurred
 		Common::setErrorOccurred();
 	}
 	
-	// Check if freeing get unsuccessful completed callback payments statement failed
-	if(sqlite3_finalize(getUnsuccessfulCompletedCallbackPaymentsStatement) != SQLITE_OK) {
+	// Check if freeing get next completed callback attempt statement failed
+	if(sqlite3_finalize(getNextCompletedCallbackAttemptStatement) != SQLITE_OK) {
 	
 		// Display message
-		cout << "Freeing get unsuccessful completed callback payments statement failed" << endl;
+		cout << "Freeing get next completed callback attempt statement failed" << endl;
 		
 		// Set error occurred
 		Common::setErrorOccurred();
@@ -1032,6 +1282,16 @@ Payments::~Payments() {
 		Common::setErrorOccurred();
 	}
 	
+	// Check if freeing set payment failed callback statement failed
+	if(sqlite3_finalize(setPaymentFailedCallbackStatement) != SQLITE_OK) {
+	
+		// Display message
+		cout << "Freeing set payment failed callback statement failed" << endl;
+		
+		// Set error occurred
+		Common::setErrorOccurred();
+	}
+	
 	// Check if freeing begin transaction statement failed
 	if(sqlite3_finalize(beginTransactionStatement) != SQLITE_OK) {
 	
@@ -1061,80 +1321,180 @@ Payments::~Payments() {
 		// Set error occurred
 		Common::setErrorOccurred();
 	}
-}
-
-// Create payment
-uint64_t Payments::createPayment(const uint64_t id, const char *url, const uint64_t price, const uint32_t requiredConfirmations, const uint32_t timeout, const char *completedCallback, const char *receivedCallback, const char *confirmedCallback, const char *expiredCallback, const char *currencyPrice, const char *notes) {
-
-	// Initialize result
-	uint64_t result;
 	
-	// Try
-	try {
+	// Go through all read connections
+	for(size_t i = 0; i < NUMBER_OF_READ_CONNECTIONS; ++i) {
 	
-		// Lock
-		lock_guard guard(lock);
+		// Check if freeing get payment info statement failed
+		if(sqlite3_finalize(getPaymentInfoStatements[i]) != SQLITE_OK) {
 		
-		// Check if a timeout exists
-		if(timeout) {
-		
-			// Check if resetting and clearing create payment with expiration statement failed
-			if(sqlite3_reset(createPaymentWithExpirationStatement) != SQLITE_OK || sqlite3_clear_bindings(createPaymentWithExpirationStatement) != SQLITE_OK) {
+			// Display message
+			cout << "Freeing get payment info statement failed" << endl;
 			
-				// Return zero
-				return 0;
-			}
+			// Set error occurred
+			Common::setErrorOccurred();
+		}
 		
-			// Check if binding create payment with expiration statement's values failed
-			if(sqlite3_bind_int64(createPaymentWithExpirationStatement, 1, *reinterpret_cast<const int64_t *>(&id)) != SQLITE_OK || sqlite3_bind_text(createPaymentWithExpirationStatement, 2, url, -1, SQLITE_STATIC) != SQLITE_OK || (price ? sqlite3_bind_int64(createPaymentWithExpirationStatement, 3, *reinterpret_cast<const int64_t *>(&price)) : sqlite3_bind_null(createPaymentWithExpirationStatement, 3)) != SQLITE_OK || sqlite3_bind_int64(createPaymentWithExpirationStatement, 4, requiredConfirmations) != SQLITE_OK || sqlite3_bind_int64(createPaymentWithExpirationStatement, 5, timeout) != SQLITE_OK || sqlite3_bind_text(createPaymentWithExpirationStatement, 6, completedCallback, -1, SQLITE_STATIC) != SQLITE_OK || (receivedCallback ? sqlite3_bind_text(createPaymentWithExpirationStatement, 7, receivedCallback, -1, SQLITE_STATIC) : sqlite3_bind_null(createPaymentWithExpirationStatement, 7)) != SQLITE_OK || (confirmedCallback ? sqlite3_bind_text(createPaymentWithExpirationStatement, 8, confirmedCallback, -1, SQLITE_STATIC) : sqlite3_bind_null(createPaymentWithExpirationStatement, 8)) != SQLITE_OK || (expiredCallback ? sqlite3_bind_text(createPaymentWithExpirationStatement, 9, expiredCallback, -1, SQLITE_STATIC) : sqlite3_bind_null(createPaymentWithExpirationStatement, 9)) != SQLITE_OK || (currencyPrice ? sqlite3_bind_text(createPaymentWithExpirationStatement, 10, currencyPrice, -1, SQLITE_STATIC) : sqlite3_bind_null(createPaymentWithExpirationStatement, 10)) != SQLITE_OK || (notes ? sqlite3_bind_text(createPaymentWithExpirationStatement, 11, notes, -1, SQLITE_STATIC) : sqlite3_bind_null(createPaymentWithExpirationStatement, 11)) != SQLITE_OK) {
-			
-				// Return zero
-				return 0;
-			}
-			
-			// Check if running create payment with expiration statement failed
-			if(sqlite3_step(createPaymentWithExpirationStatement) != SQLITE_DONE) {
+		// Check if freeing get payment price statement failed
+		if(sqlite3_finalize(getPaymentPriceStatements[i]) != SQLITE_OK) {
+		
+			// Display message
+			cout << "Freeing get payment price statement failed" << endl;
 			
-				// Reset create payment with expiration statement
-				sqlite3_reset(createPaymentWithExpirationStatement);
-				
-				// Return zero
-				return 0;
-			}
+			// Set error occurred
+			Common::setErrorOccurred();
 		}
 		
-		// Otherwise
-		else {
+		// Check if freeing get completed payments statement failed
+		if(sqlite3_finalize(getCompletedPaymentsStatements[i]) != SQLITE_OK) {
 		
-			// Check if resetting and clearing create payment statement failed
-			if(sqlite3_reset(createPaymentStatement) != SQLITE_OK || sqlite3_clear_bindings(createPaymentStatement) != SQLITE_OK) {
-			
-				// Return zero
-				return 0;
-			}
-			
-			// Check if binding create payment statement's values failed
-			if(sqlite3_bind_int64(createPaymentStatement, 1, *reinterpret_cast<const int64_t *>(&id)) != SQLITE_OK || sqlite3_bind_text(createPaymentStatement, 2, url, -1, SQLITE_STATIC) != SQLITE_OK || (price ? sqlite3_bind_int64(createPaymentStatement, 3, *reinterpret_cast<const int64_t *>(&price)) : sqlite3_bind_null(createPaymentStatement, 3)) != SQLITE_OK || sqlite3_bind_int64(createPaymentStatement, 4, requiredConfirmations) != SQLITE_OK || sqlite3_bind_text(createPaymentStatement, 5, completedCallback, -1, SQLITE_STATIC) != SQLITE_OK || (receivedCallback ? sqlite3_bind_text(createPaymentStatement, 6, receivedCallback, -1, SQLITE_STATIC) : sqlite3_bind_null(createPaymentStatement, 6)) != SQLITE_OK || (confirmedCallback ? sqlite3_bind_text(createPaymentStatement, 7, confirmedCallback, -1, SQLITE_STATIC) : sqlite3_bind_null(createPaymentStatement, 7)) != SQLITE_OK || (currencyPrice ? sqlite3_bind_text(createPaymentStatement, 8, currencyPrice, -1, SQLITE_STATIC) : sqlite3_bind_null(createPaymentStatement, 8)) != SQLITE_OK || (notes ? sqlite3_bind_text(createPaymentStatement, 9, notes, -1, SQLITE_STATIC) : sqlite3_bind_null(createPaymentStatement, 9)) != SQLITE_OK) {
+			// Display message
+			cout << "Freeing get completed payments statement failed" << endl;
 			
-				// Return zero
-				return 0;
-			}
+			// Set error occurred
+			Common::setErrorOccurred();
+		}
+		
+		// Check if freeing get payment statement failed
+		if(sqlite3_finalize(getPaymentStatements[i]) != SQLITE_OK) {
+		
+			// Display message
+			cout << "Freeing get payment statement failed" << endl;
 			
-			// Check if running create payment statement failed
-			if(sqlite3_step(createPaymentStatement) != SQLITE_DONE) {
+			// Set error occurred
+			Common::setErrorOccurred();
+		}
+		
+		// Check if freeing list payments statement failed
+		if(sqlite3_finalize(listPaymentsStatements[i]) != SQLITE_OK) {
+		
+			// Display message
+			cout << "Freeing list payments statement failed" << endl;
 			
-				// Reset create payment statement
-				sqlite3_reset(createPaymentStatement);
-				
-				// Return zero
-				return 0;
-			}
+			// Set error occurred
+			Common::setErrorOccurred();
 		}
 		
-		// Set result to payment's unique number
-		result = sqlite3_last_insert_rowid(databaseConnection);
-	}
-	
+		// Check if freeing list not received payments statement failed
+		if(sqlite3_finalize(listNotReceivedPaymentsStatements[i]) != SQLITE_OK) {
+		
+			// Display message
+			cout << "Freeing list not received payments statement failed" << endl;
+			
+			// Set error occurred
+			Common::setErrorOccurred();
+		}
+		
+		// Check if freeing list incomplete payments statement failed
+		if(sqlite3_finalize(listIncompletePaymentsStatements[i]) != SQLITE_OK) {
+		
+			// Display message
+			cout << "Freeing list incomplete payments statement failed" << endl;
+			
+			// Set error occurred
+			Common::setErrorOccurred();
+		}
+		
+		// Check if freeing list completed payments statement failed
+		if(sqlite3_finalize(listCompletedPaymentsStatements[i]) != SQLITE_OK) {
+		
+			// Display message
+			cout << "Freeing list completed payments statement failed" << endl;
+			
+			// Set error occurred
+			Common::setErrorOccurred();
+		}
+		
+		// Check if closing read connection failed
+		if(sqlite3_close(readConnections[i]) != SQLITE_OK) {
+		
+			// Display message
+			cout << "Closing read connection failed" << endl;
+			
+			// Set error occurred
+			Common::setErrorOccurred();
+		}
+	}
+}
+
+// Get options
+vector<option> Payments::getOptions() {
+
+	// Return options
+	return {
+	
+		// Callback retry maximum delay
+		{"callback_retry_maximum_delay", required_argument, nullptr, 'C'}
+	};
+}
+
+// Display options help
+void Payments::displayOptionsHelp() {
+
+	// Display message
+	cout << "\t-C, --callback_retry_maximum_delay\tSets the maximum delay in seconds between retries of a failed completed or expired callback (default: " << DEFAULT_CALLBACK_RETRY_MAXIMUM_DELAY << ')' << endl;
+}
+
+// Validate option
+bool Payments::validateOption(const char option, const char *value, char *argv[]) {
+
+	// Check option
+	switch(option) {
+	
+		// Callback retry maximum delay
+		case 'C': {
+		
+			// Check if callback retry maximum delay is invalid
+			char *end;
+			errno = 0;
+			const unsigned long long retryMaximumDelay = value ? strtoull(value, &end, Common::DECIMAL_NUMBER_BASE) : 0;
+			if(!value || end == value || *end || !isdigit(value[0]) || (value[0] == '0' && isdigit(value[1])) || errno || retryMaximumDelay < CALLBACK_RETRY_INITIAL_DELAY || retryMaximumDelay > numeric_limits<uint32_t>::max()) {
+			
+				// Display message
+				cout << argv[0] << ": invalid callback retry maximum delay -- '" << (value ? value : "") << '\'' << endl;
+		
+				// Return false
+				return false;
+			}
+			
+			// Break
+			break;
+		}
+	}
+	
+	// Return true
+	return true;
+}
+
+// Create payment
+uint64_t Payments::createPayment(const uint64_t id, const char *url, const uint64_t price, const uint32_t requiredConfirmations, const uint32_t timeout, const char *completedCallback, const char *receivedCallback, const char *confirmedCallback, const char *expiredCallback, const char *currencyPrice, const char *notes) {
+
+	// Initialize result
+	uint64_t result;
+	
+	// Try
+	try {
+	
+		// Lock
+		lock_guard guard(lock);
+		
+		// Check if inserting payment failed
+		uint64_t expires;
+		result = insertPayment(id, url, price, requiredConfirmations, timeout, completedCallback, receivedCallback, confirmedCallback, expiredCallback, currencyPrice, notes, expires);
+		if(!result) {
+		
+			// Return zero
+			return 0;
+		}
+		
+		// Check if a timeout exists
+		if(timeout) {
+		
+			// Schedule payment's expiration
+			scheduleExpiration(id, expires);
+		}
+	}
+	
 	// Catch errors
 	catch(...) {
 	
@@ -1146,12 +1506,127 @@ uint64_t Payments::createPayment(const uint64_t id, const char *url, const uint6
 	return result;
 }
 
-// Get payment info
-tuple<uint64_t, string, optional<uint64_t>, uint64_t, bool, uint64_t, optional<uint64_t>, string> Payments::getPaymentInfo(const uint64_t id) {
+// Create payments
+vector<uint64_t> Payments::createPayments(const list<tuple<uint64_t, const char *, uint64_t, uint32_t, uint32_t, const char *, const char *, const char *, const char *, const char *, const char *>> &newPayments) {
+
+	// Initialize result
+	vector<uint64_t> result;
+	
+	// Try
+	try {
+	
+		// Reserve space for the payments' unique numbers
+		result.reserve(newPayments.size());
+		
+		// Initialize expirations
+		list<pair<uint64_t, uint64_t>> expirations;
+		
+		// Lock
+		lock_guard guard(lock);
+		
+		// Check if beginning transaction failed
+		if(!beginTransaction()) {
+		
+			// Return empty result
+			return {};
+		}
+		
+		// Go through all new payments
+		for(const tuple<uint64_t, const char *, uint64_t, uint32_t, uint32_t, const char *, const char *, const char *, const char *, const char *, const char *> &newPayment : newPayments) {
+		
+			// Check if inserting payment failed
+			uint64_t expires;
+			const uint64_t uniqueNumber = insertPayment(get<0>(newPayment), get<1>(newPayment), get<2>(newPayment), get<3>(newPayment), get<4>(newPayment), get<5>(newPayment), get<6>(newPayment), get<7>(newPayment), get<8>(newPayment), get<9>(newPayment), get<10>(newPayment), expires);
+			if(!uniqueNumber) {
+			
+				// Rollback transaction
+				rollbackTransaction();
+				
+				// Return empty result
+				return {};
+			}
+			
+			// Add payment's unique number to result
+			result.push_back(uniqueNumber);
+			
+			// Check if payment has a timeout
+			if(get<4>(newPayment)) {
+			
+				// Add payment's expiration to expirations
+				expirations.emplace_back(get<0>(newPayment), expires);
+			}
+		}
+		
+		// Check if committing transaction failed
+		if(!commitTransaction()) {
+		
+			// Rollback transaction
+			rollbackTransaction();
+			
+			// Return empty result
+			return {};
+		}
+		
+		// Go through all expirations
+		for(const pair<uint64_t, uint64_t> &expiration : expirations) {
+		
+			// Schedule payment's expiration
+			scheduleExpiration(expiration.first, expiration.second);
+		}
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Return empty result
+		return {};
+	}
+	
+	// Return result
+	return result;
+}
 
+// Get next unique number
+uint64_t Payments::getNextUniqueNumber() {
+
+	// Initialize largest unique number
+	uint64_t largestUniqueNumber = 0;
+	
 	// Lock
 	lock_guard guard(lock);
 	
+	// Check if getting payments' largest unique number failed
+	if(sqlite3_exec(databaseConnection, "SELECT \"seq\" FROM \"sqlite_sequence\" WHERE \"name\" = 'Payments';", [](void *argument, int numberOfRows, char **rows, char **columnNames) -> int {
+	
+		// Get largest unique number from argument
+		uint64_t *largestUniqueNumber = reinterpret_cast<uint64_t *>(argument);
+		
+		// Set largest unique number to the row's sequence
+		*largestUniqueNumber = strtoull(rows[0], nullptr, Common::DECIMAL_NUMBER_BASE);
+		
+		// Return success
+		return 0;
+		
+	}, &largestUniqueNumber, nullptr) != SQLITE_OK) {
+	
+		// Throw exception
+		throw runtime_error("Getting payments' largest unique number failed");
+	}
+	
+	// Return next unique number
+	return largestUniqueNumber + 1;
+}
+
+// Get payment info
+tuple<uint64_t, string, optional<uint64_t>, uint64_t, bool, uint64_t, optional<uint64_t>, string> Payments::getPaymentInfo(const uint64_t id) {
+
+	// Lock read connection
+	const size_t readConnectionIndex = lockReadConnection();
+	lock_guard guard(readConnectionLocks[readConnectionIndex], adopt_lock);
+	
+	// Get read connection's get payment info statement
+	sqlite3_stmt *getPaymentInfoStatement = getPaymentInfoStatements[readConnectionIndex];
+	
 	// Check if resetting and clearing get payment info statement failed
 	if(sqlite3_reset(getPaymentInfoStatement) != SQLITE_OK || sqlite3_clear_bindings(getPaymentInfoStatement) != SQLITE_OK) {
 	
@@ -1181,33 +1656,7 @@ tuple<uint64_t, string, optional<uint64_t>, uint64_t, bool, uint64_t, optional<u
 	if(sqlResult == SQLITE_ROW) {
 		
 		// Create result from payment's info
-		const int64_t priceStorage = (sqlite3_column_type(getPaymentInfoStatement, 2) == SQLITE_NULL) ? 0 : sqlite3_column_int64(getPaymentInfoStatement, 2);
-		const tuple<uint64_t, string, optional<uint64_t>, uint64_t, bool, uint64_t, optional<uint64_t>, string> result(
-		
-			// Unique number
-			sqlite3_column_int64(getPaymentInfoStatement, 0),
-			
-			// URL
-			reinterpret_cast<const char *>(sqlite3_column_text(getPaymentInfoStatement, 1)),
-			
-			// Price
-			(sqlite3_column_type(getPaymentInfoStatement, 2) == SQLITE_NULL) ? nullopt : optional<uint64_t>(*reinterpret_cast<const uint64_t *>(&priceStorage)),
-			
-			// Required confirmations
-			sqlite3_column_int64(getPaymentInfoStatement, 3),
-			
-			// Received
-			sqlite3_column_type(getPaymentInfoStatement, 4) != SQLITE_NULL,
-			
-			// Confirmations
-			sqlite3_column_int64(getPaymentInfoStatement, 5),
-			
-			// Time remaining
-			(sqlite3_column_type(getPaymentInfoStatement, 6) == SQLITE_NULL) ? nullopt : optional<uint64_t>(sqlite3_column_int64(getPaymentInfoStatement, 6)),
-			
-			// Status
-			reinterpret_cast<const char *>(sqlite3_column_text(getPaymentInfoStatement, 7))
-		);
+		const tuple<uint64_t, string, optional<uint64_t>, uint64_t, bool, uint64_t, optional<uint64_t>, string> result = getPaymentInfoFromStatement(getPaymentInfoStatement);
 	
 		// Check if running get payment info statement failed
 		if(sqlite3_step(getPaymentInfoStatement) != SQLITE_DONE) {
@@ -1227,11 +1676,157 @@ tuple<uint64_t, string, optional<uint64_t>, uint64_t, bool, uint64_t, optional<u
 	return {};
 }
 
+// Get payments info
+void Payments::getPaymentsInfo(const vector<uint64_t> &ids, const function<void(const uint64_t, const tuple<uint64_t, string, optional<uint64_t>, uint64_t, bool, uint64_t, optional<uint64_t>, string> &)> &callback) {
+
+	// Lock read connection
+	const size_t readConnectionIndex = lockReadConnection();
+	lock_guard guard(readConnectionLocks[readConnectionIndex], adopt_lock);
+	
+	// Get read connection's get payment info statement
+	sqlite3_stmt *getPaymentInfoStatement = getPaymentInfoStatements[readConnectionIndex];
+	
+	// Try
+	try {
+	
+		// Go through all IDs
+		for(const uint64_t id : ids) {
+		
+			// Check if resetting and clearing get payment info statement failed
+			if(sqlite3_reset(getPaymentInfoStatement) != SQLITE_OK || sqlite3_clear_bindings(getPaymentInfoStatement) != SQLITE_OK) {
+			
+				// Throw exception
+				throw runtime_error("Resetting and clearing get payment info statement failed");
+			}
+			
+			// Check if binding get payment info statement's values failed
+			if(sqlite3_bind_int64(getPaymentInfoStatement, 1, *reinterpret_cast<const int64_t *>(&id)) != SQLITE_OK) {
+			
+				// Throw exception
+				throw runtime_error("Binding get payment info statement's values failed");
+			}
+			
+			// Check if running get payment info statement failed
+			const int sqlResult = sqlite3_step(getPaymentInfoStatement);
+			if(sqlResult != SQLITE_ROW && sqlResult != SQLITE_DONE) {
+			
+				// Throw exception
+				throw runtime_error("Running get payment info statement failed");
+			}
+			
+			// Check if payment was found
+			if(sqlResult == SQLITE_ROW) {
+			
+				// Run callback with the payment's info
+				callback(id, getPaymentInfoFromStatement(getPaymentInfoStatement));
+			}
+		}
+		
+		// Reset get payment info statement
+		sqlite3_reset(getPaymentInfoStatement);
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Reset get payment info statement
+		sqlite3_reset(getPaymentInfoStatement);
+		
+		// Throw
+		throw;
+	}
+}
+
+// List payments
+void Payments::listPayments(const char *status, const uint64_t createdAfter, const uint64_t createdBefore, const uint64_t afterUniqueNumber, const uint32_t limit, const function<void(const uint64_t, const tuple<uint64_t, string, optional<uint64_t>, uint64_t, bool, uint64_t, optional<uint64_t>, string> &)> &callback) {
+
+	// Lock read connection
+	const size_t readConnectionIndex = lockReadConnection();
+	lock_guard guard(readConnectionLocks[readConnectionIndex], adopt_lock);
+	
+	// Check if status is not received or expired
+	sqlite3_stmt *listPaymentsStatement;
+	if(status && (!strcmp(status, "Not received") || !strcmp(status, "Expired"))) {
+	
+		// Set list payments statement to the read connection's list not received payments statement
+		listPaymentsStatement = listNotReceivedPaymentsStatements[readConnectionIndex];
+	}
+	
+	// Otherwise check if status is received or confirmed
+	else if(status && (!strcmp(status, "Received") || !strcmp(status, "Confirmed"))) {
+	
+		// Set list payments statement to the read connection's list incomplete payments statement
+		listPaymentsStatement = listIncompletePaymentsStatements[readConnectionIndex];
+	}
+	
+	// Otherwise check if status is completed
+	else if(status && !strcmp(status, "Completed")) {
+	
+		// Set list payments statement to the read connection's list completed payments statement
+		listPaymentsStatement = listCompletedPaymentsStatements[readConnectionIndex];
+	}
+	
+	// Otherwise
+	else {
+	
+		// Set list payments statement to the read connection's list payments statement
+		listPaymentsStatement = listPaymentsStatements[readConnectionIndex];
+	}
+	
+	// Check if resetting and clearing list payments statement failed
+	if(sqlite3_reset(listPaymentsStatement) != SQLITE_OK || sqlite3_clear_bindings(listPaymentsStatement) != SQLITE_OK) {
+	
+		// Throw exception
+		throw runtime_error("Resetting and clearing list payments statement failed");
+	}
+	
+	// Check if binding list payments statement's values failed
+	if(sqlite3_bind_int64(listPaymentsStatement, 1, afterUniqueNumber) != SQLITE_OK || sqlite3_bind_int64(listPaymentsStatement, 2, createdAfter) != SQLITE_OK || sqlite3_bind_int64(listPaymentsStatement, 3, createdBefore) != SQLITE_OK || (status ? sqlite3_bind_text(listPaymentsStatement, 4, status, -1, SQLITE_STATIC) : sqlite3_bind_null(listPaymentsStatement, 4)) != SQLITE_OK || sqlite3_bind_int64(listPaymentsStatement, 5, limit) != SQLITE_OK) {
+	
+		// Throw exception
+		throw runtime_error("Binding list payments statement's values failed");
+	}
+	
+	// Try
+	try {
+	
+		// Go through all payments
+		int sqlResult;
+		while((sqlResult = sqlite3_step(listPaymentsStatement)) != SQLITE_DONE) {
+		
+			// Check if running list payments statement failed
+			if(sqlResult != SQLITE_ROW) {
+			
+				// Throw exception
+				throw runtime_error("Running list payments statement failed");
+			}
+			
+			// Run callback with the payment's ID and info
+			const int64_t idStorage = sqlite3_column_int64(listPaymentsStatement, 8);
+			callback(*reinterpret_cast<const uint64_t *>(&idStorage), getPaymentInfoFromStatement(listPaymentsStatement));
+		}
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Reset list payments statement
+		sqlite3_reset(listPaymentsStatement);
+		
+		// Throw
+		throw;
+	}
+}
+
 // Get payment price
-tuple<uint64_t, optional<uint64_t>> Payments::getPaymentPrice(const char *url) {
+tuple<uint64_t, optional<uint64_t>, uint64_t> Payments::getPaymentPrice(const char *url) {
 
-	// Lock
-	lock_guard guard(lock);
+	// Lock read connection
+	const size_t readConnectionIndex = lockReadConnection();
+	lock_guard guard(readConnectionLocks[readConnectionIndex], adopt_lock);
+	
+	// Get read connection's get payment price statement
+	sqlite3_stmt *getPaymentPriceStatement = getPaymentPriceStatements[readConnectionIndex];
 	
 	// Check if resetting and clearing get payment price statement failed
 	if(sqlite3_reset(getPaymentPriceStatement) != SQLITE_OK || sqlite3_clear_bindings(getPaymentPriceStatement) != SQLITE_OK) {
@@ -1263,13 +1858,17 @@ tuple<uint64_t, optional<uint64_t>> Payments::getPaymentPrice(const char *url) {
 		
 		// Create result from payment's info
 		const int64_t priceStorage = (sqlite3_column_type(getPaymentPriceStatement, 1) == SQLITE_NULL) ? 0 : sqlite3_column_int64(getPaymentPriceStatement, 1);
-		const tuple<uint64_t, optional<uint64_t>> result(
+		const int64_t idStorage = sqlite3_column_int64(getPaymentPriceStatement, 2);
+		const tuple<uint64_t, optional<uint64_t>, uint64_t> result(
 		
 			// Unique number
 			sqlite3_column_int64(getPaymentPriceStatement, 0),
 			
 			// Price
-			(sqlite3_column_type(getPaymentPriceStatement, 1) == SQLITE_NULL) ? nullopt : optional<uint64_t>(*reinterpret_cast<const uint64_t *>(&priceStorage))
+			(sqlite3_column_type(getPaymentPriceStatement, 1) == SQLITE_NULL) ? nullopt : optional<uint64_t>(*reinterpret_cast<const uint64_t *>(&priceStorage)),
+			
+			// ID
+			*reinterpret_cast<const uint64_t *>(&idStorage)
 		);
 	
 		// Check if running get payment price statement failed
@@ -1293,6 +1892,9 @@ tuple<uint64_t, optional<uint64_t>> Payments::getPaymentPrice(const char *url) {
 // Get receiving payment for URL
 tuple<uint64_t, uint64_t, optional<uint64_t>, optional<string>, optional<string>> Payments::getReceivingPaymentForUrl(const char *url) {
 
+	// Lock
+	lock_guard guard(lock);
+	
 	// Check if resetting and clearing get receiving payment for URL statement failed
 	if(sqlite3_reset(getReceivingPaymentForUrlStatement) != SQLITE_OK || sqlite3_clear_bindings(getReceivingPaymentForUrlStatement) != SQLITE_OK) {
 	
@@ -1360,31 +1962,107 @@ tuple<uint64_t, uint64_t, optional<uint64_t>, optional<string>, optional<string>
 	return {};
 }
 
-// Display completed payments
-void Payments::displayCompletedPayments(const Wallet &wallet) {
+// Claim payment
+bool Payments::claimPayment(const uint64_t id, const char *url) {
 
-	// Try
-	try {
+	// Lock
+	lock_guard guard(lock);
 	
-		// Initialize completed payment exists
-		bool completedPaymentExists = false;
-		
-		// Go through all completed payments
-		int sqlResult;
-		while((sqlResult = sqlite3_step(getCompletedPaymentsStatement)) != SQLITE_DONE) {
-		
-			// Check if running get completed payments statement failed
-			if(sqlResult != SQLITE_ROW) {
-				
-				// Throw exception
-				throw runtime_error("Running get completed payments statement failed");
-			}
-			
-			// Check if a signal was received
-			if(!Common::allowSignals() || !Common::blockSignals() || Common::getSignalReceived()) {
-			
-				// Block signals
-				Common::blockSignals();
+	// Check if payment is already claimed
+	if(claimedPayments.contains(id)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if resetting and clearing get receiving payment for URL statement failed
+	if(sqlite3_reset(getReceivingPaymentForUrlStatement) != SQLITE_OK || sqlite3_clear_bindings(getReceivingPaymentForUrlStatement) != SQLITE_OK) {
+	
+		// Throw exception
+		throw runtime_error("Resetting and clearing get receiving payment for URL statement failed");
+	}
+	
+	// Check if binding get receiving payment for URL statement's values failed
+	if(sqlite3_bind_text(getReceivingPaymentForUrlStatement, 1, url, -1, SQLITE_STATIC) != SQLITE_OK) {
+	
+		// Throw exception
+		throw runtime_error("Binding get receiving payment for URL statement's values failed");
+	}
+	
+	// Check if running get receiving payment for URL statement failed
+	const int sqlResult = sqlite3_step(getReceivingPaymentForUrlStatement);
+	if(sqlResult != SQLITE_ROW && sqlResult != SQLITE_DONE) {
+	
+		// Reset get receiving payment for URL statement
+		sqlite3_reset(getReceivingPaymentForUrlStatement);
+		
+		// Throw exception
+		throw runtime_error("Running get receiving payment for URL statement failed");
+	}
+	
+	// Check if payment is no longer being received since it was received or expired after it was looked up
+	const int64_t idStorage = (sqlResult == SQLITE_ROW) ? sqlite3_column_int64(getReceivingPaymentForUrlStatement, 1) : 0;
+	if(sqlResult != SQLITE_ROW || *reinterpret_cast<const uint64_t *>(&idStorage) != id) {
+	
+		// Reset get receiving payment for URL statement
+		sqlite3_reset(getReceivingPaymentForUrlStatement);
+		
+		// Return false
+		return false;
+	}
+	
+	// Reset get receiving payment for URL statement
+	sqlite3_reset(getReceivingPaymentForUrlStatement);
+	
+	// Add payment to claimed payments
+	claimedPayments.insert(id);
+	
+	// Return true
+	return true;
+}
+
+// Release payment claim
+void Payments::releasePaymentClaim(const uint64_t id) {
+
+	// Lock
+	lock_guard guard(lock);
+	
+	// Remove payment from claimed payments
+	claimedPayments.erase(id);
+}
+
+// Display completed payments
+void Payments::displayCompletedPayments(const Wallet &wallet) {
+
+	// Lock read connection
+	const size_t readConnectionIndex = lockReadConnection();
+	lock_guard guard(readConnectionLocks[readConnectionIndex], adopt_lock);
+	
+	// Get read connection's get completed payments statement
+	sqlite3_stmt *getCompletedPaymentsStatement = getCompletedPaymentsStatements[readConnectionIndex];
+	
+	// Try
+	try {
+	
+		// Initialize completed payment exists
+		bool completedPaymentExists = false;
+		
+		// Go through all completed payments
+		int sqlResult;
+		while((sqlResult = sqlite3_step(getCompletedPaymentsStatement)) != SQLITE_DONE) {
+		
+			// Check if running get completed payments statement failed
+			if(sqlResult != SQLITE_ROW) {
+				
+				// Throw exception
+				throw runtime_error("Running get completed payments statement failed");
+			}
+			
+			// Check if a signal was received
+			if(!Common::allowSignals() || !Common::blockSignals() || Common::getSignalReceived()) {
+			
+				// Block signals
+				Common::blockSignals();
 				
 				// Throw exception
 				throw runtime_error("Getting completed payment failed");
@@ -1592,6 +2270,13 @@ void Payments::displayCompletedPayments(const Wallet &wallet) {
 // Display payment
 void Payments::displayPayment(const uint64_t id, const Wallet &wallet) {
 
+	// Lock read connection
+	const size_t readConnectionIndex = lockReadConnection();
+	lock_guard guard(readConnectionLocks[readConnectionIndex], adopt_lock);
+	
+	// Get read connection's get payment statement
+	sqlite3_stmt *getPaymentStatement = getPaymentStatements[readConnectionIndex];
+	
 	// Check if binding get payment statement's values failed
 	if(sqlite3_bind_int64(getPaymentStatement, 1, *reinterpret_cast<const int64_t *>(&id)) != SQLITE_OK) {
 	
@@ -1888,6 +2573,13 @@ void Payments::displayPayment(const uint64_t id, const Wallet &wallet) {
 // Get unconfirmed payment
 tuple<uint64_t, uint64_t, uint64_t, vector<uint8_t>, vector<uint8_t>, vector<uint8_t>, vector<uint8_t>> Payments::getUnconfirmedPayment(const uint8_t kernelCommitment[Crypto::COMMITMENT_SIZE]) {
 
+	// Check if kernel commitment isn't for an unconfirmed payment
+	if(!unconfirmedKernelCommitments.contains(string(reinterpret_cast<const char *>(kernelCommitment), Crypto::COMMITMENT_SIZE))) {
+	
+		// Return nothing
+		return {};
+	}
+	
 	// Check if resetting and clearing get unconfirmed payment statement failed
 	if(sqlite3_reset(getUnconfirmedPaymentStatement) != SQLITE_OK || sqlite3_clear_bindings(getUnconfirmedPaymentStatement) != SQLITE_OK) {
 	
@@ -2030,46 +2722,50 @@ list<tuple<uint64_t, uint64_t, vector<uint8_t>, optional<uint64_t>, vector<uint8
 	return result;
 }
 
-// Get confirming payments
-list<tuple<uint64_t, uint64_t, uint64_t>> Payments::getConfirmingPayments() {
+// Update confirming payments
+list<uint64_t> Payments::updateConfirmingPayments(const uint64_t height) {
 
-	// Check if resetting get confirming payments statement failed
-	if(sqlite3_reset(getConfirmingPaymentsStatement) != SQLITE_OK) {
+	// Check if resetting and clearing update confirming payments statement failed
+	if(sqlite3_reset(updateConfirmingPaymentsStatement) != SQLITE_OK || sqlite3_clear_bindings(updateConfirmingPaymentsStatement) != SQLITE_OK) {
+	
+		// Throw exception
+		throw runtime_error("Resetting and clearing update confirming payments statement failed");
+	}
+	
+	// Check if binding update confirming payments statement's values failed
+	if(sqlite3_bind_int64(updateConfirmingPaymentsStatement, 1, height) != SQLITE_OK) {
 	
 		// Throw exception
-		throw runtime_error("Resetting get confirming payments statement failed");
+		throw runtime_error("Binding update confirming payments statement's values failed");
 	}
 	
 	// Initialize result
-	list<tuple<uint64_t, uint64_t, uint64_t>> result;
+	list<uint64_t> result;
 	
-	// Go through all confirming payments
+	// Go through all updated payments
 	int sqlResult;
-	while((sqlResult = sqlite3_step(getConfirmingPaymentsStatement)) != SQLITE_DONE) {
+	while((sqlResult = sqlite3_step(updateConfirmingPaymentsStatement)) != SQLITE_DONE) {
 	
-		// Check if running get confirming payments statement failed
+		// Check if running update confirming payments statement failed
 		if(sqlResult != SQLITE_ROW) {
 		
-			// Reset get confirming payments statement
-			sqlite3_reset(getConfirmingPaymentsStatement);
+			// Reset update confirming payments statement
+			sqlite3_reset(updateConfirmingPaymentsStatement);
 			
 			// Throw exception
-			throw runtime_error("Running get confirming payments statement failed");
+			throw runtime_error("Running update confirming payments statement failed");
 		}
 		
-		// Add payment's info to result
-		const int64_t idStorage = sqlite3_column_int64(getConfirmingPaymentsStatement, 0);
-		result.emplace_back(
+		// Add payment's change to payment changes
+		const int64_t idStorage = sqlite3_column_int64(updateConfirmingPaymentsStatement, 0);
+		addPaymentChange(*reinterpret_cast<const uint64_t *>(&idStorage), sqlite3_column_int(updateConfirmingPaymentsStatement, 1) ? "Completed" : "Confirmed", sqlite3_column_int64(updateConfirmingPaymentsStatement, 2));
 		
-			// ID
-			*reinterpret_cast<const uint64_t *>(&idStorage),
-			
-			// Required confirmations
-			sqlite3_column_int64(getConfirmingPaymentsStatement, 1),
-			
-			// Confirmed height
-			sqlite3_column_int64(getConfirmingPaymentsStatement, 2)
-		);
+		// Check if payment is completed
+		if(sqlite3_column_int(updateConfirmingPaymentsStatement, 1)) {
+		
+			// Add payment's ID to result
+			result.emplace_back(*reinterpret_cast<const uint64_t *>(&idStorage));
+		}
 	}
 	
 	// Return result
@@ -2079,26 +2775,59 @@ list<tuple<uint64_t, uint64_t, uint64_t>> Payments::getConfirmingPayments() {
 // Set payment received
 bool Payments::setPaymentReceived(const uint64_t id, const uint64_t price, const char *senderPaymentProofAddress, const uint8_t kernelCommitment[Crypto::COMMITMENT_SIZE], const uint8_t senderPublicBlindExcess[Crypto::SECP256K1_PUBLIC_KEY_SIZE], const uint8_t recipientPartialSignature[Crypto::SECP256K1_SINGLE_SIGNER_SIGNATURE_SIZE], const uint8_t publicNonceSum[Crypto::SECP256K1_PUBLIC_KEY_SIZE], const uint8_t *kernelData, const size_t kernelDataLength, const char *currencyPrice) {
 
-	// Check if resetting and clearing set payment received statement failed
-	if(sqlite3_reset(setPaymentReceivedStatement) != SQLITE_OK || sqlite3_clear_bindings(setPaymentReceivedStatement) != SQLITE_OK) {
-	
-		// Return false
-		return false;
-	}
-	
-	// Check if binding set payment received statement's values failed
-	if(sqlite3_bind_int64(setPaymentReceivedStatement, 1, *reinterpret_cast<const int64_t *>(&price)) != SQLITE_OK || sqlite3_bind_text(setPaymentReceivedStatement, 2, senderPaymentProofAddress, -1, SQLITE_STATIC) != SQLITE_OK || sqlite3_bind_blob(setPaymentReceivedStatement, 3, kernelCommitment, Crypto::COMMITMENT_SIZE, SQLITE_STATIC) != SQLITE_OK || sqlite3_bind_blob(setPaymentReceivedStatement, 4, senderPublicBlindExcess, Crypto::SECP256K1_PUBLIC_KEY_SIZE, SQLITE_STATIC) != SQLITE_OK || sqlite3_bind_blob(setPaymentReceivedStatement, 5, recipientPartialSignature, Crypto::SECP256K1_SINGLE_SIGNER_SIGNATURE_SIZE, SQLITE_STATIC) != SQLITE_OK || sqlite3_bind_blob(setPaymentReceivedStatement, 6, publicNonceSum, Crypto::SECP256K1_PUBLIC_KEY_SIZE, SQLITE_STATIC) != SQLITE_OK || sqlite3_bind_blob(setPaymentReceivedStatement, 7, kernelData, kernelDataLength, SQLITE_STATIC) != SQLITE_OK || (currencyPrice ? sqlite3_bind_text(setPaymentReceivedStatement, 8, currencyPrice, -1, SQLITE_STATIC) : sqlite3_bind_null(setPaymentReceivedStatement, 8)) != SQLITE_OK || sqlite3_bind_int64(setPaymentReceivedStatement, 9, *reinterpret_cast<const int64_t *>(&id)) != SQLITE_OK) {
+	// Try
+	try {
 	
-		// Return false
-		return false;
+		// Lock
+		lock_guard guard(lock);
+		
+		// Check if resetting and clearing set payment received statement failed
+		if(sqlite3_reset(setPaymentReceivedStatement) != SQLITE_OK || sqlite3_clear_bindings(setPaymentReceivedStatement) != SQLITE_OK) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Check if binding set payment received statement's values failed
+		if(sqlite3_bind_int64(setPaymentReceivedStatement, 1, *reinterpret_cast<const int64_t *>(&price)) != SQLITE_OK || sqlite3_bind_text(setPaymentReceivedStatement, 2, senderPaymentProofAddress, -1, SQLITE_STATIC) != SQLITE_OK || sqlite3_bind_blob(setPaymentReceivedStatement, 3, kernelCommitment, Crypto::COMMITMENT_SIZE, SQLITE_STATIC) != SQLITE_OK || sqlite3_bind_blob(setPaymentReceivedStatement, 4, senderPublicBlindExcess, Crypto::SECP256K1_PUBLIC_KEY_SIZE, SQLITE_STATIC) != SQLITE_OK || sqlite3_bind_blob(setPaymentReceivedStatement, 5, recipientPartialSignature, Crypto::SECP256K1_SINGLE_SIGNER_SIGNATURE_SIZE, SQLITE_STATIC) != SQLITE_OK || sqlite3_bind_blob(setPaymentReceivedStatement, 6, publicNonceSum, Crypto::SECP256K1_PUBLIC_KEY_SIZE, SQLITE_STATIC) != SQLITE_OK || sqlite3_bind_blob(setPaymentReceivedStatement, 7, kernelData, kernelDataLength, SQLITE_STATIC) != SQLITE_OK || (currencyPrice ? sqlite3_bind_text(setPaymentReceivedStatement, 8, currencyPrice, -1, SQLITE_STATIC) : sqlite3_bind_null(setPaymentReceivedStatement, 8)) != SQLITE_OK || sqlite3_bind_int64(setPaymentReceivedStatement, 9, *reinterpret_cast<const int64_t *>(&id)) != SQLITE_OK) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Check if running set payment received statement failed
+		if(sqlite3_step(setPaymentReceivedStatement) != SQLITE_DONE) {
+		
+			// Reset set payment received statement
+			sqlite3_reset(setPaymentReceivedStatement);
+			
+			// Return false
+			return false;
+		}
+		
+		// Check if payment wasn't received since it was already received
+		if(!sqlite3_changes(databaseConnection)) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Remove payment from claimed payments
+		claimedPayments.erase(id);
+		
+		// Add kernel commitment to unconfirmed kernel commitments
+		unconfirmedKernelCommitments.emplace(reinterpret_cast<const char *>(kernelCommitment), Crypto::COMMITMENT_SIZE);
+		
+		// Unschedule payment's expiration
+		unscheduleExpiration(id);
+		
+		// Add payment's change to payment changes
+		addPaymentChange(id, "Received", 0);
 	}
 	
-	// Check if running set payment received statement failed
-	if(sqlite3_step(setPaymentReceivedStatement) != SQLITE_DONE) {
+	// Catch errors
+	catch(...) {
 	
-		// Reset set payment received statement
-		sqlite3_reset(setPaymentReceivedStatement);
-		
 		// Return false
 		return false;
 	}
@@ -2110,6 +2839,13 @@ bool Payments::setPaymentReceived(const uint64_t id, const uint64_t price, const
 // Update payments with reorg
 bool Payments::updatePaymentsWithReorg(const uint64_t reorgHeight) {
 
+	// Check if no incomplete payments could have been confirmed at or above the reorg height
+	if(reorgHeight > maximumConfirmedHeight) {
+	
+		// Return true
+		return true;
+	}
+	
 	// Try
 	try {
 	
@@ -2127,15 +2863,26 @@ bool Payments::updatePaymentsWithReorg(const uint64_t reorgHeight) {
 			return false;
 		}
 		
-		// Check if running reorg incomplete payments statement failed
-		if(sqlite3_step(reorgIncompletePaymentsStatement) != SQLITE_DONE) {
+		// Go through all reorged payments
+		int sqlResult;
+		while((sqlResult = sqlite3_step(reorgIncompletePaymentsStatement)) != SQLITE_DONE) {
 		
-			// Reset reorg incomplete payments statement
-			sqlite3_reset(reorgIncompletePaymentsStatement);
+			// Check if running reorg incomplete payments statement failed
+			if(sqlResult != SQLITE_ROW) {
 			
-			// Return false
-			return false;
+				// Reset reorg incomplete payments statement
+				sqlite3_reset(reorgIncompletePaymentsStatement);
+				
+				// Return false
+				return false;
+			}
+			
+			// Add payment's kernel commitment to unconfirmed kernel commitments
+			unconfirmedKernelCommitments.emplace(reinterpret_cast<const char *>(sqlite3_column_blob(reorgIncompletePaymentsStatement, 0)), sqlite3_column_bytes(reorgIncompletePaymentsStatement, 0));
 		}
+		
+		// Set maximum confirmed height to below the reorg height
+		maximumConfirmedHeight = reorgHeight ? reorgHeight - 1 : 0;
 	}
 	
 	// Catch errors
@@ -2166,14 +2913,42 @@ bool Payments::setPaymentConfirmed(const uint64_t id, const uint32_t confirmatio
 		return false;
 	}
 	
-	// Check if running set payment confirmed statement failed
-	if(sqlite3_step(setPaymentConfirmationsStatement) != SQLITE_DONE) {
+	// Go through the updated payment
+	int sqlResult;
+	while((sqlResult = sqlite3_step(setPaymentConfirmationsStatement)) != SQLITE_DONE) {
 	
-		// Reset set payment confirmed statement
-		sqlite3_reset(setPaymentConfirmationsStatement);
+		// Check if running set payment confirmed statement failed
+		if(sqlResult != SQLITE_ROW) {
 		
-		// Return false
-		return false;
+			// Reset set payment confirmed statement
+			sqlite3_reset(setPaymentConfirmationsStatement);
+			
+			// Return false
+			return false;
+		}
+		
+		// Get payment's kernel commitment
+		const string kernelCommitment(reinterpret_cast<const char *>(sqlite3_column_blob(setPaymentConfirmationsStatement, 0)), sqlite3_column_bytes(setPaymentConfirmationsStatement, 0));
+		
+		// Check if payment isn't confirmed
+		if(sqlite3_column_type(setPaymentConfirmationsStatement, 1) == SQLITE_NULL) {
+		
+			// Add payment's kernel commitment to unconfirmed kernel commitments
+			unconfirmedKernelCommitments.insert(kernelCommitment);
+		}
+		
+		// Otherwise
+		else {
+		
+			// Remove payment's kernel commitment from unconfirmed kernel commitments
+			unconfirmedKernelCommitments.erase(kernelCommitment);
+			
+			// Update maximum confirmed height
+			maximumConfirmedHeight = max(maximumConfirmedHeight, confirmedHeight);
+		}
+		
+		// Add payment's change to payment changes
+		addPaymentChange(id, sqlite3_column_int(setPaymentConfirmationsStatement, 3) ? "Completed" : (sqlite3_column_int64(setPaymentConfirmationsStatement, 2) ? "Confirmed" : "Received"), sqlite3_column_int64(setPaymentConfirmationsStatement, 2));
 	}
 	
 	// Return true
@@ -2214,6 +2989,9 @@ bool Payments::beginTransaction() {
 		return false;
 	}
 	
+	// Clear pending payment changes
+	pendingPaymentChanges.clear();
+	
 	// Return true
 	return true;
 }
@@ -2245,6 +3023,9 @@ bool Payments::commitTransaction() {
 		return false;
 	}
 	
+	// Publish payment changes now that they're committed
+	publishPaymentChanges();
+	
 	// Return true
 	return true;
 }
@@ -2271,123 +3052,114 @@ bool Payments::rollbackTransaction() {
 			// Return false
 			return false;
 		}
+		
+		// Reset maximum confirmed height since the rolled back changes may have modified it
+		maximumConfirmedHeight = numeric_limits<uint64_t>::max();
+		
+		// Clear pending payment changes since they were rolled back
+		pendingPaymentChanges.clear();
+		
+		// Try
+		try {
+		
+			// Load unconfirmed kernel commitments since the rolled back changes may have modified them
+			loadUnconfirmedKernelCommitments();
+		}
+		
+		// Catch errors
+		catch(...) {
+		
+			// Return false
+			return false;
+		}
 	}
 	
 	// Return true
 	return true;
 }
 
-// Run unsuccessful completed payment callbacks
-void Payments::runUnsuccessfulCompletedPaymentCallbacks() {
+// Acknowledge payment callbacks
+bool Payments::acknowledgePaymentCallbacks(const list<uint64_t> &successfulCompletedCallbackPayments, const list<uint64_t> &failedCompletedCallbackPayments, const list<pair<uint64_t, uint64_t>> &acknowledgedConfirmedCallbackPayments) {
 
 	// Try
 	try {
-
-		// Go through all unsuccessful completed callback payments
-		for(tuple<uint64_t, uint64_t, uint64_t, string> &paymentInfo : getUnsuccessfulCompletedCallbackPayments()) {
+	
+		// Lock
+		lock_guard guard(lock);
 		
-			// Try
-			try {
-			
-				// Get payment ID
-				const uint64_t &paymentId = get<0>(paymentInfo);
-				
-				// Get payment completed
-				const uint64_t &paymentCompleted = get<1>(paymentInfo);
-				
-				// Get payment received
-				const uint64_t &paymentReceived = get<2>(paymentInfo);
-				
-				// Get payment's completed callback
-				string &paymentCompletedCallback = get<3>(paymentInfo);
-				
-				// Apply substitutions to payment's completed callback
-				Common::applySubstitutions(paymentCompletedCallback, {
-				
-					// ID
-					{"__id__", to_string(paymentId)},
-					
-					// Completed
-					{"__completed__", to_string(paymentCompleted)},
-					
-					// Received
-					{"__received__", to_string(paymentReceived)}
-				});
+		// Check if beginning transaction failed
+		if(!beginTransaction()) {
 		
-				// Check if sending HTTP request to the payment's completed callback was successful
-				if(Common::sendHttpRequest(paymentCompletedCallback.c_str())) {
-				
-					// Set that payment's completed callback was successful
-					setPaymentSuccessfulCompletedCallback(paymentId);
-				}
-			}
-			
-			// Catch errors
-			catch(...) {
+			// Return false
+			return false;
+		}
+		
+		// Go through all successful completed callback payments
+		for(const uint64_t paymentId : successfulCompletedCallbackPayments) {
+		
+			// Check if setting that payment's completed callback was successful failed
+			if(!setPaymentSuccessfulCompletedCallback(paymentId)) {
 			
+				// Rollback transaction
+				rollbackTransaction();
+				
+				// Return false
+				return false;
 			}
 		}
-	}
-	
-	// Catch errors
-	catch(...) {
-	
-	}
-}
-
-// Run pending confirmed payment callbacks
-void Payments::runPendingConfirmedPaymentCallbacks() {
-
-	// Try
-	try {
-
-		// Go through all pending confirmed callback payments
-		for(tuple<uint64_t, uint64_t, string> &paymentInfo : getPendingConfirmedCallbackPayments()) {
 		
-			// Get payment ID
-			const uint64_t &paymentId = get<0>(paymentInfo);
-			
-			// Try
-			try {
+		// Go through all failed completed callback payments
+		for(const uint64_t paymentId : failedCompletedCallbackPayments) {
+		
+			// Check if setting that payment's completed callback failed failed
+			if(!setPaymentFailedCallback(paymentId)) {
 			
-				// Get payment confirmations
-				const uint64_t &paymentConfirmations = get<1>(paymentInfo);
-				
-				// Get payment's confirmed callback
-				string &paymentConfirmedCallback = get<2>(paymentInfo);
-				
-				// Apply substitutions to payment's confirmed callback
-				Common::applySubstitutions(paymentConfirmedCallback, {
+				// Rollback transaction
+				rollbackTransaction();
 				
-					// ID
-					{"__id__", to_string(paymentId)},
-					
-					// Confirmations
-					{"__confirmations__", to_string(paymentConfirmations)}
-				});
-		
-				// Send HTTP request to the payment's confirmed callback
-				Common::sendHttpRequest(paymentConfirmedCallback.c_str());
+				// Return false
+				return false;
 			}
+		}
+		
+		// Go through all acknowledged confirmed callback payments
+		for(const pair<uint64_t, uint64_t> &paymentInfo : acknowledgedConfirmedCallbackPayments) {
+		
+			// Check if setting that payment's confirmed callback was acknowledged failed
+			if(!setPaymentAcknowledgedConfirmedCallback(paymentInfo.first, paymentInfo.second)) {
 			
-			// Catch errors
-			catch(...) {
-			
+				// Rollback transaction
+				rollbackTransaction();
+				
+				// Return false
+				return false;
 			}
+		}
+		
+		// Check if committing transaction failed
+		if(!commitTransaction()) {
+		
+			// Rollback transaction
+			rollbackTransaction();
 			
-			// Set that payment's confirmed callback was acknowledged
-			setPaymentAcknowledgedConfirmedCallback(paymentId);
+			// Return false
+			return false;
 		}
 	}
 	
 	// Catch errors
 	catch(...) {
 	
+		// Return false
+		return false;
 	}
+	
+	// Return true
+	return true;
 }
 
 // Run unsuccessful expired payment callbacks
-void Payments::runUnsuccessfulExpiredPaymentCallbacks() {
+void Payments::runUnsuccessfulExpiredPaymentCallbacks(HttpClient &httpClient, const atomic_bool &quit) {
 
 	// Try
 	try {
@@ -2395,6 +3167,13 @@ void Payments::runUnsuccessfulExpiredPaymentCallbacks() {
 		// Go through all unsuccessful expired callback payments
 		for(tuple<uint64_t, optional<string>> &paymentInfo : getUnsuccessfulExpiredCallbackPayments()) {
 		
+			// Check if quitting
+			if(quit.load()) {
+			
+				// Break since the remaining payments will be loaded again on startup
+				break;
+			}
+		
 			// Try
 			try {
 			
@@ -2414,16 +3193,82 @@ void Payments::runUnsuccessfulExpiredPaymentCallbacks() {
 						{"__id__", to_string(paymentId)}
 					});
 			
-					// Check if sending HTTP request to the payment's expired callback was successful
-					if(Common::sendHttpRequest(paymentExpiredCallback.value().c_str())) {
+					// Check if sending HTTP request to the payment's expired callback failed
+					const shared_ptr<optional<bool>> requestResult = make_shared<optional<bool>>();
+					if(!httpClient.sendRequest(paymentExpiredCallback.value().c_str(), [this, requestResult](const bool successful) {
 					
-						// Check if setting that payment's expired callback was successful was successful
-						if(setPaymentSuccessfulExpiredCallback(paymentId)) {
-						
-							// Display message
-							osyncstream(cout) << "Expired payment " << paymentId << endl;
+						{
+							// Lock expirations
+							lock_guard guard(expirationsLock);
+							
+							// Set request result
+							*requestResult = successful;
 						}
-					}
+						
+						// Notify waiting threads
+						expirationsConditionVariable.notify_all();
+					})) {
+					
+						// Set request result to failed
+						*requestResult = false;
+					}
+					
+					// Initialize request successful
+					optional<bool> requestSuccessful;
+					
+					{
+						// Lock expirations
+						unique_lock uniqueLock(expirationsLock);
+						
+						// Wait until the request finishes or quitting
+						expirationsConditionVariable.wait(uniqueLock, [&quit, &requestResult]() {
+						
+							// Return if the request finished or quitting
+							return requestResult->has_value() || quit.load();
+						});
+						
+						// Set request successful to the request result
+						requestSuccessful = *requestResult;
+					}
+					
+					// Check if quitting before the request finished
+					if(!requestSuccessful.has_value()) {
+					
+						// Break since the payment will be loaded again on startup
+						break;
+					}
+					
+					// Check if request was successful
+					if(requestSuccessful.value()) {
+					
+						// Check if setting that payment's expired callback was successful was successful
+						if(setPaymentSuccessfulExpiredCallback(paymentId)) {
+						
+							// Display message
+							osyncstream(cout) << "Expired payment " << paymentId << endl;
+						}
+						
+						// Otherwise
+						else {
+						
+							// Schedule payment's expiration to be checked again
+							scheduleExpiration(paymentId, time(nullptr) + EXPIRED_CALLBACK_RECHECK_DELAY);
+						}
+					}
+					
+					// Otherwise
+					else {
+					
+						// Lock
+						lock_guard guard(lock);
+						
+						// Check if setting that payment's expired callback failed failed
+						if(!setPaymentFailedCallback(paymentId)) {
+						
+							// Schedule payment's expiration to be checked again
+							scheduleExpiration(paymentId, time(nullptr) + EXPIRED_CALLBACK_RECHECK_DELAY);
+						}
+					}
 				}
 				
 				// Otherwise check if setting that payment's expired callback was successful was successful
@@ -2432,11 +3277,20 @@ void Payments::runUnsuccessfulExpiredPaymentCallbacks() {
 					// Display message
 					osyncstream(cout) << "Expired payment " << paymentId << endl;
 				}
+				
+				// Otherwise
+				else {
+				
+					// Schedule payment's expiration to be checked again
+					scheduleExpiration(paymentId, time(nullptr) + EXPIRED_CALLBACK_RECHECK_DELAY);
+				}
 			}
 			
 			// Catch errors
 			catch(...) {
 			
+				// Schedule payment's expiration to be checked again
+				scheduleExpiration(get<0>(paymentInfo), time(nullptr) + EXPIRED_CALLBACK_RECHECK_DELAY);
 			}
 		}
 	}
@@ -2444,6 +3298,17 @@ void Payments::runUnsuccessfulExpiredPaymentCallbacks() {
 	// Catch errors
 	catch(...) {
 	
+		// Try
+		try {
+		
+			// Load expirations since the due payments weren't processed
+			loadExpirations();
+		}
+		
+		// Catch errors
+		catch(...) {
+		
+		}
 	}
 }
 
@@ -2499,47 +3364,73 @@ list<tuple<uint64_t, uint64_t, uint64_t, string>> Payments::getUnsuccessfulCompl
 	return result;
 }
 
+// Get next completed callback attempt
+optional<uint64_t> Payments::getNextCompletedCallbackAttempt(const uint64_t after) {
+
+	// Lock
+	lock_guard guard(lock);
+	
+	// Check if resetting and clearing get next completed callback attempt statement failed
+	if(sqlite3_reset(getNextCompletedCallbackAttemptStatement) != SQLITE_OK || sqlite3_clear_bindings(getNextCompletedCallbackAttemptStatement) != SQLITE_OK) {
+	
+		// Throw exception
+		throw runtime_error("Resetting and clearing get next completed callback attempt statement failed");
+	}
+	
+	// Check if binding get next completed callback attempt statement's values failed
+	if(sqlite3_bind_int64(getNextCompletedCallbackAttemptStatement, 1, after) != SQLITE_OK) {
+	
+		// Throw exception
+		throw runtime_error("Binding get next completed callback attempt statement's values failed");
+	}
+	
+	// Check if running get next completed callback attempt statement failed
+	if(sqlite3_step(getNextCompletedCallbackAttemptStatement) != SQLITE_ROW) {
+	
+		// Reset get next completed callback attempt statement
+		sqlite3_reset(getNextCompletedCallbackAttemptStatement);
+		
+		// Throw exception
+		throw runtime_error("Running get next completed callback attempt statement failed");
+	}
+	
+	// Get next completed callback attempt
+	const optional<uint64_t> result = (sqlite3_column_type(getNextCompletedCallbackAttemptStatement, 0) == SQLITE_NULL) ? nullopt : optional<uint64_t>(sqlite3_column_int64(getNextCompletedCallbackAttemptStatement, 0));
+	
+	// Reset get next completed callback attempt statement
+	sqlite3_reset(getNextCompletedCallbackAttemptStatement);
+	
+	// Return result
+	return result;
+}
+
 // Set payment successful completed callback
 bool Payments::setPaymentSuccessfulCompletedCallback(const uint64_t id) {
 
-	// Try
-	try {
+	// Check if resetting and clearing set payment successful completed callback statement failed
+	if(sqlite3_reset(setPaymentSuccessfulCompletedCallbackStatement) != SQLITE_OK || sqlite3_clear_bindings(setPaymentSuccessfulCompletedCallbackStatement) != SQLITE_OK) {
 	
-		// Lock
-		lock_guard guard(lock);
-		
-		// Check if resetting and clearing set payment successful completed callback statement failed
-		if(sqlite3_reset(setPaymentSuccessfulCompletedCallbackStatement) != SQLITE_OK || sqlite3_clear_bindings(setPaymentSuccessfulCompletedCallbackStatement) != SQLITE_OK) {
-		
-			// Return false
-			return false;
-		}
-		
-		// Check if binding set payment successful completed callback statement's values failed
-		if(sqlite3_bind_int64(setPaymentSuccessfulCompletedCallbackStatement, 1, *reinterpret_cast<const int64_t *>(&id)) != SQLITE_OK) {
-		
-			// Return false
-			return false;
-		}
-		
-		// Check if running set payment successful completed callback statement failed
-		if(sqlite3_step(setPaymentSuccessfulCompletedCallbackStatement) != SQLITE_DONE) {
-		
-			// Reset set payment successful completed callback statement
-			sqlite3_reset(setPaymentSuccessfulCompletedCallbackStatement);
-			
-			// Return false
-			return false;
-		}
+		// Return false
+		return false;
 	}
 	
-	// Catch errors
-	catch(...) {
+	// Check if binding set payment successful completed callback statement's values failed
+	if(sqlite3_bind_int64(setPaymentSuccessfulCompletedCallbackStatement, 1, *reinterpret_cast<const int64_t *>(&id)) != SQLITE_OK) {
 	
 		// Return false
 		return false;
 	}
 	
+	// Check if running set payment successful completed callback statement failed
+	if(sqlite3_step(setPaymentSuccessfulCompletedCallbackStatement) != SQLITE_DONE) {
+	
+		// Reset set payment successful completed callback statement
+		sqlite3_reset(setPaymentSuccessfulCompletedCallbackStatement);
+		
+		// Return false
+		return false;
+	}
+	
 	// Return true
 	return true;
 }
@@ -2594,46 +3485,32 @@ list<tuple<uint64_t, uint64_t, string>> Payments::getPendingConfirmedCallbackPay
 }
 
 // Set payment acknowledged confirmed callback
-bool Payments::setPaymentAcknowledgedConfirmedCallback(const uint64_t id) {
+bool Payments::setPaymentAcknowledgedConfirmedCallback(const uint64_t id, const uint64_t confirmations) {
 
-	// Try
-	try {
+	// Check if resetting and clearing set payment acknowledged confirmed callback statement failed
+	if(sqlite3_reset(setPaymentAcknowledgedConfirmedCallbackStatement) != SQLITE_OK || sqlite3_clear_bindings(setPaymentAcknowledgedConfirmedCallbackStatement) != SQLITE_OK) {
 	
-		// Lock
-		lock_guard guard(lock);
-		
-		// Check if resetting and clearing set payment acknowledged confirmed callback statement failed
-		if(sqlite3_reset(setPaymentAcknowledgedConfirmedCallbackStatement) != SQLITE_OK || sqlite3_clear_bindings(setPaymentAcknowledgedConfirmedCallbackStatement) != SQLITE_OK) {
-		
-			// Return false
-			return false;
-		}
-		
-		// Check if binding set payment acknowledged confirmed callback statement's values failed
-		if(sqlite3_bind_int64(setPaymentAcknowledgedConfirmedCallbackStatement, 1, *reinterpret_cast<const int64_t *>(&id)) != SQLITE_OK) {
-		
-			// Return false
-			return false;
-		}
-		
-		// Check if running set payment acknowledged confirmed callback statement failed
-		if(sqlite3_step(setPaymentAcknowledgedConfirmedCallbackStatement) != SQLITE_DONE) {
-		
-			// Reset set payment acknowledged confirmed callback statement
-			sqlite3_reset(setPaymentAcknowledgedConfirmedCallbackStatement);
-			
-			// Return false
-			return false;
-		}
+		// Return false
+		return false;
 	}
 	
-	// Catch errors
-	catch(...) {
+	// Check if binding set payment acknowledged confirmed callback statement's values failed
+	if(sqlite3_bind_int64(setPaymentAcknowledgedConfirmedCallbackStatement, 1, *reinterpret_cast<const int64_t *>(&id)) != SQLITE_OK || sqlite3_bind_int64(setPaymentAcknowledgedConfirmedCallbackStatement, 2, confirmations) != SQLITE_OK) {
 	
 		// Return false
 		return false;
 	}
 	
+	// Check if running set payment acknowledged confirmed callback statement failed
+	if(sqlite3_step(setPaymentAcknowledgedConfirmedCallbackStatement) != SQLITE_DONE) {
+	
+		// Reset set payment acknowledged confirmed callback statement
+		sqlite3_reset(setPaymentAcknowledgedConfirmedCallbackStatement);
+		
+		// Return false
+		return false;
+	}
+	
 	// Return true
 	return true;
 }
@@ -2668,8 +3545,18 @@ list<tuple<uint64_t, optional<string>>> Payments::getUnsuccessfulExpiredCallback
 			throw runtime_error("Running get unsuccessful expired callback payments statement failed");
 		}
 		
-		// Add payment's info to result
+		// Check if payment is claimed
 		const int64_t idStorage = sqlite3_column_int64(getUnsuccessfulExpiredCallbackPaymentsStatement, 0);
+		if(claimedPayments.contains(*reinterpret_cast<const uint64_t *>(&idStorage))) {
+		
+			// Schedule payment's expiration to be checked again once it's no longer being received
+			scheduleExpiration(*reinterpret_cast<const uint64_t *>(&idStorage), time(nullptr) + EXPIRED_CALLBACK_RECHECK_DELAY);
+			
+			// Skip payment since it's being received
+			continue;
+		}
+		
+		// Add payment's info to result
 		result.emplace_back(
 		
 			// ID
@@ -2716,6 +3603,12 @@ bool Payments::setPaymentSuccessfulExpiredCallback(const uint64_t id) {
 			// Return false
 			return false;
 		}
+		
+		// Unschedule payment's expiration
+		unscheduleExpiration(id);
+		
+		// Add payment's change to payment changes
+		addPaymentChange(id, "Expired", 0);
 	}
 	
 	// Catch errors
@@ -2728,3 +3621,477 @@ bool Payments::setPaymentSuccessfulExpiredCallback(const uint64_t id) {
 	// Return true
 	return true;
 }
+
+// Set payment failed callback
+bool Payments::setPaymentFailedCallback(const uint64_t id) {
+
+	// Check if resetting and clearing set payment failed callback statement failed
+	if(sqlite3_reset(setPaymentFailedCallbackStatement) != SQLITE_OK || sqlite3_clear_bindings(setPaymentFailedCallbackStatement) != SQLITE_OK) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if binding set payment failed callback statement's values failed
+	if(sqlite3_bind_int64(setPaymentFailedCallbackStatement, 1, *reinterpret_cast<const int64_t *>(&id)) != SQLITE_OK || sqlite3_bind_int64(setPaymentFailedCallbackStatement, 2, callbackRetryMaximumDelay) != SQLITE_OK || sqlite3_bind_int64(setPaymentFailedCallbackStatement, 3, CALLBACK_RETRY_INITIAL_DELAY) != SQLITE_OK || sqlite3_bind_int64(setPaymentFailedCallbackStatement, 4, CALLBACK_RETRY_MAXIMUM_BACKOFF_EXPONENT) != SQLITE_OK) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Go through the updated payment
+	int sqlResult;
+	while((sqlResult = sqlite3_step(setPaymentFailedCallbackStatement)) != SQLITE_DONE) {
+	
+		// Check if running set payment failed callback statement failed
+		if(sqlResult != SQLITE_ROW) {
+		
+			// Reset set payment failed callback statement
+			sqlite3_reset(setPaymentFailedCallbackStatement);
+			
+			// Return false
+			return false;
+		}
+		
+		// Check if the failed callback was an expired callback
+		if(sqlite3_column_int(setPaymentFailedCallbackStatement, 1)) {
+		
+			// Schedule payment's expiration for its next callback attempt
+			scheduleExpiration(id, sqlite3_column_int64(setPaymentFailedCallbackStatement, 0));
+		}
+	}
+	
+	// Return true
+	return true;
+}
+
+// Load unconfirmed kernel commitments
+void Payments::loadUnconfirmedKernelCommitments() {
+
+	// Check if resetting get unconfirmed kernel commitments statement failed
+	if(sqlite3_reset(getUnconfirmedKernelCommitmentsStatement) != SQLITE_OK) {
+	
+		// Throw exception
+		throw runtime_error("Resetting get unconfirmed kernel commitments statement failed");
+	}
+	
+	// Initialize result
+	unordered_set<string> result;
+	
+	// Go through all unconfirmed kernel commitments
+	int sqlResult;
+	while((sqlResult = sqlite3_step(getUnconfirmedKernelCommitmentsStatement)) != SQLITE_DONE) {
+	
+		// Check if running get unconfirmed kernel commitments statement failed
+		if(sqlResult != SQLITE_ROW) {
+		
+			// Reset get unconfirmed kernel commitments statement
+			sqlite3_reset(getUnconfirmedKernelCommitmentsStatement);
+			
+			// Throw exception
+			throw runtime_error("Running get unconfirmed kernel commitments statement failed");
+		}
+		
+		// Add kernel commitment to result
+		result.emplace(reinterpret_cast<const char *>(sqlite3_column_blob(getUnconfirmedKernelCommitmentsStatement, 0)), sqlite3_column_bytes(getUnconfirmedKernelCommitmentsStatement, 0));
+	}
+	
+	// Set unconfirmed kernel commitments to the result
+	unconfirmedKernelCommitments = move(result);
+}
+
+// Lock read connection
+size_t Payments::lockReadConnection() {
+
+	// Go through all read connections
+	for(size_t i = 0; i < NUMBER_OF_READ_CONNECTIONS; ++i) {
+	
+		// Check if locking read connection was successful
+		if(readConnectionLocks[i].try_lock()) {
+		
+			// Return read connection index
+			return i;
+		}
+	}
+	
+	// Get read connection index that the current thread's ID maps to
+	const size_t readConnectionIndex = hash<thread::id>()(this_thread::get_id()) % NUMBER_OF_READ_CONNECTIONS;
+	
+	// Wait for read connection to be available
+	readConnectionLocks[readConnectionIndex].lock();
+	
+	// Return read connection index
+	return readConnectionIndex;
+}
+
+// Wait for expired payments
+bool Payments::waitForExpiredPayments(const atomic_bool &quit) {
+
+	// Lock expirations
+	unique_lock uniqueLock(expirationsLock);
+	
+	// While not quitting
+	while(!quit.load()) {
+	
+		// Check if the next expiration was rescheduled or unscheduled
+		if(!expirations.empty() && (!scheduledExpirations.contains(expirations.top().second) || scheduledExpirations.at(expirations.top().second) != expirations.top().first)) {
+		
+			// Remove next expiration
+			expirations.pop();
+		}
+		
+		// Otherwise check if no expirations exist
+		else if(expirations.empty()) {
+		
+			// Wait for an expiration to be scheduled
+			expirationsConditionVariable.wait(uniqueLock);
+		}
+		
+		// Otherwise check if the next expiration is due
+		else if(expirations.top().first <= static_cast<uint64_t>(time(nullptr))) {
+		
+			// Go through all due expirations
+			while(!expirations.empty() && expirations.top().first <= static_cast<uint64_t>(time(nullptr))) {
+			
+				// Check if expiration is current
+				const pair<uint64_t, uint64_t> &expiration = expirations.top();
+				if(scheduledExpirations.contains(expiration.second) && scheduledExpirations.at(expiration.second) == expiration.first) {
+				
+					// Unschedule expiration
+					scheduledExpirations.erase(expiration.second);
+				}
+				
+				// Remove expiration
+				expirations.pop();
+			}
+			
+			// Return true
+			return true;
+		}
+		
+		// Otherwise
+		else {
+		
+			// Wait until the next expiration is due or an earlier one is scheduled
+			expirationsConditionVariable.wait_until(uniqueLock, chrono::system_clock::from_time_t(expirations.top().first));
+		}
+	}
+	
+	// Return false
+	return false;
+}
+
+// Stop waiting for expired payments
+void Payments::stopWaitingForExpiredPayments() {
+
+	{
+		// Lock expirations
+		lock_guard guard(expirationsLock);
+	}
+	
+	// Notify waiting threads
+	expirationsConditionVariable.notify_all();
+}
+
+// Get last payment change sequence
+uint64_t Payments::getLastPaymentChangeSequence() {
+
+	// Lock payment changes
+	lock_guard guard(paymentChangesLock);
+	
+	// Return last payment change sequence
+	return nextPaymentChangeSequence - 1;
+}
+
+// Get payment changes
+bool Payments::getPaymentChanges(list<tuple<uint64_t, uint64_t, string, uint64_t>> &changes, const uint64_t afterSequence, const size_t maximumNumberOfChanges) {
+
+	// Lock payment changes
+	lock_guard guard(paymentChangesLock);
+	
+	// Get first payment change sequence
+	const uint64_t firstSequence = nextPaymentChangeSequence - paymentChanges.size();
+	
+	// Check if sequence is before the first payment change or after the last payment change
+	if(afterSequence < firstSequence - 1 || afterSequence >= nextPaymentChangeSequence) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Go through all payment changes after the sequence
+	for(deque<tuple<uint64_t, uint64_t, string, uint64_t>>::const_iterator i = paymentChanges.cbegin() + (afterSequence + 1 - firstSequence); i != paymentChanges.cend() && changes.size() < maximumNumberOfChanges; ++i) {
+	
+		// Add payment change to changes
+		changes.push_back(*i);
+	}
+	
+	// Return true
+	return true;
+}
+
+// Set payment changes listener
+void Payments::setPaymentChangesListener(const function<void()> &listener) {
+
+	// Lock payment changes
+	lock_guard guard(paymentChangesLock);
+	
+	// Set payment changes listener
+	paymentChangesListener = listener;
+}
+
+// Load expirations
+void Payments::loadExpirations() {
+
+	// Initialize result
+	list<pair<uint64_t, uint64_t>> result;
+	
+	// Check if getting unsuccessful expired callback payments' expirations failed
+	if(sqlite3_exec(databaseConnection, "SELECT \"ID\", MAX(\"Expires\", \"Next Callback Attempt\") FROM \"Payments\" WHERE \"Received\" IS NULL AND \"Expired Callback Successful\" = FALSE AND \"Expires\" IS NOT NULL;", [](void *argument, int numberOfRows, char **rows, char **columnNames) -> int {
+	
+		// Get result from argument
+		list<pair<uint64_t, uint64_t>> *result = reinterpret_cast<list<pair<uint64_t, uint64_t>> *>(argument);
+		
+		// Add payment's ID and expiration to result
+		const int64_t idStorage = strtoll(rows[0], nullptr, Common::DECIMAL_NUMBER_BASE);
+		result->emplace_back(*reinterpret_cast<const uint64_t *>(&idStorage), strtoull(rows[1], nullptr, Common::DECIMAL_NUMBER_BASE));
+		
+		// Return success
+		return 0;
+		
+	}, &result, nullptr) != SQLITE_OK) {
+	
+		// Throw exception
+		throw runtime_error("Getting unsuccessful expired callback payments' expirations failed");
+	}
+	
+	// Go through all expirations
+	for(const pair<uint64_t, uint64_t> &expiration : result) {
+	
+		// Schedule expiration
+		scheduleExpiration(expiration.first, expiration.second);
+	}
+}
+
+// Schedule expiration
+void Payments::scheduleExpiration(const uint64_t id, const uint64_t time) {
+
+	{
+		// Lock expirations
+		lock_guard guard(expirationsLock);
+		
+		// Set payment's scheduled expiration
+		scheduledExpirations[id] = time;
+		
+		// Add expiration to expirations
+		expirations.emplace(time, id);
+	}
+	
+	// Notify waiting threads
+	expirationsConditionVariable.notify_all();
+}
+
+// Unschedule expiration
+void Payments::unscheduleExpiration(const uint64_t id) {
+
+	// Lock expirations
+	lock_guard guard(expirationsLock);
+	
+	// Remove payment's scheduled expiration
+	scheduledExpirations.erase(id);
+}
+
+// Insert payment
+uint64_t Payments::insertPayment(const uint64_t id, const char *url, const uint64_t price, const uint32_t requiredConfirmations, const uint32_t timeout, const char *completedCallback, const char *receivedCallback, const char *confirmedCallback, const char *expiredCallback, const char *currencyPrice, const char *notes, uint64_t &expires) {
+
+	// Check if a timeout exists
+	if(timeout) {
+	
+		// Check if resetting and clearing create payment with expiration statement failed
+		if(sqlite3_reset(createPaymentWithExpirationStatement) != SQLITE_OK || sqlite3_clear_bindings(createPaymentWithExpirationStatement) != SQLITE_OK) {
+		
+			// Return zero
+			return 0;
+		}
+		
+		// Check if binding create payment with expiration statement's values failed
+		if(sqlite3_bind_int64(createPaymentWithExpirationStatement, 1, *reinterpret_cast<const int64_t *>(&id)) != SQLITE_OK || sqlite3_bind_text(createPaymentWithExpirationStatement, 2, url, -1, SQLITE_STATIC) != SQLITE_OK || (price ? sqlite3_bind_int64(createPaymentWithExpirationStatement, 3, *reinterpret_cast<const int64_t *>(&price)) : sqlite3_bind_null(createPaymentWithExpirationStatement, 3)) != SQLITE_OK || sqlite3_bind_int64(createPaymentWithExpirationStatement, 4, requiredConfirmations) != SQLITE_OK || sqlite3_bind_int64(createPaymentWithExpirationStatement, 5, timeout) != SQLITE_OK || sqlite3_bind_text(createPaymentWithExpirationStatement, 6, completedCallback, -1, SQLITE_STATIC) != SQLITE_OK || (receivedCallback ? sqlite3_bind_text(createPaymentWithExpirationStatement, 7, receivedCallback, -1, SQLITE_STATIC) : sqlite3_bind_null(createPaymentWithExpirationStatement, 7)) != SQLITE_OK || (confirmedCallback ? sqlite3_bind_text(createPaymentWithExpirationStatement, 8, confirmedCallback, -1, SQLITE_STATIC) : sqlite3_bind_null(createPaymentWithExpirationStatement, 8)) != SQLITE_OK || (expiredCallback ? sqlite3_bind_text(createPaymentWithExpirationStatement, 9, expiredCallback, -1, SQLITE_STATIC) : sqlite3_bind_null(createPaymentWithExpirationStatement, 9)) != SQLITE_OK || (currencyPrice ? sqlite3_bind_text(createPaymentWithExpirationStatement, 10, currencyPrice, -1, SQLITE_STATIC) : sqlite3_bind_null(createPaymentWithExpirationStatement, 10)) != SQLITE_OK || (notes ? sqlite3_bind_text(createPaymentWithExpirationStatement, 11, notes, -1, SQLITE_STATIC) : sqlite3_bind_null(createPaymentWithExpirationStatement, 11)) != SQLITE_OK) {
+		
+			// Return zero
+			return 0;
+		}
+		
+		// Check if running create payment with expiration statement failed
+		if(sqlite3_step(createPaymentWithExpirationStatement) != SQLITE_ROW) {
+		
+			// Reset create payment with expiration statement
+			sqlite3_reset(createPaymentWithExpirationStatement);
+			
+			// Return zero
+			return 0;
+		}
+		
+		// Set expires to the payment's expires
+		expires = sqlite3_column_int64(createPaymentWithExpirationStatement, 0);
+		
+		// Check if running create payment with expiration statement failed
+		if(sqlite3_step(createPaymentWithExpirationStatement) != SQLITE_DONE) {
+		
+			// Reset create payment with expiration statement
+			sqlite3_reset(createPaymentWithExpirationStatement);
+			
+			// Return zero
+			return 0;
+		}
+	}
+	
+	// Otherwise
+	else {
+	
+		// Check if resetting and clearing create payment statement failed
+		if(sqlite3_reset(createPaymentStatement) != SQLITE_OK || sqlite3_clear_bindings(createPaymentStatement) != SQLITE_OK) {
+		
+			// Return zero
+			return 0;
+		}
+		
+		// Check if binding create payment statement's values failed
+		if(sqlite3_bind_int64(createPaymentStatement, 1, *reinterpret_cast<const int64_t *>(&id)) != SQLITE_OK || sqlite3_bind_text(createPaymentStatement, 2, url, -1, SQLITE_STATIC) != SQLITE_OK || (price ? sqlite3_bind_int64(createPaymentStatement, 3, *reinterpret_cast<const int64_t *>(&price)) : sqlite3_bind_null(createPaymentStatement, 3)) != SQLITE_OK || sqlite3_bind_int64(createPaymentStatement, 4, requiredConfirmations) != SQLITE_OK || sqlite3_bind_text(createPaymentStatement, 5, completedCallback, -1, SQLITE_STATIC) != SQLITE_OK || (receivedCallback ? sqlite3_bind_text(createPaymentStatement, 6, receivedCallback, -1, SQLITE_STATIC) : sqlite3_bind_null(createPaymentStatement, 6)) != SQLITE_OK || (confirmedCallback ? sqlite3_bind_text(createPaymentStatement, 7, confirmedCallback, -1, SQLITE_STATIC) : sqlite3_bind_null(createPaymentStatement, 7)) != SQLITE_OK || (currencyPrice ? sqlite3_bind_text(createPaymentStatement, 8, currencyPrice, -1, SQLITE_STATIC) : sqlite3_bind_null(createPaymentStatement, 8)) != SQLITE_OK || (notes ? sqlite3_bind_text(createPaymentStatement, 9, notes, -1, SQLITE_STATIC) : sqlite3_bind_null(createPaymentStatement, 9)) != SQLITE_OK) {
+		
+			// Return zero
+			return 0;
+		}
+		
+		// Check if running create payment statement failed
+		if(sqlite3_step(createPaymentStatement) != SQLITE_DONE) {
+		
+			// Reset create payment statement
+			sqlite3_reset(createPaymentStatement);
+			
+			// Return zero
+			return 0;
+		}
+	}
+	
+	// Return payment's unique number
+	return sqlite3_last_insert_rowid(databaseConnection);
+}
+
+// Get payment info from statement
+tuple<uint64_t, string, optional<uint64_t>, uint64_t, bool, uint64_t, optional<uint64_t>, string> Payments::getPaymentInfoFromStatement(sqlite3_stmt *statement) {
+
+	// Get price storage
+	const int64_t priceStorage = (sqlite3_column_type(statement, 2) == SQLITE_NULL) ? 0 : sqlite3_column_int64(statement, 2);
+	
+	// Return payment's info
+	return tuple<uint64_t, string, optional<uint64_t>, uint64_t, bool, uint64_t, optional<uint64_t>, string>(
+	
+		// Unique number
+		sqlite3_column_int64(statement, 0),
+		
+		// URL
+		reinterpret_cast<const char *>(sqlite3_column_text(statement, 1)),
+		
+		// Price
+		(sqlite3_column_type(statement, 2) == SQLITE_NULL) ? nullopt : optional<uint64_t>(*reinterpret_cast<const uint64_t *>(&priceStorage)),
+		
+		// Required confirmations
+		sqlite3_column_int64(statement, 3),
+		
+		// Received
+		sqlite3_column_type(statement, 4) != SQLITE_NULL,
+		
+		// Confirmations
+		sqlite3_column_int64(statement, 5),
+		
+		// Time remaining
+		(sqlite3_column_type(statement, 6) == SQLITE_NULL) ? nullopt : optional<uint64_t>(sqlite3_column_int64(statement, 6)),
+		
+		// Status
+		reinterpret_cast<const char *>(sqlite3_column_text(statement, 7))
+	);
+}
+
+// Add payment change
+void Payments::addPaymentChange(const uint64_t id, const char *status, const uint64_t confirmations) {
+
+	// Try
+	try {
+	
+		// Add payment change to pending payment changes
+		pendingPaymentChanges.emplace_back(id, status, confirmations);
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Lock payment changes
+		lock_guard guard(paymentChangesLock);
+		
+		// Clear payment changes and skip a sequence so that all existing sequences are expired since the payment change can't be recorded
+		paymentChanges.clear();
+		++nextPaymentChangeSequence;
+		
+		// Return
+		return;
+	}
+	
+	// Check if database is in autocommit mode
+	if(sqlite3_get_autocommit(databaseConnection)) {
+	
+		// Publish payment changes since they're already committed
+		publishPaymentChanges();
+	}
+}
+
+// Publish payment changes
+void Payments::publishPaymentChanges() {
+
+	// Check if pending payment changes exist
+	if(!pendingPaymentChanges.empty()) {
+	
+		{
+			// Lock payment changes
+			lock_guard guard(paymentChangesLock);
+			
+			// Try
+			try {
+			
+				// Go through all pending payment changes
+				for(tuple<uint64_t, string, uint64_t> &pendingPaymentChange : pendingPaymentChanges) {
+				
+					// Check if payment changes is full
+					if(paymentChanges.size() >= MAXIMUM_NUMBER_OF_PAYMENT_CHANGES) {
+					
+						// Remove oldest payment change from payment changes
+						paymentChanges.pop_front();
+					}
+					
+					// Add pending payment change to payment changes
+					paymentChanges.emplace_back(nextPaymentChangeSequence, get<0>(pendingPaymentChange), move(get<1>(pendingPaymentChange)), get<2>(pendingPaymentChange));
+					
+					// Increment next payment change sequence
+					++nextPaymentChangeSequence;
+				}
+			}
+			
+			// Catch errors
+			catch(...) {
+			
+				// Clear payment changes and skip a sequence so that all existing sequences are expired since the payment changes can't be recorded
+				paymentChanges.clear();
+				++nextPaymentChangeSequence;
+			}
+			
+			// Check if payment changes listener exists
+			if(paymentChangesListener) {
+			
+				// Run payment changes listener
+				paymentChangesListener();
+			}
+		}
+		
+		// Clear pending payment changes
+		pendingPaymentChanges.clear();
+	}
+}
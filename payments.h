@@ -4,10 +4,22 @@
 
 
 // Header files
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <getopt.h>
 #include <list>
 #include <mutex>
 #include <optional>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include "./crypto.h"
+#include "./http_client.h"
 #include "sqlite3.h"
 #include "./wallet.h"
 
@@ -23,7 +35,7 @@ class Payments final {
 	public:
 	
 		// Constructor
-		explicit Payments(sqlite3 *databaseConnection);
+		explicit Payments(const unordered_map<char, const char *> &providedOptions, sqlite3 *databaseConnection);
 		
 		// Destructor
 		~Payments();
@@ -70,18 +82,45 @@ class Payments final {
 		// No notes
 		static const char *NO_NOTES;
 		
+		// Get options
+		static vector<option> getOptions();
+		
+		// Display options help
+		static void displayOptionsHelp();
+		
+		// Validate option
+		static bool validateOption(const char option, const char *value, char *argv[]);
+		
 		// Create payment
 		uint64_t createPayment(const uint64_t id, const char *url, const uint64_t price, const uint32_t requiredConfirmations, const uint32_t timeout, const char *completedCallback, const char *receivedCallback, const char *confirmedCallback, const char *expiredCallback, const char *currencyPrice, const char *notes);
 		
+		// Create payments
+		vector<uint64_t> createPayments(const list<tuple<uint64_t, const char *, uint64_t, uint32_t, uint32_t, const char *, const char *, const char *, const char *, const char *, const char *>> &newPayments);
+		
+		// Get next unique number
+		uint64_t getNextUniqueNumber();
+		
 		// Get payment info
 		tuple<uint64_t, string, optional<uint64_t>, uint64_t, bool, uint64_t, optional<uint64_t>, string> getPaymentInfo(const uint64_t id);
 		
+		// Get payments info
+		void getPaymentsInfo(const vector<uint64_t> &ids, const function<void(const uint64_t, const tuple<uint64_t, string, optional<uint64_t>, uint64_t, bool, uint64_t, optional<uint64_t>, string> &)> &callback);
+		
+		// List payments
+		void listPayments(const char *status, const uint64_t createdAfter, const uint64_t createdBefore, const uint64_t afterUniqueNumber, const uint32_t limit, const function<void(const uint64_t, const tuple<uint64_t, string, optional<uint64_t>, uint64_t, bool, uint64_t, optional<uint64_t>, string> &)> &callback);
+		
 		// Get payment price
-		tuple<uint64_t, optional<uint64_t>> getPaymentPrice(const char *url);
+		tuple<uint64_t, optional<uint64_t>, uint64_t> getPaymentPrice(const char *url);
 		
 		// Get receiving payment for URL
 		tuple<uint64_t, uint64_t, optional<uint64_t>, optional<string>, optional<string>> getReceivingPaymentForUrl(const char *url);
 		
+		// Claim payment
+		bool claimPayment(const uint64_t id, const char *url);
+		
+		// Release payment claim
+		void releasePaymentClaim(const uint64_t id);
+		
 		// Display completed payments
 		void displayCompletedPayments(const Wallet &wallet);
 		
@@ -94,8 +133,8 @@ class Payments final {
 		// Get incomplete payments
 		list<tuple<uint64_t, uint64_t, vector<uint8_t>, optional<uint64_t>, vector<uint8_t>, vector<uint8_t>, vector<uint8_t>, vector<uint8_t>>> getIncompletePayments();
 		
-		// Get confirming payments
-		list<tuple<uint64_t, uint64_t, uint64_t>> getConfirmingPayments();
+		// Update confirming payments
+		list<uint64_t> updateConfirmingPayments(const uint64_t height);
 		
 		// Set payment received
 		bool setPaymentReceived(const uint64_t id, const uint64_t price, const char *senderPaymentProofAddress, const uint8_t kernelCommitment[Crypto::COMMITMENT_SIZE], const uint8_t senderPublicBlindExcess[Crypto::SECP256K1_PUBLIC_KEY_SIZE], const uint8_t recipientPartialSignature[Crypto::SECP256K1_SINGLE_SIGNER_SIGNATURE_SIZE], const uint8_t publicNonceSum[Crypto::SECP256K1_PUBLIC_KEY_SIZE], const uint8_t *kernelData, const size_t kernelDataLength, const char *currencyPrice);
@@ -118,29 +157,44 @@ class Payments final {
 		// Rollback transaction
 		bool rollbackTransaction();
 		
-		// Run unsuccessful completed payment callbacks
-		void runUnsuccessfulCompletedPaymentCallbacks();
+		// Get unsuccessful completed callback payments
+		list<tuple<uint64_t, uint64_t, uint64_t, string>> getUnsuccessfulCompletedCallbackPayments();
+		
+		// Get next completed callback attempt
+		optional<uint64_t> getNextCompletedCallbackAttempt(const uint64_t after);
+		
+		// Get pending confirmed callback payments
+		list<tuple<uint64_t, uint64_t, string>> getPendingConfirmedCallbackPayments();
 		
-		// Run pending confirmed payment callbacks
-		void runPendingConfirmedPaymentCallbacks();
+		// Acknowledge payment callbacks
+		bool acknowledgePaymentCallbacks(const list<uint64_t> &successfulCompletedCallbackPayments, const list<uint64_t> &failedCompletedCallbackPayments, const list<pair<uint64_t, uint64_t>> &acknowledgedConfirmedCallbackPayments);
 		
 		// Run unsuccessful expired payment callbacks
-		void runUnsuccessfulExpiredPaymentCallbacks();
+		void runUnsuccessfulExpiredPaymentCallbacks(HttpClient &httpClient, const atomic_bool &quit);
+		
+		// Wait for expired payments
+		bool waitForExpiredPayments(const atomic_bool &quit);
+		
+		// Stop waiting for expired payments
+		void stopWaitingForExpiredPayments();
 		
+		// Get last payment change sequence
+		uint64_t getLastPaymentChangeSequence();
+		
+		// Get payment changes
+		bool getPaymentChanges(list<tuple<uint64_t, uint64_t, string, uint64_t>> &changes, const uint64_t afterSequence, const size_t maximumNumberOfChanges);
+		
+		// Set payment changes listener
+		void setPaymentChangesListener(const function<void()> &listener);
+	
 	// Private
 	private:
 	
-		// Get unsuccessful completed callback payments
-		list<tuple<uint64_t, uint64_t, uint64_t, string>> getUnsuccessfulCompletedCallbackPayments();
-		
 		// Set payment successful completed callback
 		bool setPaymentSuccessfulCompletedCallback(const uint64_t id);
 		
-		// Get pending confirmed callback payments
-		list<tuple<uint64_t, uint64_t, string>> getPendingConfirmedCallbackPayments();
-		
 		// Set payment acknowledged confirmed callback
-		bool setPaymentAcknowledgedConfirmedCallback(const uint64_t id);
+		bool setPaymentAcknowledgedConfirmedCallback(const uint64_t id, const uint64_t confirmations);
 		
 		// Get unsuccessful expired callback payments
 		list<tuple<uint64_t, optional<string>>> getUnsuccessfulExpiredCallbackPayments();
@@ -148,6 +202,36 @@ class Payments final {
 		// Set payment successful expired callback
 		bool setPaymentSuccessfulExpiredCallback(const uint64_t id);
 		
+		// Set payment failed callback
+		bool setPaymentFailedCallback(const uint64_t id);
+		
+		// Load unconfirmed kernel commitments
+		void loadUnconfirmedKernelCommitments();
+		
+		// Lock read connection
+		size_t lockReadConnection();
+		
+		// Load expirations
+		void loadExpirations();
+		
+		// Schedule expiration
+		void scheduleExpiration(const uint64_t id, const uint64_t time);
+		
+		// Unschedule expiration
+		void unscheduleExpiration(const uint64_t id);
+		
+		// Insert payment
+		uint64_t insertPayment(const uint64_t id, const char *url, const uint64_t price, const uint32_t requiredConfirmations, const uint32_t timeout, const char *completedCallback, const char *receivedCallback, const char *confirmedCallback, const char *expiredCallback, const char *currencyPrice, const char *notes, uint64_t &expires);
+		
+		// Get payment info from statement
+		static tuple<uint64_t, string, optional<uint64_t>, uint64_t, bool, uint64_t, optional<uint64_t>, string> getPaymentInfoFromStatement(sqlite3_stmt *statement);
+		
+		// Add payment change
+		void addPaymentChange(const uint64_t id, const char *status, const uint64_t confirmations);
+		
+		// Publish payment changes
+		void publishPaymentChanges();
+		
 		// Database connection
 		sqlite3 *databaseConnection;
 		
@@ -157,33 +241,27 @@ class Payments final {
 		// Create payment with expiration statement
 		sqlite3_stmt *createPaymentWithExpirationStatement;
 		
-		// Get payment info statement
-		sqlite3_stmt *getPaymentInfoStatement;
-		
-		// Get payment price statement
-		sqlite3_stmt *getPaymentPriceStatement;
-		
 		// Get receiving payment for URL statement
 		sqlite3_stmt *getReceivingPaymentForUrlStatement;
 		
-		// Get completed payments statement
-		sqlite3_stmt *getCompletedPaymentsStatement;
-		
-		// Get payment statement
-		sqlite3_stmt *getPaymentStatement;
-		
 		// Get unconfirmed payment statement
 		sqlite3_stmt *getUnconfirmedPaymentStatement;
 		
 		// Get incomplete payments statement
 		sqlite3_stmt *getIncompletePaymentsStatement;
 		
-		// Get confirming payments statement
-		sqlite3_stmt *getConfirmingPaymentsStatement;
+		// Update confirming payments statement
+		sqlite3_stmt *updateConfirmingPaymentsStatement;
+		
+		// Get unconfirmed kernel commitments statement
+		sqlite3_stmt *getUnconfirmedKernelCommitmentsStatement;
 		
 		// Get unsuccessful completed callback payments statement
 		sqlite3_stmt *getUnsuccessfulCompletedCallbackPaymentsStatement;
 		
+		// Get next completed callback attempt statement
+		sqlite3_stmt *getNextCompletedCallbackAttemptStatement;
+		
 		// Get pending confirmed callback payments statement
 		sqlite3_stmt *getPendingConfirmedCallbackPaymentsStatement;
 		
@@ -208,6 +286,9 @@ class Payments final {
 		// Set payment successful expired callback statement
 		sqlite3_stmt *setPaymentSuccessfulExpiredCallbackStatement;
 		
+		// Set payment failed callback statement
+		sqlite3_stmt *setPaymentFailedCallbackStatement;
+		
 		// Begin transaction statement
 		sqlite3_stmt *beginTransactionStatement;
 		
@@ -217,8 +298,83 @@ class Payments final {
 		// Rollback transaction statement
 		sqlite3_stmt *rollbackTransactionStatement;
 		
+		// Callback retry maximum delay
+		uint64_t callbackRetryMaximumDelay;
+		
 		// Lock
 		mutex lock;
+		
+		// Number of read connections
+		static const inline size_t NUMBER_OF_READ_CONNECTIONS = 4;
+		
+		// Read connections
+		array<sqlite3 *, NUMBER_OF_READ_CONNECTIONS> readConnections;
+		
+		// Read connection locks
+		array<mutex, NUMBER_OF_READ_CONNECTIONS> readConnectionLocks;
+		
+		// Get payment info statements
+		array<sqlite3_stmt *, NUMBER_OF_READ_CONNECTIONS> getPaymentInfoStatements;
+		
+		// Get payment price statements
+		array<sqlite3_stmt *, NUMBER_OF_READ_CONNECTIONS> getPaymentPriceStatements;
+		
+		// Get completed payments statements
+		array<sqlite3_stmt *, NUMBER_OF_READ_CONNECTIONS> getCompletedPaymentsStatements;
+		
+		// Get payment statements
+		array<sqlite3_stmt *, NUMBER_OF_READ_CONNECTIONS> getPaymentStatements;
+		
+		// List payments statements
+		array<sqlite3_stmt *, NUMBER_OF_READ_CONNECTIONS> listPaymentsStatements;
+		
+		// List not received payments statements
+		array<sqlite3_stmt *, NUMBER_OF_READ_CONNECTIONS> listNotReceivedPaymentsStatements;
+		
+		// List incomplete payments statements
+		array<sqlite3_stmt *, NUMBER_OF_READ_CONNECTIONS> listIncompletePaymentsStatements;
+		
+		// List completed payments statements
+		array<sqlite3_stmt *, NUMBER_OF_READ_CONNECTIONS> listCompletedPaymentsStatements;
+		
+		// Claimed payments
+		unordered_set<uint64_t> claimedPayments;
+		
+		// Unconfirmed kernel commitments
+		unordered_set<string> unconfirmedKernelCommitments;
+		
+		// Maximum confirmed height
+		uint64_t maximumConfirmedHeight;
+		
+		// Expirations lock
+		mutex expirationsLock;
+		
+		// Expirations condition variable
+		condition_variable expirationsConditionVariable;
+		
+		// Expirations
+		priority_queue<pair<uint64_t, uint64_t>, vector<pair<uint64_t, uint64_t>>, greater<pair<uint64_t, uint64_t>>> expirations;
+		
+		// Scheduled expirations
+		unordered_map<uint64_t, uint64_t> scheduledExpirations;
+		
+		// Pending payment changes
+		list<tuple<uint64_t, string, uint64_t>> pendingPaymentChanges;
+		
+		// Maximum number of payment changes
+		static const inline size_t MAXIMUM_NUMBER_OF_PAYMENT_CHANGES = 10000;
+		
+		// Payment changes lock
+		mutex paymentChangesLock;
+		
+		// Payment changes
+		deque<tuple<uint64_t, uint64_t, string, uint64_t>> paymentChanges;
+		
+		// Next payment change sequence
+		uint64_t nextPaymentChangeSequence;
+		
+		// Payment changes listener
+		function<void()> paymentChangesListener;
 };
 
 
@@ -3,8 +3,8 @@
 #include <signal.h>
 #include <syncstream>
 #include "./common.h"
+#include "./decimal.h"
 #include "event2/thread.h"
-#include "mpfr.h"
 #include "./price.h"
 #include "./price_oracles/ascendex.h"
 #include "./price_oracles/coingecko.h"
@@ -27,11 +27,20 @@ static const time_t DEFAULT_UPDATE_INTERVAL = 1 * Common::MINUTES_IN_AN_HOUR * C
 // Default average length
 static const size_t DEFAULT_AVERAGE_LENGTH = 1 * Common::DAYS_IN_A_WEEK * Common::HOURS_IN_A_DAY * Common::MINUTES_IN_AN_HOUR * Common::SECONDS_IN_A_MINUTE / DEFAULT_UPDATE_INTERVAL;
 
+// Default request deadline
+static const time_t DEFAULT_REQUEST_DEADLINE = 10;
+
+// Default request quorum
+static const size_t DEFAULT_REQUEST_QUORUM = 3;
+
+// Retry update interval
+static const time_t RETRY_UPDATE_INTERVAL = 1;
+
 
 // Supporting function implementation
 
 // Constructor
-Price::Price(const unordered_map<char, const char *> &providedOptions, const TorProxy &torProxy) :
+Price::Price(const unordered_map<char, const char *> &providedOptions, const TorProxy &torProxy, Payments &payments, sqlite3 *databaseConnection) :
 
 	// Set started
 	started(false),
@@ -39,8 +48,32 @@ Price::Price(const unordered_map<char, const char *> &providedOptions, const Tor
 	// Set failed
 	failed(false),
 	
+	// Set payments
+	payments(payments),
+	
+	// Set previous update
+	previousUpdate(chrono::seconds(0)),
+	
+	// Set save price statement
+	savePriceStatement(nullptr),
+	
+	// Set remove stale prices statement
+	removeStalePricesStatement(nullptr),
+	
+	// Set number of price oracle responses
+	numberOfPriceOracleResponses(0),
+	
+	// Set number of new price oracle prices
+	numberOfNewPriceOraclePrices(0),
+	
+	// Set updating current price
+	updatingCurrentPrice(false),
+	
 	// Set event base
-	eventBase(nullptr, event_base_free)
+	eventBase(nullptr, event_base_free),
+	
+	// Set request deadline event
+	requestDeadlineEvent(nullptr, event_free)
 {
 
 	// Display message
@@ -60,6 +93,20 @@ Price::Price(const unordered_map<char, const char *> &providedOptions, const Tor
 		throw runtime_error("Price average length can't be used when price is disabled");
 	}
 	
+	// Check if request deadline is provided and disabling price
+	if(providedOptions.contains('D') && providedOptions.contains('q')) {
+	
+		// Throw exception
+		throw runtime_error("Price request deadline can't be used when price is disabled");
+	}
+	
+	// Check if request quorum is provided and disabling price
+	if(providedOptions.contains('Q') && providedOptions.contains('q')) {
+	
+		// Throw exception
+		throw runtime_error("Price request quorum can't be used when price is disabled");
+	}
+	
 	// Check if enabling threads support failed
 	if(evthread_use_pthreads()) {
 	
@@ -85,6 +132,91 @@ Price::Price(const unordered_map<char, const char *> &providedOptions, const Tor
 	// Add XT price oracle to list
 	priceOracles.emplace_back(make_unique<Xt>(torProxy));
 	
+	// Initialize price oracle prices
+	priceOraclePrices.resize(priceOracles.size(), {chrono::time_point<chrono::system_clock>(chrono::seconds(0)), "0"});
+	
+	// Initialize price oracles finished
+	priceOraclesFinished.resize(priceOracles.size(), false);
+	
+	// Get request deadline from provided options
+	requestDeadline = providedOptions.contains('D') ? strtoull(providedOptions.at('D'), nullptr, Common::DECIMAL_NUMBER_BASE) : DEFAULT_REQUEST_DEADLINE;
+	
+	// Get request quorum from provided options
+	requestQuorum = providedOptions.contains('Q') ? strtoul(providedOptions.at('Q'), nullptr, Common::DECIMAL_NUMBER_BASE) : DEFAULT_REQUEST_QUORUM;
+	
+	// Check if request quorum is invalid
+	if(requestQuorum > priceOracles.size()) {
+	
+		// Throw exception
+		throw runtime_error("Price request quorum can't be greater than the number of price oracles (" + to_string(priceOracles.size()) + ')');
+	}
+	
+	// Get update internal from provided options
+	updateInterval = providedOptions.contains('f') ? strtoull(providedOptions.at('f'), nullptr, Common::DECIMAL_NUMBER_BASE) : DEFAULT_UPDATE_INTERVAL;
+	
+	// Get average length from provided options
+	averageLength = providedOptions.contains('j') ? strtoul(providedOptions.at('j'), nullptr, Common::DECIMAL_NUMBER_BASE) : DEFAULT_AVERAGE_LENGTH;
+	
+	// Get prices duration from the update interval and average length
+	pricesDuration = (updateInterval > numeric_limits<int64_t>::max() / static_cast<int64_t>(averageLength)) ? numeric_limits<int64_t>::max() : updateInterval * averageLength;
+	
+	// Automatically free save price statement
+	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> savePriceStatementUniquePointer(nullptr, sqlite3_finalize);
+	
+	// Automatically free remove stale prices statement
+	unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> removeStalePricesStatementUniquePointer(nullptr, sqlite3_finalize);
+	
+	// Check if not disabling price
+	if(!providedOptions.contains('q')) {
+	
+		// Lock payments since the database connection is shared with it
+		lock_guard guard(payments.getLock());
+	
+		// Check if creating prices table in the database failed
+		if(sqlite3_exec(databaseConnection, "CREATE TABLE IF NOT EXISTS \"Prices\" ("
+		
+			// ID (Used to order prices)
+			"\"ID\" INTEGER NOT NULL PRIMARY KEY AUTOINCREMENT CHECK(\"ID\" > 0),"
+			
+			// Created (Timestamp when the price was obtained)
+			"\"Created\" INTEGER NOT NULL DEFAULT(UNIXEPOCH('now')),"
+			
+			// Timestamp (Timestamp of the newest price oracle price used to get the price)
+			"\"Timestamp\" INTEGER NOT NULL,"
+			
+			// Price (Price of currency)
+			"\"Price\" TEXT NOT NULL CHECK(\"Price\" != '')"
+			
+		") STRICT;", nullptr, nullptr, nullptr) != SQLITE_OK) {
+		
+			// Throw exception
+			throw runtime_error("Creating prices table in the database failed");
+		}
+		
+		// Check if preparing save price statement failed
+		if(sqlite3_prepare_v3(databaseConnection, "INSERT INTO \"Prices\" (\"Timestamp\", \"Price\") VALUES (?, ?);", -1, SQLITE_PREPARE_PERSISTENT, &savePriceStatement, nullptr) != SQLITE_OK) {
+		
+			// Throw exception
+			throw runtime_error("Preparing save price statement failed");
+		}
+		
+		// Automatically free save price statement
+		savePriceStatementUniquePointer.reset(savePriceStatement);
+		
+		// Check if preparing remove stale prices statement failed
+		if(sqlite3_prepare_v3(databaseConnection, "DELETE FROM \"Prices\" WHERE \"Created\" <= UNIXEPOCH('now') - ?2 OR \"ID\" NOT IN (SELECT \"ID\" FROM \"Prices\" ORDER BY \"ID\" DESC LIMIT ?1);", -1, SQLITE_PREPARE_PERSISTENT, &removeStalePricesStatement, nullptr) != SQLITE_OK) {
+		
+			// Throw exception
+			throw runtime_error("Preparing remove stale prices statement failed");
+		}
+		
+		// Automatically free remove stale prices statement
+		removeStalePricesStatementUniquePointer.reset(removeStalePricesStatement);
+		
+		// Set previous update to when the most recent price was loaded
+		previousUpdate = loadPrices(databaseConnection);
+	}
+	
 	// Check if creating event base failed
 	eventBase = unique_ptr<event_base, decltype(&event_base_free)>(event_base_new(), event_base_free);
 	if(!eventBase) {
@@ -93,6 +225,38 @@ Price::Price(const unordered_map<char, const char *> &providedOptions, const Tor
 		throw runtime_error("Creating price event base failed");
 	}
 	
+	// Check if creating request deadline event failed
+	requestDeadlineEvent = unique_ptr<event, decltype(&event_free)>(evtimer_new(eventBase.get(), [](const evutil_socket_t fileDescriptor, const short signal, void *argument) {
+	
+		// Get self from argument
+		Price *self = reinterpret_cast<Price *>(argument);
+		
+		// Go through all price oracles
+		size_t index = 0;
+		for(const unique_ptr<PriceOracle> &priceOracle : self->priceOracles) {
+		
+			// Check if price oracle didn't finish before the deadline
+			if(!self->priceOraclesFinished[index]) {
+			
+				// Abandon price oracle's requests
+				priceOracle->cancelGettingPrice();
+			}
+			
+			// Increment index
+			++index;
+		}
+		
+		// Finish updating current price
+		self->finishUpdatingCurrentPrice();
+	
+	}, this), event_free);
+	
+	if(!requestDeadlineEvent) {
+	
+		// Throw exception
+		throw runtime_error("Creating price request deadline event failed");
+	}
+	
 	// Try
 	try {
 	
@@ -117,12 +281,6 @@ Price::Price(const unordered_map<char, const char *> &providedOptions, const Tor
 		exit(EXIT_FAILURE);
 	}
 	
-	// Get update internal from provided options
-	updateInterval = providedOptions.contains('f') ? strtoull(providedOptions.at('f'), nullptr, Common::DECIMAL_NUMBER_BASE) : DEFAULT_UPDATE_INTERVAL;
-	
-	// Get average length from provided options
-	averageLength = providedOptions.contains('j') ? strtoul(providedOptions.at('j'), nullptr, Common::DECIMAL_NUMBER_BASE) : DEFAULT_AVERAGE_LENGTH;
-	
 	// Get disable from provided options
 	const bool disable = providedOptions.contains('q');
 	
@@ -150,6 +308,20 @@ Price::Price(const unordered_map<char, const char *> &providedOptions, const Tor
 			osyncstream(cout) << "Using provided price average length: " << averageLength << endl;
 		}
 		
+		// Check if a price request deadline is provided
+		if(providedOptions.contains('D')) {
+		
+			// Display message
+			osyncstream(cout) << "Using provided price request deadline: " << requestDeadline << endl;
+		}
+		
+		// Check if a price request quorum is provided
+		if(providedOptions.contains('Q')) {
+		
+			// Display message
+			osyncstream(cout) << "Using provided price request quorum: " << requestQuorum << endl;
+		}
+		
 		// Display message
 		osyncstream(cout) << "Getting price" << flush;
 		
@@ -210,6 +382,12 @@ Price::Price(const unordered_map<char, const char *> &providedOptions, const Tor
 		osyncstream(cout) << endl << "Got price" << endl;
 	}
 	
+	// Release remove stale prices statement
+	removeStalePricesStatementUniquePointer.release();
+	
+	// Release save price statement
+	savePriceStatementUniquePointer.release();
+	
 	// Display message
 	osyncstream(cout) << "Price started" << endl;
 }
@@ -254,6 +432,33 @@ Price::~Price() {
 		exit(EXIT_FAILURE);
 	}
 	
+	// Go through all price oracles
+	for(const unique_ptr<PriceOracle> &priceOracle : priceOracles) {
+	
+		// Abandon price oracle's requests since they use the event base
+		priceOracle->cancelGettingPrice();
+	}
+	
+	// Check if freeing save price statement failed
+	if(sqlite3_finalize(savePriceStatement) != SQLITE_OK) {
+	
+		// Display message
+		osyncstream(cout) << "Freeing save price statement failed" << endl;
+		
+		// Set error occurred
+		Common::setErrorOccurred();
+	}
+	
+	// Check if freeing remove stale prices statement failed
+	if(sqlite3_finalize(removeStalePricesStatement) != SQLITE_OK) {
+	
+		// Display message
+		osyncstream(cout) << "Freeing remove stale prices statement failed" << endl;
+		
+		// Set error occurred
+		Common::setErrorOccurred();
+	}
+	
 	// Check if started
 	if(started.load()) {
 	
@@ -292,6 +497,12 @@ vector<option> Price::getOptions() {
 		// Price average length
 		{"price_average_length", required_argument, nullptr, 'j'},
 		
+		// Price request deadline
+		{"price_request_deadline", required_argument, nullptr, 'D'},
+		
+		// Price request quorum
+		{"price_request_quorum", required_argument, nullptr, 'Q'},
+		
 		// Price disable
 		{"price_disable", no_argument, nullptr, 'q'}
 	};
@@ -303,6 +514,8 @@ void Price::displayOptionsHelp() {
 	// Display message
 	cout << "\t-f, --price_update_interval\tSets the interval in seconds for updating the price (default: " << DEFAULT_UPDATE_INTERVAL << ')' << endl;
 	cout << "\t-j, --price_average_length\tSets the number of previous prices used when determining the average price (default: " << DEFAULT_AVERAGE_LENGTH << ')' << endl;
+	cout << "\t-D, --price_request_deadline\tSets the number of seconds to wait for price oracles to respond before using the prices that have arrived, including while waiting for the quorum (default: " << DEFAULT_REQUEST_DEADLINE << ')' << endl;
+	cout << "\t-Q, --price_request_quorum\tSets the minimum number of price oracles that must respond before the request deadline for the price to be updated (default: " << DEFAULT_REQUEST_QUORUM << ')' << endl;
 	cout << "\t-q, --price_disable\t\tDisables the price API" << endl;
 }
 
@@ -351,6 +564,46 @@ bool Price::validateOption(const char option, const char *value, char *argv[]) {
 			// Break
 			break;
 		}
+		
+		// Price request deadline
+		case 'D': {
+		
+			// Check if price request deadline is invalid
+			char *end;
+			errno = 0;
+			const unsigned long long requestDeadline = value ? strtoull(value, &end, Common::DECIMAL_NUMBER_BASE) : 0;
+			if(!value || end == value || *end || !isdigit(value[0]) || (value[0] == '0' && isdigit(value[1])) || errno || !requestDeadline || requestDeadline > numeric_limits<time_t>::max()) {
+			
+				// Display message
+				cout << argv[0] << ": invalid price request deadline -- '" << (value ? value : "") << '\'' << endl;
+		
+				// Return false
+				return false;
+			}
+			
+			// Break
+			break;
+		}
+		
+		// Price request quorum
+		case 'Q': {
+		
+			// Check if price request quorum is invalid
+			char *end;
+			errno = 0;
+			const unsigned long requestQuorum = value ? strtoul(value, &end, Common::DECIMAL_NUMBER_BASE) : 0;
+			if(!value || end == value || *end || !isdigit(value[0]) || (value[0] == '0' && isdigit(value[1])) || errno || !requestQuorum || requestQuorum > numeric_limits<uint8_t>::max()) {
+			
+				// Display message
+				cout << argv[0] << ": invalid price request quorum -- '" << (value ? value : "") << '\'' << endl;
+		
+				// Return false
+				return false;
+			}
+			
+			// Break
+			break;
+		}
 	}
 	
 	// Return true
@@ -369,8 +622,8 @@ void Price::run(const unordered_map<char, const char *> &providedOptions) {
 			// Get self from argument
 			Price *self = reinterpret_cast<Price *>(argument);
 			
-			// Update current price
-			self->updateCurrentPrice();
+			// Start updating current price
+			self->startUpdatingCurrentPrice();
 			
 		}, this), event_free);
 		
@@ -400,16 +653,27 @@ void Price::run(const unordered_map<char, const char *> &providedOptions) {
 				throw runtime_error("Configuring price timer event failed");
 			}
 			
-			// While updating current price fails
-			while(!updateCurrentPrice()) {
+			// Check if the loaded prices are older than the update interval
+			if(chrono::duration_cast<chrono::seconds>(chrono::system_clock::now() - previousUpdate).count() >= updateInterval) {
+			
+				// Start updating current price
+				startUpdatingCurrentPrice();
+			}
+			
+			// Otherwise
+			else {
 			
-				// Sleep
-				sleep(1);
+				// Set started
+				started.store(true);
 			}
 		}
 		
-		// Set started
-		started.store(true);
+		// Otherwise
+		else {
+		
+			// Set started
+			started.store(true);
+		}
 		
 		// Check if running event loop failed
 		if(event_base_dispatch(eventBase.get()) == -1) {
@@ -460,18 +724,177 @@ void Price::run(const unordered_map<char, const char *> &providedOptions) {
 	}
 }
 
-// Update current price
-bool Price::updateCurrentPrice() {
+// Start updating current price
+void Price::startUpdatingCurrentPrice() {
 
-	// Initialize new prices
-	pair<chrono::time_point<chrono::system_clock>, string> newPrices[priceOracles.size()];
+	// Check if already updating current price
+	if(updatingCurrentPrice) {
+	
+		// Return
+		return;
+	}
+	
+	// Set updating current price
+	updatingCurrentPrice = true;
+	
+	// Reset number of price oracle responses
+	numberOfPriceOracleResponses = 0;
+
+	// Reset number of new price oracle prices
+	numberOfNewPriceOraclePrices = 0;
 	
 	// Go through all price oracles
 	size_t index = 0;
 	for(const unique_ptr<PriceOracle> &priceOracle : priceOracles) {
 	
-		// Get price oracle's new price
-		newPrices[index++] = priceOracle->getPrice();
+		// Clear price oracle finished
+		priceOraclesFinished[index] = false;
+		
+		// Get price oracle
+		PriceOracle *currentPriceOracle = priceOracle.get();
+		
+		// Check if starting getting price oracle's new price concurrently with the other price oracles failed
+		if(!currentPriceOracle->startGettingPrice(eventBase.get(), [this, index, currentPriceOracle]() {
+		
+			// Price oracle finished
+			priceOracleFinished(index, currentPriceOracle);
+		})) {
+		
+			// Price oracle finished
+			priceOracleFinished(index, currentPriceOracle);
+		}
+		
+		// Increment index
+		++index;
+	}
+	
+	// Check if still updating current price
+	if(updatingCurrentPrice) {
+	
+		// Set deadline
+		const timeval deadline = {
+		
+			// Seconds
+			.tv_sec = requestDeadline
+		};
+		
+		// Check if configuring request deadline event failed
+		if(evtimer_add(requestDeadlineEvent.get(), &deadline)) {
+		
+			// Go through all price oracles
+			for(const unique_ptr<PriceOracle> &priceOracle : priceOracles) {
+			
+				// Abandon price oracle's requests
+				priceOracle->cancelGettingPrice();
+			}
+			
+			// Finish updating current price
+			finishUpdatingCurrentPrice();
+		}
+	}
+}
+	
+// Price oracle finished
+void Price::priceOracleFinished(const size_t index, PriceOracle *priceOracle) {
+
+	// Check if not updating current price or price oracle already finished
+	if(!updatingCurrentPrice || priceOraclesFinished[index]) {
+	
+		// Return
+		return;
+	}
+				
+	// Set price oracle finished
+	priceOraclesFinished[index] = true;
+	
+	// Get price oracle's result
+	const pair newPrice = priceOracle->getPrice();
+	
+	// Check if price oracle obtained a new price since its request succeeded
+	if(newPrice.first > priceOraclePrices[index].first) {
+	
+		// Increment number of new price oracle prices
+		++numberOfNewPriceOraclePrices;
+	}
+	
+	// Set price oracle's price to its result
+	priceOraclePrices[index] = newPrice;
+	
+	// Increment number of price oracle responses
+	++numberOfPriceOracleResponses;
+	
+	// Check if all price oracles finished
+	if(numberOfPriceOracleResponses == priceOracles.size()) {
+	
+		// Finish updating current price
+		finishUpdatingCurrentPrice();
+	}
+}
+
+// Finish updating current price
+void Price::finishUpdatingCurrentPrice() {
+
+	// Check if not updating current price
+	if(!updatingCurrentPrice) {
+	
+		// Return
+		return;
+	}
+	
+	// Remove request deadline event
+	evtimer_del(requestDeadlineEvent.get());
+	
+	// Clear updating current price
+	updatingCurrentPrice = false;
+	
+	// Check if enough price oracles obtained new prices before the deadline and updating current price was successful
+	if(numberOfNewPriceOraclePrices >= requestQuorum && updateCurrentPrice()) {
+	
+		// Set started
+		started.store(true);
+	}
+	
+	// Otherwise check if not started
+	else if(!started.load()) {
+	
+		// Set retry timer
+		const timeval retryTimer = {
+		
+			// Seconds
+			.tv_sec = RETRY_UPDATE_INTERVAL
+		};
+		
+		// Check if scheduling retrying updating current price failed
+		if(event_base_once(eventBase.get(), -1, EV_TIMEOUT, [](const evutil_socket_t fileDescriptor, const short signal, void *argument) {
+		
+			// Get self from argument
+			Price *self = reinterpret_cast<Price *>(argument);
+			
+			// Start updating current price
+			self->startUpdatingCurrentPrice();
+		
+		}, this, &retryTimer)) {
+		
+			// Set failed
+			failed.store(true);
+			
+			// Exit event loop
+			event_base_loopbreak(eventBase.get());
+		}
+	}
+}
+
+// Update current price
+bool Price::updateCurrentPrice() {
+	
+	// Initialize new prices
+	pair<chrono::time_point<chrono::system_clock>, string> newPrices[priceOracles.size()];
+	
+	// Go through all price oracle prices
+	for(size_t i = 0; i < priceOraclePrices.size(); ++i) {
+	
+		// Set new price to the price oracle's most recent price
+		newPrices[i] = priceOraclePrices[i];
 	}
 	
 	// Sort new prices
@@ -492,11 +915,7 @@ bool Price::updateCurrentPrice() {
 	const chrono::time_point<chrono::system_clock> timestampThreshold = (chrono::seconds(updateInterval) <= chrono::duration_cast<chrono::seconds>(newPrices[0].first.time_since_epoch())) ? newPrices[0].first - chrono::seconds(updateInterval) : chrono::time_point<chrono::system_clock>(chrono::seconds(0));
 	
 	// Initialize total timestamp
-	mpz_t totalTimestamp;
-	mpz_init(totalTimestamp);
-	
-	// Automatically free total timestamp
-	const unique_ptr<remove_pointer<mpz_ptr>::type, decltype(&mpz_clear)> totalTimestampUniquePointer(totalTimestamp, mpz_clear);
+	uint64_t totalTimestamp = 0;
 	
 	// Go through all new prices
 	for(size_t i = 0; i < priceOracles.size(); ++i) {
@@ -508,109 +927,71 @@ bool Price::updateCurrentPrice() {
 			break;
 		}
 		
-		// Update total timestamp
-		mpz_add_ui(totalTimestamp, totalTimestamp, chrono::duration_cast<chrono::seconds>(newPrices[i].first - timestampThreshold).count());
+		// Get new price's timestamp above the timestamp threshold
+		const uint64_t timestamp = chrono::duration_cast<chrono::seconds>(newPrices[i].first - timestampThreshold).count();
 		
-		// Check if result is invalid
-		if(mpz_sgn(totalTimestamp) <= 0) {
+		// Check if updating total timestamp would overflow
+		if(totalTimestamp > numeric_limits<uint64_t>::max() - timestamp) {
 		
 			// Return false
 			return false;
 		}
+		
+		// Update total timestamp
+		totalTimestamp += timestamp;
 	}
 	
-	// Initialize new price number
-	mpfr_t newPriceNumber;
-	mpfr_init2(newPriceNumber, Common::MPFR_PRECISION);
-	mpfr_set_zero(newPriceNumber, true);
+	// Check if total timestamp is invalid
+	if(!totalTimestamp) {
+	
+		// Return false
+		return false;
+	}
 	
-	// Automatically free new price number
-	const unique_ptr<remove_pointer<mpfr_ptr>::type, decltype(&mpfr_clear)> newPriceNumberUniquePointer(newPriceNumber, mpfr_clear);
+	// Initialize new price number
+	Decimal newPriceNumber;
 	
 	// Initialize precision
 	size_t precision = 0;
 	
-	// Go through all new prices
-	mpfr_t weightedPrice;
-	mpfr_init2(weightedPrice, Common::MPFR_PRECISION);
-	const unique_ptr<remove_pointer<mpfr_ptr>::type, decltype(&mpfr_clear)> weightedPriceUniquePointer(weightedPrice, mpfr_clear);
-	for(size_t i = 0; i < priceOracles.size(); ++i) {
+	// Try
+	try {
 	
-		// Check if new price is too old
-		if(newPrices[i].first <= timestampThreshold) {
-		
-			// Break
-			break;
-		}
-		
-		// Check setting weighted price failed
-		if(mpfr_set_str(weightedPrice, newPrices[i].second.c_str(), Common::DECIMAL_NUMBER_BASE, MPFR_RNDN) || mpfr_sgn(weightedPrice) < 0) {
-		
-			// Return false
-			return false;
-		}
+		// Go through all new prices
+		for(size_t i = 0; i < priceOracles.size(); ++i) {
 		
-		// Multiply weighted price by the new price's timestamp above the timestamp threshold
-		mpfr_mul_ui(weightedPrice, weightedPrice, chrono::duration_cast<chrono::seconds>(newPrices[i].first - timestampThreshold).count(), MPFR_RNDN);
-		
-		// Check if result is invalid
-		if(mpfr_sgn(weightedPrice) < 0) {
-		
-			// Return false
-			return false;
-		}
-		
-		// Divide weighted price by the total timestamp
-		mpfr_div_z(weightedPrice, weightedPrice, totalTimestamp, MPFR_RNDA);
-		
-		// Check if result is invalid
-		if(mpfr_sgn(weightedPrice) < 0) {
-		
-			// Return false
-			return false;
-		}
-		
-		// Add weighted price to new price number
-		mpfr_add(newPriceNumber, newPriceNumber, weightedPrice, MPFR_RNDN);
-		
-		// Check if result is invalid
-		if(mpfr_sgn(newPriceNumber) < 0) {
-		
-			// Return false
-			return false;
-		}
-		
-		// Check if new price has a decimal
-		const size_t decimal = newPrices[i].second.find('.');
-		if(decimal != string_view::npos) {
-		
-			// Update precision
-			precision = max(precision, newPrices[i].second.size() - (decimal + sizeof('.')));
+			// Check if new price is too old
+			if(newPrices[i].first <= timestampThreshold) {
+			
+				// Break
+				break;
+			}
+			
+			// Get weighted price by multiplying the new price by its timestamp above the timestamp threshold and dividing by the total timestamp
+			const Decimal weightedPrice = (Decimal(newPrices[i].second.c_str()) * Decimal(static_cast<uint64_t>(chrono::duration_cast<chrono::seconds>(newPrices[i].first - timestampThreshold).count()))).divide(Decimal(totalTimestamp), Decimal::MAXIMUM_SCALE);
+			
+			// Add weighted price to new price number
+			newPriceNumber = newPriceNumber + weightedPrice;
+			
+			// Check if new price has a decimal
+			const size_t decimal = newPrices[i].second.find('.');
+			if(decimal != string_view::npos) {
+			
+				// Update precision
+				precision = max(precision, newPrices[i].second.size() - (decimal + sizeof('.')));
+			}
 		}
 	}
 	
-	// Check if new price number is invalid
-	if(mpfr_sgn(newPriceNumber) < 0) {
-	
-		// Return false
-		return false;
-	}
-	
-	// Check if getting new price size failed
-	const int newPriceSize = mpfr_snprintf(nullptr, 0, ("%." + to_string(precision) + "R*F").c_str(), MPFR_RNDN, newPriceNumber);
-	if(newPriceSize <= 0) {
+	// Catch errors
+	catch(...) {
 	
 		// Return false
 		return false;
 	}
 	
-	// Check if getting new price failed
-	string newPrice(newPriceSize, '\0');
-	if(mpfr_sprintf(newPrice.data(), ("%." + to_string(precision) + "R*F").c_str(), MPFR_RNDN, newPriceNumber) != newPriceSize) {
-	
-		// Return false
-		return false;
-	}
+	// Get new price
+	string newPrice = newPriceNumber.toString(precision);
 	
 	// Check if new price isn't zero and it has precision
 	if(newPrice != "0" && precision) {
@@ -641,6 +1022,9 @@ bool Price::updateCurrentPrice() {
 		}
 	#endif
 	
+	// Save new price so that it's available after restarting
+	savePrice(newPrices[0].first, newPrice);
+	
 	// Add new price to list
 	prices.emplace_back(move(newPrice));
 	
@@ -651,74 +1035,50 @@ bool Price::updateCurrentPrice() {
 		prices.pop_front();
 	}
 	
+	// Return if updating average price was successful
+	return updateAveragePrice();
+}
+
+// Update average price
+bool Price::updateAveragePrice() {
+
 	// Initialize average price
-	mpfr_t averagePrice;
-	mpfr_init2(averagePrice, Common::MPFR_PRECISION);
-	mpfr_set_zero(averagePrice, true);
-	
-	// Automatically free average price
-	const unique_ptr<remove_pointer<mpfr_ptr>::type, decltype(&mpfr_clear)> averagePriceUniquePointer(averagePrice, mpfr_clear);
+	Decimal averagePrice;
 	
 	// Initialize precision
-	precision = 0;
+	size_t precision = 0;
 	
-	// Go through all prices
-	mpfr_t priceNumber;
-	mpfr_init2(priceNumber, Common::MPFR_PRECISION);
-	const unique_ptr<remove_pointer<mpfr_ptr>::type, decltype(&mpfr_clear)> priceNumberUniquePointer(priceNumber, mpfr_clear);
-	for(const string &price : prices) {
+	// Try
+	try {
 	
-		// Check setting price number failed
-		if(mpfr_set_str(priceNumber, price.c_str(), Common::DECIMAL_NUMBER_BASE, MPFR_RNDN) || mpfr_sgn(priceNumber) < 0) {
+		// Go through all prices
+		for(const string &price : prices) {
 		
-			// Return false
-			return false;
-		}
-		
-		// Add price number to average price
-		mpfr_add(averagePrice, averagePrice, priceNumber, MPFR_RNDN);
-		
-		// Check if result is invalid
-		if(mpfr_sgn(averagePrice) < 0) {
-		
-			// Return false
-			return false;
+			// Add price to average price
+			averagePrice = averagePrice + Decimal(price.c_str());
+			
+			// Check if price has a decimal
+			const size_t decimal = price.find('.');
+			if(decimal != string_view::npos) {
+			
+				// Update precision
+				precision = max(precision, price.size() - (decimal + sizeof('.')));
+			}
 		}
 		
-		// Check if price has a decimal
-		const size_t decimal = price.find('.');
-		if(decimal != string_view::npos) {
-		
-			// Update precision
-			precision = max(precision, price.size() - (decimal + sizeof('.')));
-		}
+		// Divide average price by the number of prices
+		averagePrice = averagePrice.divide(Decimal(static_cast<uint64_t>(prices.size())), Decimal::MAXIMUM_SCALE);
 	}
 	
-	// Divide average price by the number of prices
-	mpfr_div_ui(averagePrice, averagePrice, prices.size(), MPFR_RNDA);
-	
-	// Check if result is invalid
-	if(mpfr_sgn(averagePrice) < 0) {
-	
-		// Return false
-		return false;
-	}
-	
-	// Check if getting result size failed
-	const int resultSize = mpfr_snprintf(nullptr, 0, ("%." + to_string(precision) + "R*F").c_str(), MPFR_RNDN, averagePrice);
-	if(resultSize <= 0) {
+	// Catch errors
+	catch(...) {
 	
 		// Return false
 		return false;
 	}
 	
-	// Check if getting result failed
-	string result(resultSize, '\0');
-	if(mpfr_sprintf(result.data(), ("%." + to_string(precision) + "R*F").c_str(), MPFR_RNDN, averagePrice) != resultSize) {
-	
-		// Return false
-		return false;
-	}
+	// Get result
+	string result = averagePrice.toString(precision);
 	
 	// Check if result isn't zero and it has precision
 	if(result != "0" && precision) {
@@ -769,3 +1129,136 @@ bool Price::updateCurrentPrice() {
 	// Return true
 	return true;
 }
+
+// Load prices
+chrono::time_point<chrono::system_clock> Price::loadPrices(sqlite3 *databaseConnection) {
+
+	// Initialize result
+	chrono::time_point<chrono::system_clock> result(chrono::seconds(0));
+	
+	// Check if removing stale prices failed
+	if(sqlite3_bind_int64(removeStalePricesStatement, 1, averageLength) != SQLITE_OK || sqlite3_bind_int64(removeStalePricesStatement, 2, pricesDuration) != SQLITE_OK || sqlite3_step(removeStalePricesStatement) != SQLITE_DONE) {
+	
+		// Reset remove stale prices statement
+		sqlite3_reset(removeStalePricesStatement);
+		
+		// Throw exception
+		throw runtime_error("Removing stale prices failed");
+	}
+	
+	// Reset remove stale prices statement
+	sqlite3_reset(removeStalePricesStatement);
+	
+	// Check if preparing get prices statement failed
+	sqlite3_stmt *getPricesStatement;
+	if(sqlite3_prepare_v3(databaseConnection, "SELECT \"Price\", \"Created\" FROM \"Prices\" ORDER BY \"ID\" ASC;", -1, 0, &getPricesStatement, nullptr) != SQLITE_OK) {
+	
+		// Throw exception
+		throw runtime_error("Preparing get prices statement failed");
+	}
+	
+	// Automatically free get prices statement
+	const unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> getPricesStatementUniquePointer(getPricesStatement, sqlite3_finalize);
+	
+	// Go through all prices
+	int sqlResult;
+	while((sqlResult = sqlite3_step(getPricesStatement)) != SQLITE_DONE) {
+	
+		// Check if running get prices statement failed
+		if(sqlResult != SQLITE_ROW) {
+		
+			// Throw exception
+			throw runtime_error("Running get prices statement failed");
+		}
+		
+		// Add price to list
+		prices.emplace_back(reinterpret_cast<const char *>(sqlite3_column_text(getPricesStatement, 0)), sqlite3_column_bytes(getPricesStatement, 0));
+		
+		// Update result to when the price was created
+		result = max(result, chrono::time_point<chrono::system_clock>(chrono::seconds(sqlite3_column_int64(getPricesStatement, 1))));
+	}
+	
+	// Check if prices were loaded
+	if(!prices.empty()) {
+	
+		// Check if updating average price failed
+		if(!updateAveragePrice()) {
+		
+			// Clear prices
+			prices.clear();
+			
+			// Return zero
+			return chrono::time_point<chrono::system_clock>(chrono::seconds(0));
+		}
+		
+		// Display message
+		osyncstream(cout) << "Loaded " << prices.size() << " previous price(s)" << endl;
+	}
+	
+	// Return result
+	return result;
+}
+
+// Save price
+bool Price::savePrice(const chrono::time_point<chrono::system_clock> &timestamp, const string &price) {
+
+	// Lock payments since the database connection is shared with it
+	lock_guard guard(payments.getLock());
+	
+	// Check if resetting and clearing save price statement failed
+	if(sqlite3_reset(savePriceStatement) != SQLITE_OK || sqlite3_clear_bindings(savePriceStatement) != SQLITE_OK) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if binding save price statement's values failed
+	if(sqlite3_bind_int64(savePriceStatement, 1, chrono::duration_cast<chrono::seconds>(timestamp.time_since_epoch()).count()) != SQLITE_OK || sqlite3_bind_text(savePriceStatement, 2, price.c_str(), price.size(), SQLITE_STATIC) != SQLITE_OK) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if running save price statement failed
+	if(sqlite3_step(savePriceStatement) != SQLITE_DONE) {
+	
+		// Reset save price statement
+		sqlite3_reset(savePriceStatement);
+		
+		// Return false
+		return false;
+	}
+	
+	// Reset save price statement
+	sqlite3_reset(savePriceStatement);
+	
+	// Check if resetting and clearing remove stale prices statement failed
+	if(sqlite3_reset(removeStalePricesStatement) != SQLITE_OK || sqlite3_clear_bindings(removeStalePricesStatement) != SQLITE_OK) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if binding remove stale prices statement's values failed
+	if(sqlite3_bind_int64(removeStalePricesStatement, 1, averageLength) != SQLITE_OK || sqlite3_bind_int64(removeStalePricesStatement, 2, pricesDuration) != SQLITE_OK) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if running remove stale prices statement failed
+	if(sqlite3_step(removeStalePricesStatement) != SQLITE_DONE) {
+	
+		// Reset remove stale prices statement
+		sqlite3_reset(removeStalePricesStatement);
+		
+		// Return false
+		return false;
+	}
+	
+	// Reset remove stale prices statement
+	sqlite3_reset(removeStalePricesStatement);
+	
+	// Return true
+	return true;
+}
@@ -4,12 +4,16 @@
 
 
 // Header files
+#include <chrono>
 #include <getopt.h>
 #include <list>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 #include "event2/event.h"
+#include "./payments.h"
 #include "./price_oracle.h"
+#include "sqlite3.h"
 #include "./tor_proxy.h"
 
 using namespace std;
@@ -27,7 +31,7 @@ class Price {
 		static const char *CURRENCY_ABBREVIATION;
 		
 		// Constructor
-		explicit Price(const unordered_map<char, const char *> &providedOptions, const TorProxy &torProxy);
+		explicit Price(const unordered_map<char, const char *> &providedOptions, const TorProxy &torProxy, Payments &payments, sqlite3 *databaseConnection);
 		
 		// Destructor
 		~Price();
@@ -50,15 +54,36 @@ class Price {
 		// Run
 		void run(const unordered_map<char, const char *> &providedOptions);
 		
+		// Start updating current price
+		void startUpdatingCurrentPrice();
+		
+		// Price oracle finished
+		void priceOracleFinished(const size_t index, PriceOracle *priceOracle);
+		
+		// Finish updating current price
+		void finishUpdatingCurrentPrice();
+		
 		// Update current price
 		bool updateCurrentPrice();
 		
+		// Update average price
+		bool updateAveragePrice();
+		
+		// Load prices
+		chrono::time_point<chrono::system_clock> loadPrices(sqlite3 *databaseConnection);
+		
+		// Save price
+		bool savePrice(const chrono::time_point<chrono::system_clock> &timestamp, const string &price);
+		
 		// Started
 		atomic_bool started;
 		
 		// Failed
 		atomic_bool failed;
 		
+		// Payments
+		Payments &payments;
+		
 		// Current price
 		string currentPrice;
 		
@@ -71,15 +96,51 @@ class Price {
 		// Update interval
 		time_t updateInterval;
 		
+		// Request deadline
+		time_t requestDeadline;
+		
+		// Request quorum
+		size_t requestQuorum;
+		
 		// Prices
 		list<string> prices;
 		
+		// Prices duration
+		int64_t pricesDuration;
+		
+		// Previous update
+		chrono::time_point<chrono::system_clock> previousUpdate;
+		
+		// Save price statement
+		sqlite3_stmt *savePriceStatement;
+		
+		// Remove stale prices statement
+		sqlite3_stmt *removeStalePricesStatement;
+		
 		// Price oracles
 		list<unique_ptr<PriceOracle>> priceOracles;
 		
+		// Price oracle prices
+		vector<pair<chrono::time_point<chrono::system_clock>, string>> priceOraclePrices;
+		
+		// Price oracles finished
+		vector<bool> priceOraclesFinished;
+		
+		// Number of price oracle responses
+		size_t numberOfPriceOracleResponses;
+		
+		// Number of new price oracle prices
+		size_t numberOfNewPriceOraclePrices;
+		
+		// Updating current price
+		bool updatingCurrentPrice;
+		
 		// Event base
 		unique_ptr<event_base, decltype(&event_base_free)> eventBase;
 		
+		// Request deadline event
+		unique_ptr<event, decltype(&event_free)> requestDeadlineEvent;
+		
 		// Main thread
 		thread mainThread;
 };
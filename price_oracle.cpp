@@ -3,6 +3,7 @@
 #include "event2/buffer.h"
 #include "event2/bufferevent_ssl.h"
 #include "./price_oracle.h"
+#include "simdjson.h"
 
 using namespace std;
 
@@ -33,8 +34,14 @@ PriceOracle::PriceOracle(const TorProxy &torProxy) :
 	// Create TLS context
 	tlsContext(SSL_CTX_new_ex(nullptr, nullptr, tlsMethod), SSL_CTX_free),
 	
-	// Create event base
-	eventBase(event_base_new(), event_base_free),
+	// Set event base
+	eventBase(nullptr),
+	
+	// Set number of pending requests
+	numberOfPendingRequests(0),
+	
+	// Set requests finished
+	requestsFinished(false),
 	
 	// Set previous timestamp
 	previousTimestamp(chrono::seconds(0)),
@@ -57,13 +64,6 @@ PriceOracle::PriceOracle(const TorProxy &torProxy) :
 		throw runtime_error("Creating TLS context failed");
 	}
 	
-	// Check if creating event base failed
-	if(!eventBase) {
-	
-		// Throw exception
-		throw runtime_error("Creating event base failed");
-	}
-	
 	// Check if setting TLS context's minimum TLS version failed
 	if(!SSL_CTX_set_min_proto_version(tlsContext.get(), MINIMUM_TLS_VERSION)) {
 	
@@ -82,8 +82,73 @@ PriceOracle::PriceOracle(const TorProxy &torProxy) :
 	SSL_CTX_set_verify(tlsContext.get(), SSL_VERIFY_PEER, nullptr);
 }
 
+// Start getting price
+bool PriceOracle::startGettingPrice(event_base *eventBase, function<void()> &&handler) {
+
+	// Cancel getting previous price
+	cancelGettingPrice();
+	
+	// Check if floonet
+	#ifdef ENABLE_FLOONET
+	
+		// Return false
+		return false;
+		
+	// Otherwise
+	#else
+	
+		// Set event base
+		this->eventBase = eventBase;
+		
+		// Try
+		try {
+		
+			// Create requests
+			createRequests();
+		}
+		
+		// Catch errors
+		catch(...) {
+		
+			// Cancel getting price
+			cancelGettingPrice();
+			
+			// Return false
+			return false;
+		}
+		
+		// Set handler
+		this->handler = move(handler);
+		
+		// Return true
+		return true;
+	#endif
+}
+
+// Cancel getting price
+void PriceOracle::cancelGettingPrice() {
+
+	// Clear handler
+	handler = nullptr;
+	
+	// Free connections and their requests
+	connections.clear();
+	
+	// Free SOCKS buffers
+	socksBuffers.clear();
+	
+	// Remove request infos
+	requestInfos.clear();
+	
+	// Reset number of pending requests
+	numberOfPendingRequests = 0;
+	
+	// Clear requests finished
+	requestsFinished = false;
+}
+
 // Get price
-pair<chrono::time_point<chrono::system_clock>, string> PriceOracle::getPrice() const {
+pair<chrono::time_point<chrono::system_clock>, string> PriceOracle::getPrice() {
 
 	// Try
 	try {
@@ -97,6 +162,13 @@ pair<chrono::time_point<chrono::system_clock>, string> PriceOracle::getPrice() c
 		// Otherwise
 		#else
 		
+			// Check if requests didn't finish
+			if(!requestsFinished) {
+			
+				// Return previous timestamp and price
+				return {previousTimestamp, previousPrice};
+			}
+			
 			// Get new price
 			const pair newPrice = getNewPrice();
 			
@@ -127,39 +199,23 @@ pair<chrono::time_point<chrono::system_clock>, string> PriceOracle::getPrice() c
 }
 
 // Create request
-unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)> PriceOracle::createRequest(const char *host, const uint16_t port, const char *path, vector<uint8_t> &response) const {
+bool PriceOracle::createRequest(const char *host, const uint16_t port, const char *path, vector<uint8_t> &response) {
 
-	// Check if creating TLS connection from the TLS context failed
-	unique_ptr<SSL, decltype(&SSL_free)> tlsConnection(SSL_new(tlsContext.get()), SSL_free);
-	if(!tlsConnection) {
+	// Clear response
+	response.clear();
 	
-		// Return nothing
-		return unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>(nullptr, evhttp_connection_free);
-	}
-	
-	// Check if enabling the TLS connection's hostname checking failed
-	if(!SSL_set1_host(tlsConnection.get(), host)) {
-	
-		// Return nothing
-		return unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>(nullptr, evhttp_connection_free);
-	}
-	
-	// Check if setting the TLS connection's server name indication failed
-	if(!SSL_set_tlsext_host_name(tlsConnection.get(), host)) {
-	
-		// Return nothing
-		return unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>(nullptr, evhttp_connection_free);
-	}
+	// Add request info to list
+	tuple<PriceOracle *, string, uint16_t, string, vector<uint8_t> *, bool, bool> &requestInfo = requestInfos.emplace_back(this, host, port, path, &response, false, false);
 	
 	// Check if Tor is enabled
 	#ifdef ENABLE_TOR
 	
 		// Check if creating SOCKS buffer failed
-		const unique_ptr<bufferevent, decltype(&bufferevent_free)> socksBuffer(bufferevent_socket_new(eventBase.get(), -1, BEV_OPT_CLOSE_ON_FREE | BEV_OPT_DEFER_CALLBACKS), bufferevent_free);
+		unique_ptr<bufferevent, decltype(&bufferevent_free)> socksBuffer(bufferevent_socket_new(eventBase, -1, BEV_OPT_CLOSE_ON_FREE | BEV_OPT_DEFER_CALLBACKS), bufferevent_free);
 		if(!socksBuffer) {
 		
-			// Return nothing
-			return unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>(nullptr, evhttp_connection_free);
+			// Return false
+			return false;
 		}
 		
 		// Set read timeout
@@ -179,42 +235,23 @@ unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)> PriceOracle::cr
 		// Set SOCKS buffer's read and write timeout
 		bufferevent_set_timeouts(socksBuffer.get(), &readTimeout, &writeTimeout);
 		
-		// Initialize authenticated
-		bool authenticated = false;
-		
-		// Initialize connected
-		bool connected = false;
-		
-		// Set arguments
-		const void *arguments[] = {
-		
-			// Authenticated
-			&authenticated,
-			
-			// Connected
-			&connected,
-			
-			// Host
-			host,
-			
-			// Port
-			&port
-		};
-		
 		// Set SOCKS buffer callbacks
 		bufferevent_setcb(socksBuffer.get(), [](bufferevent *buffer, void *argument) {
 		
-			// Get authenticated from argument
-			bool *authenticated = reinterpret_cast<bool *>(reinterpret_cast<void **>(argument)[0]);
+			// Get request info from argument
+			tuple<PriceOracle *, string, uint16_t, string, vector<uint8_t> *, bool, bool> &requestInfo = *reinterpret_cast<tuple<PriceOracle *, string, uint16_t, string, vector<uint8_t> *, bool, bool> *>(argument);
+			
+			// Get self from request info
+			PriceOracle *self = get<0>(requestInfo);
 			
-			// Get connected from argument
-			bool *connected = reinterpret_cast<bool *>(reinterpret_cast<void **>(argument)[1]);
+			// Get host from request info
+			const string &host = get<1>(requestInfo);
 			
-			// Get host from argument
-			const char *host = reinterpret_cast<const char *>(reinterpret_cast<void **>(argument)[2]);
+			// Get port from request info
+			const uint16_t port = get<2>(requestInfo);
 			
-			// Get port from argument
-			const uint16_t *port = reinterpret_cast<const uint16_t *>(reinterpret_cast<void **>(argument)[3]);
+			// Get authenticated from request info
+			bool &authenticated = get<5>(requestInfo);
 			
 			// Check if getting input from the buffer failed
 			evbuffer *input = bufferevent_get_input(buffer);
@@ -222,195 +259,250 @@ unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)> PriceOracle::cr
 			
 				// Disable reading from buffer
 				bufferevent_disable(buffer, EV_READ);
+				
+				// Finish request
+				self->finishRequest(requestInfo);
+				
+				// Return
+				return;
 			}
 			
-			// Otherwise
-			else {
+			// Get input's length
+			const size_t length = evbuffer_get_length(input);
 			
-				// Get input's length
-				const size_t length = evbuffer_get_length(input);
-				
-				// Check if not authenticated
-				if(!*authenticated) {
+			// Check if not authenticated
+			if(!authenticated) {
+			
+				// Check if length is invalid
+				if(length != sizeof("\x05\x00") - sizeof('\0')) {
 				
-					// Check if length is invalid
-					if(length != sizeof("\x05\x00") - sizeof('\0')) {
+					// Disable reading from buffer
+					bufferevent_disable(buffer, EV_READ);
 					
-						// Disable reading from buffer
-						bufferevent_disable(buffer, EV_READ);
-						
-						// Return
-						return;
-					}
-				}
-				
-				// Otherwise
-				else {
-				
-					// Check if length is invalid
-					if(length != sizeof("\x05\x00\x00\x01\x00\x00\x00\x00\x00\x00") - sizeof('\0') && length != sizeof("\x05\x00\x00\x04\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00") - sizeof('\0')) {
+					// Finish request
+					self->finishRequest(requestInfo);
 					
-						// Disable reading from buffer
-						bufferevent_disable(buffer, EV_READ);
-						
-						// Return
-						return;
-					}
+					// Return
+					return;
 				}
-				
-				// Check if getting data from input failed
-				const unsigned char *data = evbuffer_pullup(input, length);
-				if(!data) {
+			}
+			
+			// Otherwise
+			else {
+			
+				// Check if length is invalid
+				if(length != sizeof("\x05\x00\x00\x01\x00\x00\x00\x00\x00\x00") - sizeof('\0') && length != sizeof("\x05\x00\x00\x04\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00") - sizeof('\0')) {
 				
 					// Disable reading from buffer
 					bufferevent_disable(buffer, EV_READ);
+					
+					// Finish request
+					self->finishRequest(requestInfo);
+					
+					// Return
+					return;
 				}
+			}
+			
+			// Check if getting data from input failed, data indicates failure, or removing data from input failed
+			const unsigned char *data = evbuffer_pullup(input, length);
+			if(!data || data[1] || evbuffer_drain(input, length)) {
+			
+				// Disable reading from buffer
+				bufferevent_disable(buffer, EV_READ);
 				
-				// Otherwise check if data indicates failure
-				else if(data[1]) {
+				// Finish request
+				self->finishRequest(requestInfo);
 				
-					// Disable reading from buffer
-					bufferevent_disable(buffer, EV_READ);
-				}
+				// Return
+				return;
+			}
+			
+			// Check if not authenticated
+			if(!authenticated) {
+			
+				// Set authenticated
+				authenticated = true;
+				
+				// Create connection request
+				const uint8_t hostLength = host.size();
+				const uint16_t networkPort = htons(port);
+				uint8_t connectionRequest[sizeof("\x05\x01\x00\x03") - sizeof('\0') + sizeof(hostLength) + hostLength + sizeof(networkPort)];
+				memcpy(connectionRequest, "\x05\x01\x00\x03", sizeof("\x05\x01\x00\x03") - sizeof('\0'));
+				connectionRequest[sizeof("\x05\x01\x00\x03") - sizeof('\0')] = hostLength;
+				memcpy(&connectionRequest[sizeof("\x05\x01\x00\x03") - sizeof('\0') + sizeof(hostLength)], host.data(), hostLength);
+				memcpy(&connectionRequest[sizeof("\x05\x01\x00\x03") - sizeof('\0') + sizeof(hostLength) + hostLength], &networkPort, sizeof(networkPort));
 				
-				// Otherwise check if removing data from input failed
-				else if(evbuffer_drain(input, length)) {
+				// Check if writing connection request to buffer failed
+				if(bufferevent_write(buffer, connectionRequest, sizeof(connectionRequest))) {
 				
 					// Disable reading from buffer
 					bufferevent_disable(buffer, EV_READ);
+					
+					// Finish request
+					self->finishRequest(requestInfo);
 				}
+			}
+			
+			// Otherwise
+			else {
+			
+				// Disable reading from buffer
+				bufferevent_disable(buffer, EV_READ);
 				
-				// Otherwise
-				else {
+				// Remove SOCKS buffer's socket since the request will own it
+				const evutil_socket_t socket = bufferevent_getfd(buffer);
+				bufferevent_setfd(buffer, -1);
 				
-					// Check if not authenticated
-					if(!*authenticated) {
-					
-						// Set authenticated
-						*authenticated = true;
-						
-						// Create connection request
-						const uint8_t hostLength = strlen(host);
-						const uint16_t networkPort = htons(*port);
-						uint8_t connectionRequest[sizeof("\x05\x01\x00\x03") - sizeof('\0') + sizeof(hostLength) + hostLength + sizeof(networkPort)];
-						memcpy(connectionRequest, "\x05\x01\x00\x03", sizeof("\x05\x01\x00\x03") - sizeof('\0'));
-						connectionRequest[sizeof("\x05\x01\x00\x03") - sizeof('\0')] = hostLength;
-						memcpy(&connectionRequest[sizeof("\x05\x01\x00\x03") - sizeof('\0') + sizeof(hostLength)], host, hostLength);
-						memcpy(&connectionRequest[sizeof("\x05\x01\x00\x03") - sizeof('\0') + sizeof(hostLength) + hostLength], &networkPort, sizeof(networkPort));
-						
-						// Check if writing connection request to buffer failed
-						if(bufferevent_write(buffer, connectionRequest, sizeof(connectionRequest))) {
-						
-							// Disable reading from buffer
-							bufferevent_disable(buffer, EV_READ);
-						}
-					}
-					
-					// Otherwise
-					else {
-					
-						// Set connected
-						*connected = true;
-						
-						// Disable reading from buffer
-						bufferevent_disable(buffer, EV_READ);
-					}
+				// Check if making request with the socket failed
+				if(!self->makeRequest(requestInfo, socket)) {
+				
+					// Finish request
+					self->finishRequest(requestInfo);
 				}
 			}
 			
 		}, nullptr, [](bufferevent *buffer, short event, void *argument) {
 		
+			// Get request info from argument
+			tuple<PriceOracle *, string, uint16_t, string, vector<uint8_t> *, bool, bool> &requestInfo = *reinterpret_cast<tuple<PriceOracle *, string, uint16_t, string, vector<uint8_t> *, bool, bool> *>(argument);
+			
 			// Check if connected
 			if(event & BEV_EVENT_CONNECTED) {
 			
-				// Check if enabling reading from buffer was successful
-				if(!bufferevent_enable(buffer, EV_READ)) {
+				// Check if enabling reading from buffer failed or writing authentication request to buffer failed
+				if(bufferevent_enable(buffer, EV_READ) || bufferevent_write(buffer, "\x05\x01\x00", sizeof("\x05\x01\x00") - sizeof('\0'))) {
 				
-					// Check if writing authentication request to buffer failed
-					if(bufferevent_write(buffer, "\x05\x01\x00", sizeof("\x05\x01\x00") - sizeof('\0'))) {
+					// Disable reading from buffer
+					bufferevent_disable(buffer, EV_READ);
 					
-						// Disable reading from buffer
-						bufferevent_disable(buffer, EV_READ);
-					}
+					// Finish request
+					get<0>(requestInfo)->finishRequest(requestInfo);
 				}
 			}
 			
-		}, arguments);
+			// Otherwise
+			else {
+			
+				// Disable reading from buffer
+				bufferevent_disable(buffer, EV_READ);
+				
+				// Finish request
+				get<0>(requestInfo)->finishRequest(requestInfo);
+			}
+			
+		}, &requestInfo);
 		
 		// Check if connecting to Tor SOCKS proxy failed
 		if(bufferevent_socket_connect_hostname(socksBuffer.get(), nullptr, AF_UNSPEC, torProxy.getSocksAddress().c_str(), stoull(torProxy.getSocksPort()))) {
 		
-			// Return nothing
-			return unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>(nullptr, evhttp_connection_free);
+			// Return false
+			return false;
 		}
 		
-		// Check if running event loop failed
-		if(event_base_dispatch(eventBase.get()) == -1) {
+		// Add SOCKS buffer to list
+		socksBuffers.push_back(move(socksBuffer));
 		
-			// Return nothing
-			return unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>(nullptr, evhttp_connection_free);
-		}
-		
-		// Check if not connected
-		if(!connected) {
-		
-			// Return nothing
-			return unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>(nullptr, evhttp_connection_free);
-		}
-	
-		// Check if creating TLS buffer from TLS connection failed
-		unique_ptr<bufferevent, decltype(&bufferevent_free)> tlsBuffer(bufferevent_openssl_socket_new(eventBase.get(), bufferevent_getfd(socksBuffer.get()), tlsConnection.get(), BUFFEREVENT_SSL_CONNECTING, BEV_OPT_CLOSE_ON_FREE | BEV_OPT_DEFER_CALLBACKS), bufferevent_free);
-		if(!tlsBuffer) {
-		
-			// Return nothing
-			return unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>(nullptr, evhttp_connection_free);
-		}
-		
-		// Remove SOCKS buffer's file descriptor
-		bufferevent_setfd(socksBuffer.get(), -1);
-	
 	// Otherwise
 	#else
 	
-		// Check if creating TLS buffer from TLS connection failed
-		unique_ptr<bufferevent, decltype(&bufferevent_free)> tlsBuffer(bufferevent_openssl_socket_new(eventBase.get(), -1, tlsConnection.get(), BUFFEREVENT_SSL_CONNECTING, BEV_OPT_CLOSE_ON_FREE | BEV_OPT_DEFER_CALLBACKS), bufferevent_free);
-		if(!tlsBuffer) {
+		// Check if making request failed
+		if(!makeRequest(requestInfo, -1)) {
 		
-			// Return nothing
-			return unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>(nullptr, evhttp_connection_free);
+			// Return false
+			return false;
 		}
 	#endif
 	
+	// Increment number of pending requests
+	++numberOfPendingRequests;
+	
+	// Return true
+	return true;
+}
+
+// Make request
+bool PriceOracle::makeRequest(tuple<PriceOracle *, string, uint16_t, string, vector<uint8_t> *, bool, bool> &requestInfo, const evutil_socket_t socket) {
+
+	// Get host from request info
+	const string &host = get<1>(requestInfo);
+	
+	// Get port from request info
+	const uint16_t port = get<2>(requestInfo);
+	
+	// Get path from request info
+	const string &path = get<3>(requestInfo);
+	
+	// Automatically close socket until the TLS buffer owns it
+	unique_ptr<const evutil_socket_t, void(*)(const evutil_socket_t *)> socketUniquePointer((socket != -1) ? &socket : nullptr, [](const evutil_socket_t *socket) {
+	
+		// Close socket
+		evutil_closesocket(*socket);
+	});
+	
+	// Check if creating TLS connection from the TLS context failed
+	unique_ptr<SSL, decltype(&SSL_free)> tlsConnection(SSL_new(tlsContext.get()), SSL_free);
+	if(!tlsConnection) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if enabling the TLS connection's hostname checking failed
+	if(!SSL_set1_host(tlsConnection.get(), host.c_str())) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if setting the TLS connection's server name indication failed
+	if(!SSL_set_tlsext_host_name(tlsConnection.get(), host.c_str())) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if creating TLS buffer from TLS connection failed
+	unique_ptr<bufferevent, decltype(&bufferevent_free)> tlsBuffer(bufferevent_openssl_socket_new(eventBase, socket, tlsConnection.get(), BUFFEREVENT_SSL_CONNECTING, BEV_OPT_CLOSE_ON_FREE | BEV_OPT_DEFER_CALLBACKS), bufferevent_free);
+	if(!tlsBuffer) {
+	
+		// Return false
+		return false;
+	}
+	
 	// Release TLS connection
 	tlsConnection.release();
 	
+	// Release socket unique pointer
+	socketUniquePointer.release();
+	
 	// Check if allow dirty shutdown for the TLS buffer failed
 	if(bufferevent_ssl_set_flags(tlsBuffer.get(), BUFFEREVENT_SSL_DIRTY_SHUTDOWN) == EV_UINT64_MAX) {
 	
-		// Return nothing
-		return unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>(nullptr, evhttp_connection_free);
+		// Return false
+		return false;
 	}
 	
 	// Check if Tor is enabled
 	#ifdef ENABLE_TOR
 	
 		// Check if creating connection from TLS buffer failed
-		unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)> connection(evhttp_connection_base_bufferevent_new(eventBase.get(), nullptr, tlsBuffer.get(), torProxy.getSocksAddress().c_str(), stoull(torProxy.getSocksPort())), evhttp_connection_free);
+		unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)> connection(evhttp_connection_base_bufferevent_new(eventBase, nullptr, tlsBuffer.get(), torProxy.getSocksAddress().c_str(), stoull(torProxy.getSocksPort())), evhttp_connection_free);
 		if(!connection) {
 		
-			// Return nothing
-			return unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>(nullptr, evhttp_connection_free);
+			// Return false
+			return false;
 		}
 	
 	// Otherwise
 	#else
 	
 		// Check if creating connection from TLS buffer failed
-		unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)> connection(evhttp_connection_base_bufferevent_new(eventBase.get(), nullptr, tlsBuffer.get(), host, port), evhttp_connection_free);
+		unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)> connection(evhttp_connection_base_bufferevent_new(eventBase, nullptr, tlsBuffer.get(), host.c_str(), port), evhttp_connection_free);
 		if(!connection) {
 		
-			// Return nothing
-			return unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>(nullptr, evhttp_connection_free);
+			// Return false
+			return false;
 		}
 	#endif
 	
@@ -437,8 +529,11 @@ unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)> PriceOracle::cr
 	// Check if creating request failed
 	unique_ptr<evhttp_request, decltype(&evhttp_request_free)> request(evhttp_request_new([](evhttp_request *request, void *argument) {
 	
-		// Get response from argument
-		vector<uint8_t> *response = reinterpret_cast<vector<uint8_t> *>(argument);
+		// Get request info from argument
+		tuple<PriceOracle *, string, uint16_t, string, vector<uint8_t> *, bool, bool> &requestInfo = *reinterpret_cast<tuple<PriceOracle *, string, uint16_t, string, vector<uint8_t> *, bool, bool> *>(argument);
+		
+		// Get response from request info
+		vector<uint8_t> *response = get<4>(requestInfo);
 		
 		// Check if request was successful
 		if(request && evhttp_request_get_response_code(request) == HTTP_OK) {
@@ -447,6 +542,9 @@ unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)> PriceOracle::cr
 			evbuffer *buffer = evhttp_request_get_input_buffer(request);
 			if(buffer && evbuffer_get_length(buffer)) {
 			
+				// Reserve space in the response for it to be padded when parsed as JSON
+				response->reserve(evbuffer_get_length(buffer) + simdjson::SIMDJSON_PADDING);
+				
 				// Check if getting response failed
 				response->resize(evbuffer_get_length(buffer));
 				if(evbuffer_copyout(buffer, response->data(), response->size()) != static_cast<ssize_t>(response->size())) {
@@ -472,41 +570,73 @@ unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)> PriceOracle::cr
 			response->clear();
 		}
 		
-	}, &response), evhttp_request_free);
+		// Finish request
+		get<0>(requestInfo)->finishRequest(requestInfo);
+		
+	}, &requestInfo), evhttp_request_free);
 	
 	if(!request) {
 	
-		// Return nothing
-		return unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>(nullptr, evhttp_connection_free);
+		// Return false
+		return false;
 	}
 	
 	// Check if setting request's host and connection headers failed
 	if(!evhttp_request_get_output_headers(request.get()) || evhttp_add_header(evhttp_request_get_output_headers(request.get()), "Host", (host + ((port != Common::HTTPS_PORT) ? ':' + to_string(port) : "")).c_str()) || evhttp_add_header(evhttp_request_get_output_headers(request.get()), "Connection", "close")) {
 	
-		// Return nothing
-		return unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>(nullptr, evhttp_connection_free);
+		// Return false
+		return false;
 	}
 	
 	// Check if making request failed
-	if(evhttp_make_request(connection.get(), request.get(), EVHTTP_REQ_GET, path)) {
+	if(evhttp_make_request(connection.get(), request.get(), EVHTTP_REQ_GET, path.c_str())) {
 	
 		// Release request
 		request.release();
 		
-		// Return nothing
-		return unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>(nullptr, evhttp_connection_free);
+		// Return false
+		return false;
 	}
 	
 	// Release request
 	request.release();
 	
-	// Return connection
-	return connection;
+	// Add connection to list
+	connections.push_back(move(connection));
+	
+	// Return true
+	return true;
 }
 
-// Perform requests
-bool PriceOracle::performRequests() const {
+// Finish request
+void PriceOracle::finishRequest(tuple<PriceOracle *, string, uint16_t, string, vector<uint8_t> *, bool, bool> &requestInfo) {
 
-	// Return if running event loop was successful
-	return event_base_dispatch(eventBase.get()) != -1;
+	// Check if request already finished
+	bool &finished = get<6>(requestInfo);
+	if(finished) {
+	
+		// Return
+		return;
+	}
+	
+	// Set finished
+	finished = true;
+	
+	// Check if all requests finished
+	if(numberOfPendingRequests && !--numberOfPendingRequests) {
+	
+		// Set requests finished
+		requestsFinished = true;
+		
+		// Check if handler exists
+		if(handler) {
+		
+			// Get handler
+			const function<void()> finishedHandler = move(handler);
+			handler = nullptr;
+			
+			// Run handler
+			finishedHandler();
+		}
+	}
 }
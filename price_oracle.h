@@ -5,9 +5,13 @@
 
 // Header files
 #include <chrono>
+#include <functional>
+#include <list>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
+#include "event2/bufferevent.h"
 #include "event2/event.h"
 #include "event2/http.h"
 #include "openssl/ssl.h"
@@ -30,23 +34,35 @@ class PriceOracle {
 		// Destructor
 		virtual ~PriceOracle() = default;
 		
+		// Start getting price
+		bool startGettingPrice(event_base *eventBase, function<void()> &&handler);
+		
+		// Cancel getting price
+		void cancelGettingPrice();
+		
 		// Get price
-		pair<chrono::time_point<chrono::system_clock>, string> getPrice() const;
+		pair<chrono::time_point<chrono::system_clock>, string> getPrice();
 	
 	// Protected
 	protected:
 		
 		// Create request
-		unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)> createRequest(const char *host, const uint16_t port, const char *path, vector<uint8_t> &response) const;
-		
-		// Perform requests
-		bool performRequests() const;
+		bool createRequest(const char *host, const uint16_t port, const char *path, vector<uint8_t> &response);
 	
 	// Private
 	private:
 	
+		// Create requests
+		virtual void createRequests() = 0;
+		
 		// Get new price
-		virtual pair<chrono::time_point<chrono::system_clock>, string> getNewPrice() const = 0;
+		virtual pair<chrono::time_point<chrono::system_clock>, string> getNewPrice() = 0;
+		
+		// Make request
+		bool makeRequest(tuple<PriceOracle *, string, uint16_t, string, vector<uint8_t> *, bool, bool> &requestInfo, const evutil_socket_t socket);
+		
+		// Finish request
+		void finishRequest(tuple<PriceOracle *, string, uint16_t, string, vector<uint8_t> *, bool, bool> &requestInfo);
 		
 		// Tor proxy
 		const TorProxy &torProxy;
@@ -58,13 +74,31 @@ class PriceOracle {
 		const unique_ptr<SSL_CTX, decltype(&SSL_CTX_free)> tlsContext;
 		
 		// Event base
-		const unique_ptr<event_base, decltype(&event_base_free)> eventBase;
+		event_base *eventBase;
+		
+		// Handler
+		function<void()> handler;
+		
+		// Request infos
+		list<tuple<PriceOracle *, string, uint16_t, string, vector<uint8_t> *, bool, bool>> requestInfos;
+		
+		// SOCKS buffers
+		list<unique_ptr<bufferevent, decltype(&bufferevent_free)>> socksBuffers;
+		
+		// Connections
+		list<unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>> connections;
+		
+		// Number of pending requests
+		size_t numberOfPendingRequests;
+		
+		// Requests finished
+		bool requestsFinished;
 		
 		// Previous timestamp
-		mutable chrono::time_point<chrono::system_clock> previousTimestamp;
+		chrono::time_point<chrono::system_clock> previousTimestamp;
 		
 		// Previous price
-		mutable string previousPrice;
+		string previousPrice;
 };
 
 
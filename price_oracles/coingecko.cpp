@@ -1,8 +1,9 @@
 // Header files
+#include <charconv>
 #include <cmath>
 #include "./coingecko.h"
 #include "../common.h"
-#include "mpfr.h"
+#include "../decimal.h"
 #include "simdjson.h"
 
 using namespace std;
@@ -18,38 +19,37 @@ CoinGecko::CoinGecko(const TorProxy &torProxy) :
 {
 }
 
-// Get new price
-pair<chrono::time_point<chrono::system_clock>, string> CoinGecko::getNewPrice() const {
+// Create requests
+void CoinGecko::createRequests() {
 
 	// Check if creating MWC request failed
-	vector<uint8_t> mwcResponse;
-	const unique_ptr mwcRequest = createRequest("api.coingecko.com", Common::HTTPS_PORT, "/api/v3/simple/price?ids=mimblewimblecoin&vs_currencies=usd&include_last_updated_at=true", mwcResponse);
-	if(!mwcRequest) {
+	if(!createRequest("api.coingecko.com", Common::HTTPS_PORT, "/api/v3/simple/price?ids=mimblewimblecoin&vs_currencies=usd&include_last_updated_at=true", mwcResponse)) {
 	
 		// Throw exception
 		throw runtime_error("Creating CoinGecko MWC request failed");
 	}
 	
 	// Check if creating USDT request failed
-	vector<uint8_t> usdtResponse;
-	const unique_ptr usdtRequest = createRequest("api.coingecko.com", Common::HTTPS_PORT, "/api/v3/simple/price?ids=tether&vs_currencies=usd", usdtResponse);
-	if(!usdtRequest) {
+	if(!createRequest("api.coingecko.com", Common::HTTPS_PORT, "/api/v3/simple/price?ids=tether&vs_currencies=usd", usdtResponse)) {
 	
 		// Throw exception
 		throw runtime_error("Creating CoinGecko USDT request failed");
 	}
-	
+}
+
+// Get new price
+pair<chrono::time_point<chrono::system_clock>, string> CoinGecko::getNewPrice() {
+
 	// Check if performing requests failed
-	if(!performRequests() || mwcResponse.empty() || usdtResponse.empty()) {
+	if(mwcResponse.empty() || usdtResponse.empty()) {
 	
 		// Throw exception
 		throw runtime_error("Performing CoinGecko requests failed");
 	}
 	
 	// Parse MWC response as JSON
-	simdjson::padded_string paddedResponse(reinterpret_cast<const char *>(mwcResponse.data()), mwcResponse.size());
-	simdjson::ondemand::parser parser;
-	simdjson::ondemand::document json = parser.iterate(paddedResponse);
+	mwcResponse.resize(mwcResponse.size() + simdjson::SIMDJSON_PADDING);
+	simdjson::ondemand::document json = jsonParser.iterate(mwcResponse.data(), mwcResponse.size() - simdjson::SIMDJSON_PADDING, mwcResponse.size());
 	
 	// Get date
 	const int64_t date = json["mimblewimblecoin"]["last_updated_at"].get_int64().value();
@@ -82,15 +82,38 @@ pair<chrono::time_point<chrono::system_clock>, string> CoinGecko::getNewPrice()
 	}
 	
 	// Initialize MWC price
-	mpfr_t mwcPrice;
-	mpfr_init2(mwcPrice, Common::MPFR_PRECISION);
+	Decimal mwcPrice;
+	
+	// Initialize price characters
+	char priceCharacters[numeric_limits<double>::max_exponent10 + numeric_limits<double>::max_digits10 + sizeof("0.")];
+	
+	// Check if getting MWC price characters failed
+	const to_chars_result mwcPriceCharacters = to_chars(priceCharacters, priceCharacters + sizeof(priceCharacters) - sizeof('\0'), price, chars_format::fixed);
+	if(mwcPriceCharacters.ec != errc()) {
+	
+		// Throw exception
+		throw runtime_error("CoinGecko MWC price is invalid");
+	}
+	
+	// Terminate MWC price characters
+	*mwcPriceCharacters.ptr = '\0';
+	
+	// Try
+	try {
+	
+		// Set MWC price
+		mwcPrice = Decimal(priceCharacters);
+	}
+	
+	// Catch errors
+	catch(...) {
 	
-	// Automatically free MWC price
-	const unique_ptr<remove_pointer<mpfr_ptr>::type, decltype(&mpfr_clear)> mwcPriceUniquePointer(mwcPrice, mpfr_clear);
+		// Throw exception
+		throw runtime_error("CoinGecko MWC price is invalid");
+	}
 	
-	// Check if setting MWC price is invalid
-	mpfr_set_d(mwcPrice, price, MPFR_RNDN);
-	if(mpfr_sgn(mwcPrice) <= 0) {
+	// Check if MWC price is invalid
+	if(mwcPrice.isZero()) {
 	
 		// Throw exception
 		throw runtime_error("CoinGecko MWC price is invalid");
@@ -122,8 +145,8 @@ pair<chrono::time_point<chrono::system_clock>, string> CoinGecko::getNewPrice()
 	}
 	
 	// Parse USDT response as JSON
-	paddedResponse = simdjson::padded_string(reinterpret_cast<const char *>(usdtResponse.data()), usdtResponse.size());
-	json = parser.iterate(paddedResponse);
+	usdtResponse.resize(usdtResponse.size() + simdjson::SIMDJSON_PADDING);
+	json = jsonParser.iterate(usdtResponse.data(), usdtResponse.size() - simdjson::SIMDJSON_PADDING, usdtResponse.size());
 	
 	// Get price
 	price = json["tether"]["usd"].get_double().value();
@@ -136,15 +159,35 @@ pair<chrono::time_point<chrono::system_clock>, string> CoinGecko::getNewPrice()
 	}
 	
 	// Initialize USDT price
-	mpfr_t usdtPrice;
-	mpfr_init2(usdtPrice, Common::MPFR_PRECISION);
+	Decimal usdtPrice;
 	
-	// Automatically free USDT price
-	const unique_ptr<remove_pointer<mpfr_ptr>::type, decltype(&mpfr_clear)> usdtPriceUniquePointer(usdtPrice, mpfr_clear);
+	// Check if getting USDT price characters failed
+	const to_chars_result usdtPriceCharacters = to_chars(priceCharacters, priceCharacters + sizeof(priceCharacters) - sizeof('\0'), price, chars_format::fixed);
+	if(usdtPriceCharacters.ec != errc()) {
 	
-	// Check if setting USDT price is invalid
-	mpfr_set_d(usdtPrice, price, MPFR_RNDN);
-	if(mpfr_sgn(usdtPrice) <= 0) {
+		// Throw exception
+		throw runtime_error("CoinGecko USDT price is invalid");
+	}
+	
+	// Terminate USDT price characters
+	*usdtPriceCharacters.ptr = '\0';
+	
+	// Try
+	try {
+	
+		// Set USDT price
+		usdtPrice = Decimal(priceCharacters);
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Throw exception
+		throw runtime_error("CoinGecko USDT price is invalid");
+	}
+	
+	// Check if USDT price is invalid
+	if(usdtPrice.isZero()) {
 	
 		// Throw exception
 		throw runtime_error("CoinGecko USDT price is invalid");
@@ -173,30 +216,17 @@ pair<chrono::time_point<chrono::system_clock>, string> CoinGecko::getNewPrice()
 	}
 	
 	// Divide MWC price by USDT price to get the price in USDT
-	mpfr_div(mwcPrice, mwcPrice, usdtPrice, MPFR_RNDA);
+	mwcPrice = mwcPrice.divide(usdtPrice, Decimal::MAXIMUM_SCALE);
 	
 	// Check if result is invalid
-	if(mpfr_sgn(mwcPrice) <= 0) {
+	if(mwcPrice.isZero()) {
 	
 		// Throw exception
 		throw runtime_error("CoinGecko result is invalid");
 	}
 	
-	// Check if getting result size failed
-	const int resultSize = mpfr_snprintf(nullptr, 0, ("%." + to_string(precision) + "R*F").c_str(), MPFR_RNDN, mwcPrice);
-	if(resultSize <= 0) {
-	
-		// Throw exception
-		throw runtime_error("Getting CoinGecko result size failed");
-	}
-	
-	// Check if getting result failed
-	string result(resultSize, '\0');
-	if(mpfr_sprintf(result.data(), ("%." + to_string(precision) + "R*F").c_str(), MPFR_RNDN, mwcPrice) != resultSize) {
-	
-		// Throw exception
-		throw runtime_error("Getting CoinGecko result failed");
-	}
+	// Get result
+	string result = mwcPrice.toString(precision);
 	
 	// Check if result isn't zero and it has precision
 	if(result != "0" && precision) {
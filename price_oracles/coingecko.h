@@ -5,6 +5,7 @@
 
 // Header files
 #include "../price_oracle.h"
+#include "simdjson.h"
 
 using namespace std;
 
@@ -23,8 +24,20 @@ class CoinGecko final : public PriceOracle {
 	// Private
 	private:
 		
+		// Create requests
+		virtual void createRequests() override final;
+		
 		// Get new price
-		virtual pair<chrono::time_point<chrono::system_clock>, string> getNewPrice() const override final;
+		virtual pair<chrono::time_point<chrono::system_clock>, string> getNewPrice() override final;
+		
+		// MWC response
+		vector<uint8_t> mwcResponse;
+		
+		// USDT response
+		vector<uint8_t> usdtResponse;
+		
+		// JSON parser
+		simdjson::ondemand::parser jsonParser;
 };
 
 
@@ -5,6 +5,7 @@
 
 // Header files
 #include "../price_oracle.h"
+#include "simdjson.h"
 
 using namespace std;
 
@@ -23,8 +24,17 @@ class NonLogs final : public PriceOracle {
 	// Private
 	private:
 		
+		// Create requests
+		virtual void createRequests() override final;
+		
 		// Get new price
-		virtual pair<chrono::time_point<chrono::system_clock>, string> getNewPrice() const override final;
+		virtual pair<chrono::time_point<chrono::system_clock>, string> getNewPrice() override final;
+		
+		// Response
+		vector<uint8_t> response;
+		
+		// JSON parser
+		simdjson::dom::parser jsonParser;
 };
 
 
@@ -1,6 +1,6 @@
 // Header files
 #include "../common.h"
-#include "mpfr.h"
+#include "../decimal.h"
 #include "simdjson.h"
 #include "./whitebit.h"
 
@@ -17,29 +17,29 @@ WhiteBit::WhiteBit(const TorProxy &torProxy) :
 {
 }
 
-// Get new price
-pair<chrono::time_point<chrono::system_clock>, string> WhiteBit::getNewPrice() const {
+// Create requests
+void WhiteBit::createRequests() {
 
 	// Check if creating MWC request failed
-	vector<uint8_t> mwcResponse;
-	const unique_ptr mwcRequest = createRequest("whitebit.com", Common::HTTPS_PORT, "/api/v4/public/trades/MWC_BTC", mwcResponse);
-	if(!mwcRequest) {
+	if(!createRequest("whitebit.com", Common::HTTPS_PORT, "/api/v4/public/trades/MWC_BTC", mwcResponse)) {
 	
 		// Throw exception
 		throw runtime_error("Creating WhiteBIT MWC request failed");
 	}
 	
 	// Check if creating BTC request failed
-	vector<uint8_t> btcResponse;
-	const unique_ptr btcRequest = createRequest("whitebit.com", Common::HTTPS_PORT, "/api/v4/public/trades/BTC_USDT", btcResponse);
-	if(!btcRequest) {
+	if(!createRequest("whitebit.com", Common::HTTPS_PORT, "/api/v4/public/trades/BTC_USDT", btcResponse)) {
 	
 		// Throw exception
 		throw runtime_error("Creating WhiteBIT BTC request failed");
 	}
-	
+}
+
+// Get new price
+pair<chrono::time_point<chrono::system_clock>, string> WhiteBit::getNewPrice() {
+
 	// Check if performing requests failed
-	if(!performRequests() || mwcResponse.empty() || btcResponse.empty()) {
+	if(mwcResponse.empty() || btcResponse.empty()) {
 	
 		// Throw exception
 		throw runtime_error("Performing WhiteBIT requests failed");
@@ -47,8 +47,7 @@ pair<chrono::time_point<chrono::system_clock>, string> WhiteBit::getNewPrice() c
 	
 	// Parse MWC response as JSON
 	mwcResponse.resize(mwcResponse.size() + simdjson::SIMDJSON_PADDING);
-	simdjson::dom::parser parser;
-	simdjson::dom::element json = parser.parse(mwcResponse.data(), mwcResponse.size() - simdjson::SIMDJSON_PADDING, false);
+	simdjson::dom::element json = jsonParser.parse(mwcResponse.data(), mwcResponse.size() - simdjson::SIMDJSON_PADDING, false);
 	
 	// Check if MWC response is invalid
 	if(!json.is_array() || !json.get_array().size()) {
@@ -86,11 +85,7 @@ pair<chrono::time_point<chrono::system_clock>, string> WhiteBit::getNewPrice() c
 	}
 	
 	// Initialize MWC price
-	mpfr_t mwcPrice;
-	mpfr_init2(mwcPrice, Common::MPFR_PRECISION);
-	
-	// Automatically free MWC price
-	const unique_ptr<remove_pointer<mpfr_ptr>::type, decltype(&mpfr_clear)> mwcPriceUniquePointer(mwcPrice, mpfr_clear);
+	Decimal mwcPrice;
 	
 	// Get price
 	const char *price = mostRecentPrice["price"].get_c_str();
@@ -106,8 +101,22 @@ pair<chrono::time_point<chrono::system_clock>, string> WhiteBit::getNewPrice() c
 		}
 	}
 	
-	// Check if setting MWC price is invalid
-	if(mpfr_set_str(mwcPrice, price, Common::DECIMAL_NUMBER_BASE, MPFR_RNDN) || mpfr_sgn(mwcPrice) <= 0) {
+	// Try
+	try {
+	
+		// Set MWC price
+		mwcPrice = Decimal(price);
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Throw exception
+		throw runtime_error("WhiteBIT MWC price is invalid");
+	}
+	
+	// Check if MWC price is invalid
+	if(mwcPrice.isZero()) {
 	
 		// Throw exception
 		throw runtime_error("WhiteBIT MWC price is invalid");
@@ -126,7 +135,7 @@ pair<chrono::time_point<chrono::system_clock>, string> WhiteBit::getNewPrice() c
 	
 	// Parse BTC response as JSON
 	btcResponse.resize(btcResponse.size() + simdjson::SIMDJSON_PADDING);
-	json = parser.parse(btcResponse.data(), btcResponse.size() - simdjson::SIMDJSON_PADDING, false);
+	json = jsonParser.parse(btcResponse.data(), btcResponse.size() - simdjson::SIMDJSON_PADDING, false);
 	
 	// Check if BTC response is invalid
 	if(!json.is_array() || !json.get_array().size()) {
@@ -144,11 +153,7 @@ pair<chrono::time_point<chrono::system_clock>, string> WhiteBit::getNewPrice() c
 	}
 	
 	// Initialize BTC price
-	mpfr_t btcPrice;
-	mpfr_init2(btcPrice, Common::MPFR_PRECISION);
-	
-	// Automatically free BTC price
-	const unique_ptr<remove_pointer<mpfr_ptr>::type, decltype(&mpfr_clear)> btcPriceUniquePointer(btcPrice, mpfr_clear);
+	Decimal btcPrice;
 	
 	// Get price
 	price = mostRecentPrice["price"].get_c_str();
@@ -164,8 +169,22 @@ pair<chrono::time_point<chrono::system_clock>, string> WhiteBit::getNewPrice() c
 		}
 	}
 	
-	// Check if setting BTC price is invalid
-	if(mpfr_set_str(btcPrice, price, Common::DECIMAL_NUMBER_BASE, MPFR_RNDN) || mpfr_sgn(btcPrice) <= 0) {
+	// Try
+	try {
+	
+		// Set BTC price
+		btcPrice = Decimal(price);
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Throw exception
+		throw runtime_error("WhiteBIT BTC price is invalid");
+	}
+	
+	// Check if BTC price is invalid
+	if(btcPrice.isZero()) {
 	
 		// Throw exception
 		throw runtime_error("WhiteBIT BTC price is invalid");
@@ -180,30 +199,17 @@ pair<chrono::time_point<chrono::system_clock>, string> WhiteBit::getNewPrice() c
 	}
 	
 	// Multiply MWC price by BTC price to get the price in USDT
-	mpfr_mul(mwcPrice, mwcPrice, btcPrice, MPFR_RNDN);
+	mwcPrice = mwcPrice * btcPrice;
 	
 	// Check if result is invalid
-	if(mpfr_sgn(mwcPrice) <= 0) {
+	if(mwcPrice.isZero()) {
 	
 		// Throw exception
 		throw runtime_error("WhiteBIT result is invalid");
 	}
 	
-	// Check if getting result size failed
-	const int resultSize = mpfr_snprintf(nullptr, 0, ("%." + to_string(precision) + "R*F").c_str(), MPFR_RNDN, mwcPrice);
-	if(resultSize <= 0) {
-	
-		// Throw exception
-		throw runtime_error("Getting WhiteBIT result size failed");
-	}
-	
-	// Check if getting result failed
-	string result(resultSize, '\0');
-	if(mpfr_sprintf(result.data(), ("%." + to_string(precision) + "R*F").c_str(), MPFR_RNDN, mwcPrice) != resultSize) {
-	
-		// Throw exception
-		throw runtime_error("Getting WhiteBIT result failed");
-	}
+	// Get result
+	string result = mwcPrice.toString(precision);
 	
 	// Check if result isn't zero and it has precision
 	if(result != "0" && precision) {
@@ -1,6 +1,6 @@
 // Header files
 #include "../common.h"
-#include "mpfr.h"
+#include "../decimal.h"
 #include "simdjson.h"
 #include "./xt.h"
 
@@ -17,20 +17,22 @@ Xt::Xt(const TorProxy &torProxy) :
 {
 }
 
-// Get new price
-pair<chrono::time_point<chrono::system_clock>, string> Xt::getNewPrice() const {
+// Create requests
+void Xt::createRequests() {
 
 	// Check if creating request failed
-	vector<uint8_t> response;
-	const unique_ptr request = createRequest("sapi.xt.com", Common::HTTPS_PORT, "/v4/public/ticker/price?symbol=mwc_usdt", response);
-	if(!request) {
+	if(!createRequest("sapi.xt.com", Common::HTTPS_PORT, "/v4/public/ticker/price?symbol=mwc_usdt", response)) {
 	
 		// Throw exception
 		throw runtime_error("Creating XT request failed");
 	}
-	
+}
+
+// Get new price
+pair<chrono::time_point<chrono::system_clock>, string> Xt::getNewPrice() {
+
 	// Check if performing requests failed
-	if(!performRequests() || response.empty()) {
+	if(response.empty()) {
 	
 		// Throw exception
 		throw runtime_error("Performing XT requests failed");
@@ -38,8 +40,7 @@ pair<chrono::time_point<chrono::system_clock>, string> Xt::getNewPrice() const {
 	
 	// Parse response as JSON
 	response.resize(response.size() + simdjson::SIMDJSON_PADDING);
-	simdjson::dom::parser parser;
-	const simdjson::dom::element json = parser.parse(response.data(), response.size() - simdjson::SIMDJSON_PADDING, false);
+	const simdjson::dom::element json = jsonParser.parse(response.data(), response.size() - simdjson::SIMDJSON_PADDING, false);
 	
 	// Check if response is invalid
 	if(!json.is_object() || !json["result"].is_array() || !json["result"].get_array().size()) {
@@ -77,11 +78,7 @@ pair<chrono::time_point<chrono::system_clock>, string> Xt::getNewPrice() const {
 	}
 	
 	// Initialize MWC price
-	mpfr_t mwcPrice;
-	mpfr_init2(mwcPrice, Common::MPFR_PRECISION);
-	
-	// Automatically free MWC price
-	const unique_ptr<remove_pointer<mpfr_ptr>::type, decltype(&mpfr_clear)> mwcPriceUniquePointer(mwcPrice, mpfr_clear);
+	Decimal mwcPrice;
 	
 	// Get price
 	const char *price = mostRecentPrice["p"].get_c_str();
@@ -97,8 +94,22 @@ pair<chrono::time_point<chrono::system_clock>, string> Xt::getNewPrice() const {
 		}
 	}
 	
-	// Check if setting MWC price is invalid
-	if(mpfr_set_str(mwcPrice, price, Common::DECIMAL_NUMBER_BASE, MPFR_RNDN) || mpfr_sgn(mwcPrice) <= 0) {
+	// Try
+	try {
+	
+		// Set MWC price
+		mwcPrice = Decimal(price);
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Throw exception
+		throw runtime_error("XT price is invalid");
+	}
+	
+	// Check if MWC price is invalid
+	if(mwcPrice.isZero()) {
 	
 		// Throw exception
 		throw runtime_error("XT price is invalid");
@@ -115,21 +126,8 @@ pair<chrono::time_point<chrono::system_clock>, string> Xt::getNewPrice() const {
 		precision += strlen(price) - (decimal + sizeof('.') - price);
 	}
 	
-	// Check if getting result size failed
-	const int resultSize = mpfr_snprintf(nullptr, 0, ("%." + to_string(precision) + "R*F").c_str(), MPFR_RNDN, mwcPrice);
-	if(resultSize <= 0) {
-	
-		// Throw exception
-		throw runtime_error("Getting XT result size failed");
-	}
-	
-	// Check if getting result failed
-	string result(resultSize, '\0');
-	if(mpfr_sprintf(result.data(), ("%." + to_string(precision) + "R*F").c_str(), MPFR_RNDN, mwcPrice) != resultSize) {
-	
-		// Throw exception
-		throw runtime_error("Getting XT result failed");
-	}
+	// Get result
+	string result = mwcPrice.toString(precision);
 	
 	// Check if result isn't zero and it has precision
 	if(result != "0" && precision) {
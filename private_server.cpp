@@ -1,10 +1,13 @@
 // Header files
 #include <arpa/inet.h>
+#include <chrono>
 #include <cinttypes>
 #include <cmath>
 #include <cstring>
 #include <filesystem>
+#include <functional>
 #include <iostream>
+#include <list>
 #include <syncstream>
 #include "./common.h"
 #include "./consensus.h"
@@ -16,6 +19,7 @@
 #include "openssl/ssl.h"
 #include "./private_server.h"
 #include "./public_server.h"
+#include "simdjson.h"
 
 using namespace std;
 
@@ -45,13 +49,71 @@ static const int MINIMUM_TLS_VERSION = TLS1_VERSION;
 static const size_t MAXIMUM_HEADERS_SIZE = 3 * Common::BYTES_IN_A_KILOBYTE;
 
 // Maximum body size
-static const size_t MAXIMUM_BODY_SIZE = 0;
+static const size_t MAXIMUM_BODY_SIZE = Common::BYTES_IN_A_KILOBYTE * Common::BYTES_IN_A_KILOBYTE;
+
+// Default batch window milliseconds
+static const uint16_t DEFAULT_BATCH_WINDOW_MILLISECONDS = 0;
+
+// Default batch size
+static const uint16_t DEFAULT_BATCH_SIZE = 100;
+
+// Maximum number of payments in a create payments request
+static const size_t MAXIMUM_NUMBER_OF_CREATE_PAYMENTS = 1000;
+
+// Maximum number of payments in a get payments info request
+static const size_t MAXIMUM_NUMBER_OF_GET_PAYMENTS_INFO = 1000;
+
+// Default list payments limit
+static const uint64_t DEFAULT_LIST_PAYMENTS_LIMIT = 100;
+
+// Maximum list payments limit
+static const uint64_t MAXIMUM_LIST_PAYMENTS_LIMIT = 1000;
+
+// Default watch payments timeout
+static const uint64_t DEFAULT_WATCH_PAYMENTS_TIMEOUT = 30;
+
+// Maximum watch payments timeout
+static const uint64_t MAXIMUM_WATCH_PAYMENTS_TIMEOUT = 5 * Common::SECONDS_IN_A_MINUTE;
+
+// Maximum number of changes in a watch payments response
+static const size_t MAXIMUM_NUMBER_OF_WATCH_PAYMENTS_CHANGES = 1000;
+
+// Maximum number of payment watchers
+static const size_t MAXIMUM_NUMBER_OF_PAYMENT_WATCHERS = 1000;
+
+// Payment watchers check interval
+static const timeval PAYMENT_WATCHERS_CHECK_INTERVAL = {
+
+	// Seconds
+	.tv_sec = 1,
+	
+	// Microseconds
+	.tv_usec = 0
+};
+
+// JSON parser
+static thread_local simdjson::dom::parser jsonParser;
+
+// Padded POST data
+static thread_local vector<uint8_t> paddedPostData(MAXIMUM_BODY_SIZE + simdjson::SIMDJSON_PADDING);
+
+
+// Function prototypes
+
+// Get create payment parameters
+static bool getCreatePaymentParameters(uint64_t &price, uint32_t &requiredConfirmations, uint32_t &timeout, const char *&completedCallback, const char *&receivedCallback, const char *&confirmedCallback, const char *&expiredCallback, const char *&notes, const function<const char *(const char *)> &getParameter);
+
+// Create random ID and URL
+static bool createRandomIdAndUrl(uint64_t &id, char *url);
+
+// Get number parameter
+static bool getNumberParameter(uint64_t &number, const char *parameter);
 
 
 // Supporting function implementation
 
 // Constructor
-PrivateServer::PrivateServer(const unordered_map<char, const char *> &providedOptions, const filesystem::path &currentDirectory, const Wallet &wallet, Payments &payments, const Price &price) :
+PrivateServer::PrivateServer(const unordered_map<char, const char *> &providedOptions, const filesystem::path &currentDirectory, const Wallet &wallet, Payments &payments, const Price &price, OutputPrecomputer &outputPrecomputer, PaymentProofAddressCache &paymentProofAddressCache) :
 
 	// Set started
 	started(false),
@@ -65,15 +127,30 @@ PrivateServer::PrivateServer(const unordered_map<char, const char *> &providedOp
 	// Set price
 	price(price),
 	
+	// Set output precomputer
+	outputPrecomputer(outputPrecomputer),
+	
+	// Set payment proof address cache
+	paymentProofAddressCache(paymentProofAddressCache),
+	
 	// Set event base
 	eventBase(nullptr, event_base_free),
 	
+	// Set batch timer
+	batchTimer(nullptr, event_free),
+	
+	// Set payment changes event
+	paymentChangesEvent(nullptr, event_free),
+	
+	// Set payment watchers timer
+	paymentWatchersTimer(nullptr, event_free),
+	
 	// Set using Onion Service
 	usingOnionService(providedOptions.contains('z')),
 	
 	// Set price disable
 	priceDisable(providedOptions.contains('q'))
-	
+
 {
 
 	// Display message
@@ -168,11 +245,14 @@ PrivateServer::~PrivateServer() {
 	
 	// Try
 	try {
-
+	
 		// Wait for main thread to finish
 		mainThread.join();
+		
+		// Remove payments' payment changes listener
+		payments.setPaymentChangesListener(nullptr);
 	}
-
+	
 	// Catch errors
 	catch(...) {
 	
@@ -210,7 +290,13 @@ vector<option> PrivateServer::getOptions() {
 		{"private_key", required_argument, nullptr, 'k'},
 		
 		// Private API key
-		{"private_api_key", required_argument, nullptr, 'A'}
+		{"private_api_key", required_argument, nullptr, 'A'},
+		
+		// Private batch window
+		{"private_batch_window", required_argument, nullptr, 'B'},
+		
+		// Private batch size
+		{"private_batch_size", required_argument, nullptr, 'N'}
 	};
 }
 
@@ -223,6 +309,8 @@ void PrivateServer::displayOptionsHelp() {
 	cout << "\t-c, --private_certificate\tSets the TLS certificate file for the private server" << endl;
 	cout << "\t-k, --private_key\t\tSets the TLS private key file for the private server" << endl;
 	cout << "\t-A, --private_api_key\t\tSets an API key that the private server will require all requests to contain" << endl;
+	cout << "\t-B, --private_batch_window\tSets the number of milliseconds that the private server waits for more create payment requests before creating their payments in one database transaction (default: " << DEFAULT_BATCH_WINDOW_MILLISECONDS << ')' << endl;
+	cout << "\t-N, --private_batch_size\tSets the maximum number of create payment requests that the private server creates payments for in one database transaction (default: " << DEFAULT_BATCH_SIZE << ')' << endl;
 }
 
 // Validate option
@@ -239,7 +327,7 @@ bool PrivateServer::validateOption(const char option, const char *value, char *a
 			
 				// Display message
 				cout << argv[0] << ": invalid private address -- '" << (value ? value : "") << '\'' << endl;
-		
+				
 				// Return false
 				return false;
 			}
@@ -258,7 +346,7 @@ bool PrivateServer::validateOption(const char option, const char *value, char *a
 			
 				// Display message
 				cout << argv[0] << ": invalid private port -- '" << (value ? value : "") << '\'' << endl;
-		
+				
 				// Return false
 				return false;
 			}
@@ -275,7 +363,7 @@ bool PrivateServer::validateOption(const char option, const char *value, char *a
 			
 				// Display message
 				cout << argv[0] << ": invalid private certificate -- '" << (value ? value : "") << '\'' << endl;
-		
+				
 				// Return false
 				return false;
 			}
@@ -291,7 +379,7 @@ bool PrivateServer::validateOption(const char option, const char *value, char *a
 			
 				// Display message
 				cout << argv[0] << ": invalid private key -- '" << (value ? value : "") << '\'' << endl;
-		
+				
 				// Return false
 				return false;
 			}
@@ -307,13 +395,53 @@ bool PrivateServer::validateOption(const char option, const char *value, char *a
 			
 				// Display message
 				cout << argv[0] << ": invalid private API key -- '" << (value ? value : "") << '\'' << endl;
+				
+				// Return false
+				return false;
+			}
+			
+			// Break
+			break;
+		
+		// Private batch window
+		case 'B': {
+		
+			// Check if private batch window is invalid
+			char *end;
+			errno = 0;
+			const unsigned long batchWindow = value ? strtoul(value, &end, Common::DECIMAL_NUMBER_BASE) : 0;
+			if(!value || end == value || *end || !isdigit(value[0]) || (value[0] == '0' && isdigit(value[1])) || errno || batchWindow > numeric_limits<uint16_t>::max()) {
+			
+				// Display message
+				cout << argv[0] << ": invalid private batch window -- '" << (value ? value : "") << '\'' << endl;
+				
+				// Return false
+				return false;
+			}
+			
+			// Break
+			break;
+		}
+		
+		// Private batch size
+		case 'N': {
 		
+			// Check if private batch size is invalid
+			char *end;
+			errno = 0;
+			const unsigned long batchSize = value ? strtoul(value, &end, Common::DECIMAL_NUMBER_BASE) : 0;
+			if(!value || end == value || *end || !isdigit(value[0]) || (value[0] == '0' && isdigit(value[1])) || errno || !batchSize || batchSize > numeric_limits<uint16_t>::max()) {
+			
+				// Display message
+				cout << argv[0] << ": invalid private batch size -- '" << (value ? value : "") << '\'' << endl;
+				
 				// Return false
 				return false;
 			}
 			
 			// Break
 			break;
+		}
 	}
 	
 	// Return true
@@ -322,10 +450,10 @@ bool PrivateServer::validateOption(const char option, const char *value, char *a
 
 // Run
 void PrivateServer::run(const unordered_map<char, const char *> &providedOptions, const filesystem::path &currentDirectory) {
-	
+
 	// Try
 	try {
-		
+	
 		// Check if creating HTTP server failed
 		const unique_ptr<evhttp, decltype(&evhttp_free)> httpServer(evhttp_new(eventBase.get()), evhttp_free);
 		if(!httpServer) {
@@ -340,8 +468,8 @@ void PrivateServer::run(const unordered_map<char, const char *> &providedOptions
 		// Set HTTP server's maximum body size
 		evhttp_set_max_body_size(httpServer.get(), MAXIMUM_BODY_SIZE);
 		
-		// Set HTTP server to only allow GET requests
-		evhttp_set_allowed_methods(httpServer.get(), EVHTTP_REQ_GET);
+		// Set HTTP server to only allow GET and POST requests
+		evhttp_set_allowed_methods(httpServer.get(), EVHTTP_REQ_GET | EVHTTP_REQ_POST);
 		
 		// Get certificate from provided options
 		const char *certificate = providedOptions.contains('c') ? providedOptions.at('c') : nullptr;
@@ -366,7 +494,7 @@ void PrivateServer::run(const unordered_map<char, const char *> &providedOptions
 			// Display message
 			osyncstream(cout) << "Using provided private server certificate: " << certificate << endl;
 			osyncstream(cout) << "Using provided private server key: " << key << endl;
-		
+			
 			// Check if getting TLS method failed
 			const SSL_METHOD *tlsMethod = TLS_server_method();
 			if(!tlsMethod) {
@@ -402,7 +530,7 @@ void PrivateServer::run(const unordered_map<char, const char *> &providedOptions
 			
 				// Get TLS context from argument
 				SSL_CTX *tlsContext = reinterpret_cast<SSL_CTX *>(argument);
-			
+				
 				// Check if creating TLS connection failed
 				unique_ptr<SSL, decltype(&SSL_free)> tlsConnection(SSL_new(tlsContext), SSL_free);
 				if(!tlsConnection) {
@@ -439,21 +567,21 @@ void PrivateServer::run(const unordered_map<char, const char *> &providedOptions
 				return bufferEvent;
 			
 			}), tlsContext.get());
-		
+			
 			// Set HTTP server new request callback
 			evhttp_set_newreqcb(httpServer.get(), [](evhttp_request *request, void *argument) -> int {
 			
 				// Check if request's connection exists
 				evhttp_connection *requestsConnection = evhttp_request_get_connection(request);
 				if(requestsConnection) {
-			
+				
 					// Set request's connection close callback
 					evhttp_connection_set_closecb(requestsConnection, [](evhttp_connection *connection, void *argument) {
-						
+					
 						// Check if connection's buffer event exists
 						bufferevent *bufferEvent = evhttp_connection_get_bufferevent(connection);
 						if(bufferEvent) {
-
+						
 							// Check if buffer event's TLS connection exists
 							SSL *tlsConnection = bufferevent_openssl_get_ssl(bufferEvent);
 							if(tlsConnection) {
@@ -467,7 +595,7 @@ void PrivateServer::run(const unordered_map<char, const char *> &providedOptions
 				
 				// Return success
 				return 0;
-				
+			
 			}, nullptr);
 		}
 		
@@ -481,6 +609,94 @@ void PrivateServer::run(const unordered_map<char, const char *> &providedOptions
 			osyncstream(cout) << "Using provided private server API key: " << apiKey << endl;
 		}
 		
+		// Get batch window from provided options
+		const chrono::milliseconds batchWindowMilliseconds(providedOptions.contains('B') ? strtoul(providedOptions.at('B'), nullptr, Common::DECIMAL_NUMBER_BASE) : DEFAULT_BATCH_WINDOW_MILLISECONDS);
+		
+		// Check if a private server batch window is provided
+		if(providedOptions.contains('B')) {
+		
+			// Display message
+			osyncstream(cout) << "Using provided private server batch window: " << batchWindowMilliseconds.count() << endl;
+		}
+		
+		// Set batch window
+		batchWindow = {
+		
+			// Seconds
+			.tv_sec = chrono::duration_cast<chrono::seconds>(batchWindowMilliseconds).count(),
+			
+			// Microseconds
+			.tv_usec = chrono::duration_cast<chrono::microseconds>(batchWindowMilliseconds % chrono::seconds(1)).count()
+		};
+		
+		// Get batch size from provided options
+		batchSize = providedOptions.contains('N') ? strtoul(providedOptions.at('N'), nullptr, Common::DECIMAL_NUMBER_BASE) : DEFAULT_BATCH_SIZE;
+		
+		// Check if a private server batch size is provided
+		if(providedOptions.contains('N')) {
+		
+			// Display message
+			osyncstream(cout) << "Using provided private server batch size: " << batchSize << endl;
+		}
+		
+		// Check if creating batch timer failed
+		batchTimer = unique_ptr<event, decltype(&event_free)>(evtimer_new(eventBase.get(), [](const evutil_socket_t fileDescriptor, const short signal, void *argument) {
+		
+			// Get self from argument
+			PrivateServer *self = reinterpret_cast<PrivateServer *>(argument);
+			
+			// Create pending payments
+			self->createPendingPayments();
+		
+		}, this), event_free);
+		
+		if(!batchTimer) {
+		
+			// Throw exception
+			throw runtime_error("Creating private server batch timer failed");
+		}
+		
+		// Check if creating payment changes event failed
+		paymentChangesEvent = unique_ptr<event, decltype(&event_free)>(event_new(eventBase.get(), -1, 0, [](const evutil_socket_t fileDescriptor, const short signal, void *argument) {
+		
+			// Get self from argument
+			PrivateServer *self = reinterpret_cast<PrivateServer *>(argument);
+			
+			// Reply to payment watchers
+			self->replyToPaymentWatchers();
+		
+		}, this), event_free);
+		
+		if(!paymentChangesEvent) {
+		
+			// Throw exception
+			throw runtime_error("Creating private server payment changes event failed");
+		}
+		
+		// Check if creating payment watchers timer failed
+		paymentWatchersTimer = unique_ptr<event, decltype(&event_free)>(event_new(eventBase.get(), -1, EV_PERSIST, [](const evutil_socket_t fileDescriptor, const short signal, void *argument) {
+		
+			// Get self from argument
+			PrivateServer *self = reinterpret_cast<PrivateServer *>(argument);
+			
+			// Reply to payment watchers
+			self->replyToPaymentWatchers();
+		
+		}, this), event_free);
+		
+		if(!paymentWatchersTimer) {
+		
+			// Throw exception
+			throw runtime_error("Creating private server payment watchers timer failed");
+		}
+		
+		// Set payments' payment changes listener
+		payments.setPaymentChangesListener([this]() {
+		
+			// Activate payment changes event so that payment watchers are replied to on the event loop
+			event_active(paymentChangesEvent.get(), EV_TIMEOUT, 0);
+		});
+		
 		// Check if setting HTTP server create payment request callback failed
 		if(evhttp_set_cb(httpServer.get(), "/create_payment", ([](evhttp_request *request, void *argument) {
 		
@@ -512,6 +728,37 @@ void PrivateServer::run(const unordered_map<char, const char *> &providedOptions
 			throw runtime_error("Setting private server HTTP server create payment request callback failed");
 		}
 		
+		// Check if setting HTTP server create payments request callback failed
+		if(evhttp_set_cb(httpServer.get(), "/create_payments", ([](evhttp_request *request, void *argument) {
+		
+			// Get self from argument
+			PrivateServer *self = reinterpret_cast<PrivateServer *>(argument);
+			
+			// Try
+			try {
+			
+				// Handle create payments request
+				self->handleCreatePaymentsRequest(request);
+			}
+			
+			// Catch errors
+			catch(...) {
+			
+				// Remove request's response's content type header
+				if(evhttp_request_get_output_headers(request)) {
+				
+					evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+				}
+				
+				// Reply with internal server error response to request
+				evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+			}
+		}), this)) {
+		
+			// Throw exception
+			throw runtime_error("Setting private server HTTP server create payments request callback failed");
+		}
+		
 		// Check if setting HTTP server get payment info request callback failed
 		if(evhttp_set_cb(httpServer.get(), "/get_payment_info", ([](evhttp_request *request, void *argument) {
 		
@@ -533,7 +780,7 @@ void PrivateServer::run(const unordered_map<char, const char *> &providedOptions
 				
 					evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 				}
-			
+				
 				// Reply with internal server error response to request
 				evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
 			}
@@ -543,6 +790,99 @@ void PrivateServer::run(const unordered_map<char, const char *> &providedOptions
 			throw runtime_error("Setting private server HTTP server get payment info request callback failed");
 		}
 		
+		// Check if setting HTTP server get payments info request callback failed
+		if(evhttp_set_cb(httpServer.get(), "/get_payments_info", ([](evhttp_request *request, void *argument) {
+		
+			// Get self from argument
+			PrivateServer *self = reinterpret_cast<PrivateServer *>(argument);
+			
+			// Try
+			try {
+			
+				// Handle get payments info request
+				self->handleGetPaymentsInfoRequest(request);
+			}
+			
+			// Catch errors
+			catch(...) {
+			
+				// Remove request's response's content type header
+				if(evhttp_request_get_output_headers(request)) {
+				
+					evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+				}
+				
+				// Reply with internal server error response to request
+				evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+			}
+		}), this)) {
+		
+			// Throw exception
+			throw runtime_error("Setting private server HTTP server get payments info request callback failed");
+		}
+		
+		// Check if setting HTTP server list payments request callback failed
+		if(evhttp_set_cb(httpServer.get(), "/list_payments", ([](evhttp_request *request, void *argument) {
+		
+			// Get self from argument
+			PrivateServer *self = reinterpret_cast<PrivateServer *>(argument);
+			
+			// Try
+			try {
+			
+				// Handle list payments request
+				self->handleListPaymentsRequest(request);
+			}
+			
+			// Catch errors
+			catch(...) {
+			
+				// Remove request's response's content type header
+				if(evhttp_request_get_output_headers(request)) {
+				
+					evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+				}
+				
+				// Reply with internal server error response to request
+				evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+			}
+		}), this)) {
+		
+			// Throw exception
+			throw runtime_error("Setting private server HTTP server list payments request callback failed");
+		}
+		
+		// Check if setting HTTP server watch payments request callback failed
+		if(evhttp_set_cb(httpServer.get(), "/watch_payments", ([](evhttp_request *request, void *argument) {
+		
+			// Get self from argument
+			PrivateServer *self = reinterpret_cast<PrivateServer *>(argument);
+			
+			// Try
+			try {
+			
+				// Handle watch payments request
+				self->handleWatchPaymentsRequest(request);
+			}
+			
+			// Catch errors
+			catch(...) {
+			
+				// Remove request's response's content type header
+				if(evhttp_request_get_output_headers(request)) {
+				
+					evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+				}
+				
+				// Reply with internal server error response to request
+				evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+			}
+		}), this)) {
+		
+			// Throw exception
+			throw runtime_error("Setting private server HTTP server watch payments request callback failed");
+		}
+		
 		// Check if not disabling price
 		if(!priceDisable) {
 		
@@ -630,7 +970,7 @@ void PrivateServer::run(const unordered_map<char, const char *> &providedOptions
 			
 			// Reply with not found response to request
 			evhttp_send_reply(request, HTTP_NOTFOUND, nullptr, nullptr);
-			
+		
 		}), nullptr);
 		
 		// Get address from provided options
@@ -681,8 +1021,28 @@ void PrivateServer::run(const unordered_map<char, const char *> &providedOptions
 		// Set started
 		started.store(true);
 		
+		// Run event loop
+		const int eventLoopResult = event_base_dispatch(eventBase.get());
+		
+		// Check if payments are pending
+		if(!pendingPayments.empty()) {
+		
+			// Remove batch timer
+			event_del(batchTimer.get());
+			
+			// Create pending payments
+			createPendingPayments();
+			
+			// Check if sending pending payments' replies failed
+			if(event_base_loop(eventBase.get(), EVLOOP_NONBLOCK) == -1) {
+			
+				// Throw exception
+				throw runtime_error("Sending private server pending payments' replies failed");
+			}
+		}
+		
 		// Check if running event loop failed
-		if(event_base_dispatch(eventBase.get()) == -1) {
+		if(eventLoopResult == -1) {
 		
 			// Throw exception
 			throw runtime_error("Running private server event loop failed");
@@ -770,142 +1130,181 @@ void PrivateServer::handleCreatePaymentRequest(evhttp_request *request) {
 		return;
 	}
 	
-	// Check if price parameter is provided
+	// Check if getting create payment parameters failed
 	uint64_t price;
-	const char *priceParameter = evhttp_find_header(&queryValues, "price");
-	if(priceParameter) {
+	uint32_t requiredConfirmations;
+	uint32_t timeout;
+	const char *completedCallback;
+	const char *receivedCallback;
+	const char *confirmedCallback;
+	const char *expiredCallback;
+	const char *notes;
+	if(!getCreatePaymentParameters(price, requiredConfirmations, timeout, completedCallback, receivedCallback, confirmedCallback, expiredCallback, notes, [&queryValues](const char *name) -> const char * {
 	
-		// Check if price parameter before decimal is invalid
-		char *end;
-		errno = 0;
-		const unsigned long long priceNumber = strtoull(priceParameter, &end, Common::DECIMAL_NUMBER_BASE);
-		if(end == priceParameter || (*end && *end != '.') || !isdigit(priceParameter[0]) || (priceParameter[0] == '0' && isdigit(priceParameter[1])) || errno || priceNumber > numeric_limits<decltype(price)>::max() / Consensus::NUMBER_BASE) {
+		// Return query value with the name
+		return evhttp_find_header(&queryValues, name);
+	})) {
+	
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
 		
-			// Reply with bad request response to request
-			evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
-			
-			// Return
-			return;
-		}
+		// Return
+		return;
+	}
+	
+	// Check if creating random ID and URL failed
+	uint64_t id;
+	char url[Payments::URL_SIZE + sizeof('\0')];
+	if(!createRandomIdAndUrl(id, url)) {
+	
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
 		
-		// Set price to provided value in number base
-		price = priceNumber * Consensus::NUMBER_BASE;
+		// Return
+		return;
+	}
+	
+	// Check if there's no pending payments and adding batch timer failed
+	if(pendingPayments.empty() && evtimer_add(batchTimer.get(), &batchWindow)) {
+	
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
 		
-		// Check if price parameter has a decimal
-		if(*end == '.') {
+		// Return
+		return;
+	}
+	
+	// Add payment to pending payments so that it's created in the same database transaction as other payments requested around the same time
+	pendingPayments.emplace_back(request, id, string(url), price, requiredConfirmations, timeout, completedCallback, receivedCallback ? optional<string>(receivedCallback) : nullopt, confirmedCallback ? optional<string>(confirmedCallback) : nullopt, expiredCallback ? optional<string>(expiredCallback) : nullopt, notes ? optional<string>(notes) : nullopt);
+	
+	// Check if pending payments is full
+	if(pendingPayments.size() >= batchSize) {
+	
+		// Remove batch timer
+		event_del(batchTimer.get());
 		
-			// Check if price parameter after decimal is invalid
-			const char *priceDecimalParameter = &end[sizeof('.')];
-			errno = 0;
-			const unsigned long long priceDecimal = strtoull(priceDecimalParameter, &end, Common::DECIMAL_NUMBER_BASE);
-			
-			if(end == priceDecimalParameter || *end || !isdigit(priceDecimalParameter[0]) || errno || priceDecimal >= static_cast<unsigned long long>(Consensus::NUMBER_BASE) || price > numeric_limits<decltype(price)>::max() - priceDecimal * static_cast<unsigned long long>(pow(10, ceil(log10(Consensus::NUMBER_BASE)) - (end - priceDecimalParameter)))) {
-			
-				// Reply with bad request response to request
-				evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
-				
-				// Return
-				return;
-			}
-			
-			// Update price to include decimal part
-			price += priceDecimal * static_cast<unsigned long long>(pow(10, ceil(log10(Consensus::NUMBER_BASE)) - (end - priceDecimalParameter)));
+		// Create pending payments
+		createPendingPayments();
+	}
+}
+
+// Handle create payments request
+void PrivateServer::handleCreatePaymentsRequest(evhttp_request *request) {
+
+	// Check if setting request's response's cache control header failed
+	if(!evhttp_request_get_output_headers(request) || evhttp_add_header(evhttp_request_get_output_headers(request), "Cache-Control", "no-store, no-transform")) {
+	
+		// Remove request's response's cache control header
+		if(evhttp_request_get_output_headers(request)) {
+		
+			evhttp_remove_header(evhttp_request_get_output_headers(request), "Cache-Control");
 		}
 		
-		// Check if price is zero
-		if(!price) {
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
 		
-			// Reply with bad request response to request
-			evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
-			
-			// Return
-			return;
-		}
+		// Return
+		return;
 	}
 	
-	// Otherwise
-	else {
+	// Check if request isn't a POST request
+	if(evhttp_request_get_command(request) != EVHTTP_REQ_POST) {
 	
-		// Set price to be any price
-		price = Payments::ANY_PRICE;
+		// Reply with bad method response to request
+		evhttp_send_reply(request, HTTP_BADMETHOD, nullptr, nullptr);
+		
+		// Return
+		return;
 	}
 	
-	// Check if required confirmations parameter is provided
-	uint32_t requiredConfirmations;
-	const char *requiredConfirmationsParameter = evhttp_find_header(&queryValues, "required_confirmations");
-	if(requiredConfirmationsParameter) {
+	// Check if request doesn't have a URI
+	const evhttp_uri *uri = evhttp_request_get_evhttp_uri(request);
+	if(!uri) {
 	
-		// Check if required confirmations parameter is invalid
-		char *end;
-		errno = 0;
-		const unsigned long requiredConfirmationsNumber = strtoul(requiredConfirmationsParameter, &end, Common::DECIMAL_NUMBER_BASE);
-		if(end == requiredConfirmationsParameter || *end || !isdigit(requiredConfirmationsParameter[0]) || (requiredConfirmationsParameter[0] == '0' && isdigit(requiredConfirmationsParameter[1])) || errno || !requiredConfirmationsNumber || requiredConfirmationsNumber > numeric_limits<decltype(requiredConfirmations)>::max()) {
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
 		
-			// Reply with bad request response to request
-			evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
-			
-			// Return
-			return;
-		}
+		// Return
+		return;
+	}
+	
+	// Check if parsing the URI's query string failed
+	evkeyvalq queryValues;
+	if(!evhttp_uri_get_query(uri) || evhttp_parse_query_str(evhttp_uri_get_query(uri), &queryValues)) {
+	
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
 		
-		// Set required confirmations to provided value
-		requiredConfirmations = requiredConfirmationsNumber;
+		// Return
+		return;
 	}
 	
-	// Otherwise
-	else {
+	// Automatically free query values when done
+	const unique_ptr<evkeyvalq, decltype(&evhttp_clear_headers)> queryValuesUniquePointer(&queryValues, evhttp_clear_headers);
 	
-		// Set required confirmations to be confirmed when on-chain
-		requiredConfirmations = Payments::CONFIRMED_WHEN_ON_CHAIN;
+	// Check if verifying API key failed
+	if(!verifyApiKey(queryValues)) {
+	
+		// Reply with forbidden response to request
+		evhttp_send_reply(request, HTTP_FORBIDDEN, nullptr, nullptr);
+		
+		// Return
+		return;
 	}
 	
-	// Check if timeout parameter is provided
-	uint32_t timeout;
-	const char *timeoutParameter = evhttp_find_header(&queryValues, "timeout");
-	if(timeoutParameter) {
+	// Check if request doesn't contain POST data
+	evbuffer *postDataBuffer = evhttp_request_get_input_buffer(request);
+	if(!postDataBuffer || !evbuffer_get_length(postDataBuffer)) {
 	
-		// Check if timeout parameter is invalid
-		char *end;
-		errno = 0;
-		const unsigned long timeoutNumber = strtoul(timeoutParameter, &end, Common::DECIMAL_NUMBER_BASE);
-		if(end == timeoutParameter || *end || !isdigit(timeoutParameter[0]) || (timeoutParameter[0] == '0' && isdigit(timeoutParameter[1])) || errno || !timeoutNumber || timeoutNumber > numeric_limits<decltype(timeout)>::max()) {
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
 		
-			// Reply with bad request response to request
-			evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
-			
-			// Return
-			return;
-		}
+		// Return
+		return;
+	}
+	
+	// Get POST data's length
+	const size_t postDataLength = evbuffer_get_length(postDataBuffer);
+	
+	// Check if padded POST data is too small
+	if(paddedPostData.size() < postDataLength + simdjson::SIMDJSON_PADDING) {
+	
+		// Increase padded POST data's size
+		paddedPostData.resize(postDataLength + simdjson::SIMDJSON_PADDING);
+	}
+	
+	// Check if copying POST data to the padded POST data failed
+	if(evbuffer_copyout(postDataBuffer, paddedPostData.data(), postDataLength) != static_cast<ev_ssize_t>(postDataLength)) {
+	
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
 		
-		// Set timeout to provided value
-		timeout = timeoutNumber;
+		// Return
+		return;
 	}
 	
-	// Otherwise
-	else {
+	// Initialize JSON
+	simdjson::dom::array json;
 	
-		// Set timeout to no timeout
-		timeout = Payments::NO_TIMEOUT;
+	// Try
+	try {
+	
+		// Parse POST data as a JSON array
+		json = jsonParser.parse(paddedPostData.data(), postDataLength, false).get_array();
 	}
 	
-	// Check if completed callback parameter is provided and it's not too long
-	const char *completedCallback = evhttp_find_header(&queryValues, "completed_callback");
-	if(completedCallback && strlen(completedCallback) <= Payments::MAXIMUM_COMPLETED_CALLBACK_SIZE) {
+	// Catch errors
+	catch(...) {
 	
-		// Check if completed callback is invalid
-		const unique_ptr<evhttp_uri, decltype(&evhttp_uri_free)> completedCallbackUri(evhttp_uri_parse(completedCallback), evhttp_uri_free);
-		if(!completedCallbackUri || (strncasecmp(completedCallback, "http://", sizeof("http://") - sizeof('\0')) && strncasecmp(completedCallback, "https://", sizeof("https://") - sizeof('\0'))) || !evhttp_uri_get_scheme(completedCallbackUri.get()) || !evhttp_uri_get_host(completedCallbackUri.get()) || evhttp_uri_get_unixsocket(completedCallbackUri.get()) || evhttp_uri_get_fragment(completedCallbackUri.get()) || (strcasecmp(evhttp_uri_get_scheme(completedCallbackUri.get()), "http") && strcasecmp(evhttp_uri_get_scheme(completedCallbackUri.get()), "https")) || !*evhttp_uri_get_host(completedCallbackUri.get()) || !evhttp_uri_get_port(completedCallbackUri.get())) {
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
 		
-			// Reply with bad request response to request
-			evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
-			
-			// Return
-			return;
-		}
+		// Return
+		return;
 	}
 	
-	// Otherwise
-	else {
+	// Check if JSON doesn't contain any payments or it contains too many payments
+	if(!json.size() || json.size() > MAXIMUM_NUMBER_OF_CREATE_PAYMENTS) {
 	
 		// Reply with bad request response to request
 		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
@@ -914,27 +1313,24 @@ void PrivateServer::handleCreatePaymentRequest(evhttp_request *request) {
 		return;
 	}
 	
-	// Check if received callback parameter is provided
-	const char *receivedCallback = evhttp_find_header(&queryValues, "received_callback");
-	if(receivedCallback) {
+	// Initialize IDs and URLs
+	vector<uint64_t> ids(json.size());
+	vector<string> urls(json.size(), string(Payments::URL_SIZE, '\0'));
 	
-		// Check if received callback parameter isn't too long
-		if(strlen(receivedCallback) <= Payments::MAXIMUM_RECEIVED_CALLBACK_SIZE) {
+	// Initialize number parameters
+	list<string> numberParameters;
 	
-			// Check if received callback is invalid
-			const unique_ptr<evhttp_uri, decltype(&evhttp_uri_free)> receivedCallbackUri(evhttp_uri_parse(receivedCallback), evhttp_uri_free);
-			if(!receivedCallbackUri || (strncasecmp(receivedCallback, "http://", sizeof("http://") - sizeof('\0')) && strncasecmp(receivedCallback, "https://", sizeof("https://") - sizeof('\0'))) || !evhttp_uri_get_scheme(receivedCallbackUri.get()) || !evhttp_uri_get_host(receivedCallbackUri.get()) || evhttp_uri_get_unixsocket(receivedCallbackUri.get()) || evhttp_uri_get_fragment(receivedCallbackUri.get()) || (strcasecmp(evhttp_uri_get_scheme(receivedCallbackUri.get()), "http") && strcasecmp(evhttp_uri_get_scheme(receivedCallbackUri.get()), "https")) || !*evhttp_uri_get_host(receivedCallbackUri.get()) || !evhttp_uri_get_port(receivedCallbackUri.get())) {
-			
-				// Reply with bad request response to request
-				evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
-				
-				// Return
-				return;
-			}
-		}
-		
-		// Otherwise
-		else {
+	// Initialize current price
+	string currentPrice;
+	
+	// Initialize new payments
+	list<tuple<uint64_t, const char *, uint64_t, uint32_t, uint32_t, const char *, const char *, const char *, const char *, const char *, const char *>> newPayments;
+	
+	// Go through all payments in the JSON
+	for(size_t i = 0; const simdjson::dom::element payment : json) {
+	
+		// Check if payment isn't an object
+		if(!payment.is_object()) {
 		
 			// Reply with bad request response to request
 			evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
@@ -942,36 +1338,46 @@ void PrivateServer::handleCreatePaymentRequest(evhttp_request *request) {
 			// Return
 			return;
 		}
-	}
-	
-	// Otherwise
-	else {
-	
-		// Set received callback to no received callback
-		receivedCallback = Payments::NO_RECEIVED_CALLBACK;
-	}
-	
-	// Check if confirmed callback parameter is provided
-	const char *confirmedCallback = evhttp_find_header(&queryValues, "confirmed_callback");
-	if(confirmedCallback) {
-	
-		// Check if confirmed callback parameter isn't too long
-		if(strlen(confirmedCallback) <= Payments::MAXIMUM_CONFIRMED_CALLBACK_SIZE) {
-	
-			// Check if confirmed callback is invalid
-			const unique_ptr<evhttp_uri, decltype(&evhttp_uri_free)> confirmedCallbackUri(evhttp_uri_parse(confirmedCallback), evhttp_uri_free);
-			if(!confirmedCallbackUri || (strncasecmp(confirmedCallback, "http://", sizeof("http://") - sizeof('\0')) && strncasecmp(confirmedCallback, "https://", sizeof("https://") - sizeof('\0'))) || !evhttp_uri_get_scheme(confirmedCallbackUri.get()) || !evhttp_uri_get_host(confirmedCallbackUri.get()) || evhttp_uri_get_unixsocket(confirmedCallbackUri.get()) || evhttp_uri_get_fragment(confirmedCallbackUri.get()) || (strcasecmp(evhttp_uri_get_scheme(confirmedCallbackUri.get()), "http") && strcasecmp(evhttp_uri_get_scheme(confirmedCallbackUri.get()), "https")) || !*evhttp_uri_get_host(confirmedCallbackUri.get()) || !evhttp_uri_get_port(confirmedCallbackUri.get())) {
+		
+		// Check if getting payment's create payment parameters failed
+		uint64_t price;
+		uint32_t requiredConfirmations;
+		uint32_t timeout;
+		const char *completedCallback;
+		const char *receivedCallback;
+		const char *confirmedCallback;
+		const char *expiredCallback;
+		const char *notes;
+		if(!getCreatePaymentParameters(price, requiredConfirmations, timeout, completedCallback, receivedCallback, confirmedCallback, expiredCallback, notes, [&payment, &numberParameters](const char *name) -> const char * {
+		
+			// Check if payment doesn't have the value
+			simdjson::dom::element value;
+			if(payment[name].get(value) != simdjson::SUCCESS) {
+			
+				// Return no value
+				return nullptr;
+			}
+			
+			// Check if value is a string
+			if(value.is_string()) {
 			
-				// Reply with bad request response to request
-				evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+				// Return value
+				return value.get_c_str();
+			}
+			
+			// Check if value is a number
+			if(value.is_uint64()) {
+			
+				// Append value as a string to the number parameters
+				numberParameters.push_back(to_string(value.get_uint64().value()));
 				
-				// Return
-				return;
+				// Return value as a string
+				return numberParameters.back().c_str();
 			}
-		}
-		
-		// Otherwise
-		else {
+			
+			// Return invalid value
+			return "";
+		})) {
 		
 			// Reply with bad request response to request
 			evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
@@ -979,106 +1385,34 @@ void PrivateServer::handleCreatePaymentRequest(evhttp_request *request) {
 			// Return
 			return;
 		}
+		
+		// Check if creating random ID and URL failed
+		if(!createRandomIdAndUrl(ids[i], urls[i].data())) {
+		
+			// Reply with internal server error response to request
+			evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+			
+			// Return
+			return;
+		}
+		
+		// Check if payment has a price, price isn't disabled, and current price hasn't been obtained
+		if(price != Payments::ANY_PRICE && !priceDisable && currentPrice.empty()) {
+		
+			// Get current price
+			currentPrice = this->price.getCurrentPrice();
+		}
+		
+		// Append payment to new payments
+		newPayments.emplace_back(ids[i], urls[i].data(), price, requiredConfirmations, timeout, completedCallback, receivedCallback, confirmedCallback, expiredCallback, (price == Payments::ANY_PRICE || priceDisable) ? nullptr : currentPrice.c_str(), notes);
+		
+		// Increment index
+		++i;
 	}
 	
-	// Otherwise
-	else {
-	
-		// Set confirmed callback to no confirmed callback
-		confirmedCallback = Payments::NO_CONFIRMED_CALLBACK;
-	}
-	
-	// Check if expired callback parameter is provided
-	const char *expiredCallback = evhttp_find_header(&queryValues, "expired_callback");
-	if(expiredCallback) {
-	
-		// Check if expired callback parameter isn't too long and a timeout parameter is provided
-		if(strlen(expiredCallback) <= Payments::MAXIMUM_EXPIRED_CALLBACK_SIZE && timeout != Payments::NO_TIMEOUT) {
-	
-			// Check if expired callback is invalid
-			const unique_ptr<evhttp_uri, decltype(&evhttp_uri_free)> expiredCallbackUri(evhttp_uri_parse(expiredCallback), evhttp_uri_free);
-			if(!expiredCallbackUri || (strncasecmp(expiredCallback, "http://", sizeof("http://") - sizeof('\0')) && strncasecmp(expiredCallback, "https://", sizeof("https://") - sizeof('\0'))) || !evhttp_uri_get_scheme(expiredCallbackUri.get()) || !evhttp_uri_get_host(expiredCallbackUri.get()) || evhttp_uri_get_unixsocket(expiredCallbackUri.get()) || evhttp_uri_get_fragment(expiredCallbackUri.get()) || (strcasecmp(evhttp_uri_get_scheme(expiredCallbackUri.get()), "http") && strcasecmp(evhttp_uri_get_scheme(expiredCallbackUri.get()), "https")) || !*evhttp_uri_get_host(expiredCallbackUri.get()) || !evhttp_uri_get_port(expiredCallbackUri.get())) {
-			
-				// Reply with bad request response to request
-				evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
-				
-				// Return
-				return;
-			}
-		}
-		
-		// Otherwise
-		else {
-		
-			// Reply with bad request response to request
-			evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
-			
-			// Return
-			return;
-		}
-	}
-	
-	// Otherwise
-	else {
-	
-		// Set expired callback to no expired callback
-		expiredCallback = Payments::NO_EXPIRED_CALLBACK;
-	}
-	
-	// Check if notes parameter is provided
-	const char *notes = evhttp_find_header(&queryValues, "notes");
-	if(notes) {
-	
-		// Check if notes parameter is invalid
-		if(!*notes || strlen(notes) > Payments::MAXIMUM_NOTES_SIZE || !Common::isValidUtf8String(reinterpret_cast<const uint8_t *>(notes), strlen(notes))) {
-		
-			// Reply with bad request response to request
-			evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
-			
-			// Return
-			return;
-		}
-	}
-	
-	// Otherwise
-	else {
-	
-		// Set notes to no notes
-		notes = Payments::NO_NOTES;
-	}
-	
-	// Check if creating random ID failed
-	uint64_t id;
-	if(RAND_bytes_ex(nullptr, reinterpret_cast<uint8_t *>(&id), sizeof(id), RAND_DRBG_STRENGTH) != 1) {
-	
-		// Reply with internal server error response to request
-		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
-		
-		// Return
-		return;
-	}
-	
-	// Check if creating random URL failed
-	char url[Payments::URL_SIZE + sizeof('\0')];
-	if(RAND_bytes_ex(nullptr, reinterpret_cast<unsigned char *>(url), sizeof(url) - sizeof('\0'), RAND_DRBG_STRENGTH) != 1) {
-	
-		// Reply with internal server error response to request
-		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
-		
-		// Return
-		return;
-	}
-	
-	for(size_t i = 0; i < sizeof(url) - sizeof('\0'); ++i) {
-	
-		url[i] = Payments::URL_CHARACTERS[url[i] % (sizeof(Payments::URL_CHARACTERS) - sizeof('\0'))];
-	}
-	
-	url[Payments::URL_SIZE] = '\0';
-	
-	// Check if creating buffer failed
-	const unique_ptr<evbuffer, decltype(&evbuffer_free)> buffer(evbuffer_new(), evbuffer_free);
-	if(!buffer) {
+	// Check if creating buffer failed
+	const unique_ptr<evbuffer, decltype(&evbuffer_free)> buffer(evbuffer_new(), evbuffer_free);
+	if(!buffer) {
 	
 		// Reply with internal server error response to request
 		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
@@ -1092,7 +1426,7 @@ void PrivateServer::handleCreatePaymentRequest(evhttp_request *request) {
 	
 		// Remove request's response's content type header
 		evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-	
+		
 		// Reply with internal server error response to request
 		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
 		
@@ -1100,13 +1434,13 @@ void PrivateServer::handleCreatePaymentRequest(evhttp_request *request) {
 		return;
 	}
 	
-	// Check if creating payment failed
-	const uint64_t paymentProofIndex = payments.createPayment(id, url, price, requiredConfirmations, timeout, completedCallback, receivedCallback, confirmedCallback, expiredCallback, (price == Payments::ANY_PRICE || priceDisable) ? nullptr : this->price.getCurrentPrice().c_str(), notes);
-	if(!paymentProofIndex) {
+	// Check if creating payments failed
+	const vector<uint64_t> paymentProofIndices = payments.createPayments(newPayments);
+	if(paymentProofIndices.empty()) {
 	
 		// Remove request's response's content type header
 		evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-	
+		
 		// Reply with internal server error response to request
 		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
 		
@@ -1114,11 +1448,41 @@ void PrivateServer::handleCreatePaymentRequest(evhttp_request *request) {
 		return;
 	}
 	
-	// Get wallet's Tor payment proof address at the payment proof index
-	const string paymentProofAddress = wallet.getTorPaymentProofAddress(paymentProofIndex);
+	// Go through all new payments
+	for(size_t i = 0; const tuple<uint64_t, const char *, uint64_t, uint32_t, uint32_t, const char *, const char *, const char *, const char *, const char *, const char *> &newPayment : newPayments) {
+	
+		// Check if payment has a price
+		if(get<2>(newPayment) != Payments::ANY_PRICE) {
+		
+			// Precompute payment's output in the background since its amount is known
+			outputPrecomputer.precomputeOutput(paymentProofIndices[i], get<2>(newPayment), get<4>(newPayment));
+		}
+		
+		// Get cached or wallet's Tor payment proof address at the payment proof index
+		const string paymentProofAddress = paymentProofAddressCache.getTorPaymentProofAddress(paymentProofIndices[i]);
+		
+		// Check if adding payment info to buffer failed
+		if(evbuffer_add_printf(buffer.get(), "%s{\"payment_id\":\"%" PRIu64 "\",\"url\":\"%s\",\"recipient_payment_proof_address\":\"%s\"}", i ? "," : "[", get<0>(newPayment), get<1>(newPayment), paymentProofAddress.c_str()) == -1) {
+		
+			// Remove request's response's content type header
+			evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+			
+			// Reply with internal server error response to request
+			evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+			
+			// Return
+			return;
+		}
+		
+		// Display message
+		osyncstream(cout) << "Created payment " << get<0>(newPayment) << endl;
+		
+		// Increment index
+		++i;
+	}
 	
-	// Check if adding payment info to buffer failed
-	if(evbuffer_add_printf(buffer.get(), "{\"payment_id\":\"%" PRIu64 "\",\"url\":\"%s\",\"recipient_payment_proof_address\":\"%s\"}", id, url, paymentProofAddress.c_str()) == -1) {
+	// Check if adding end of payments info to buffer failed
+	if(evbuffer_add(buffer.get(), "]", sizeof(']'))) {
 	
 		// Remove request's response's content type header
 		evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
@@ -1130,9 +1494,6 @@ void PrivateServer::handleCreatePaymentRequest(evhttp_request *request) {
 		return;
 	}
 	
-	// Display message
-	osyncstream(cout) << "Created payment " << id << endl;
-	
 	// Reply with ok response to request
 	evhttp_send_reply(request, HTTP_OK, nullptr, buffer.get());
 }
@@ -1248,8 +1609,8 @@ void PrivateServer::handleGetPaymentInfoRequest(evhttp_request *request) {
 	// Get payment proof index from payment's unique number
 	const uint64_t &paymentProofIndex = get<0>(paymentInfo);
 	
-	// Get wallet's Tor payment proof address at the payment proof index
-	const string paymentProofAddress = wallet.getTorPaymentProofAddress(paymentProofIndex);
+	// Get cached or wallet's Tor payment proof address at the payment proof index
+	const string paymentProofAddress = paymentProofAddressCache.getTorPaymentProofAddress(paymentProofIndex);
 	
 	// Get payment's price as a string
 	const string priceString = get<2>(paymentInfo).has_value() ? '"' + Common::getNumberInNumberBase(get<2>(paymentInfo).value(), Consensus::NUMBER_BASE) + '"' : "null";
@@ -1299,8 +1660,8 @@ void PrivateServer::handleGetPaymentInfoRequest(evhttp_request *request) {
 	evhttp_send_reply(request, HTTP_OK, nullptr, buffer.get());
 }
 
-// Handle get price request
-void PrivateServer::handleGetPriceRequest(evhttp_request *request) {
+// Handle get payments info request
+void PrivateServer::handleGetPaymentsInfoRequest(evhttp_request *request) {
 
 	// Check if setting request's response's cache control header failed
 	if(!evhttp_request_get_output_headers(request) || evhttp_add_header(evhttp_request_get_output_headers(request), "Cache-Control", "no-store, no-transform")) {
@@ -1318,6 +1679,16 @@ void PrivateServer::handleGetPriceRequest(evhttp_request *request) {
 		return;
 	}
 	
+	// Check if request isn't a POST request
+	if(evhttp_request_get_command(request) != EVHTTP_REQ_POST) {
+	
+		// Reply with bad method response to request
+		evhttp_send_reply(request, HTTP_BADMETHOD, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
 	// Check if request doesn't have a URI
 	const evhttp_uri *uri = evhttp_request_get_evhttp_uri(request);
 	if(!uri) {
@@ -1329,9 +1700,9 @@ void PrivateServer::handleGetPriceRequest(evhttp_request *request) {
 		return;
 	}
 	
-	// Check if URI has a query string and parsing it failed
-	evkeyvalq queryValues = {};
-	if(evhttp_uri_get_query(uri) && evhttp_parse_query_str(evhttp_uri_get_query(uri), &queryValues)) {
+	// Check if parsing the URI's query string failed
+	evkeyvalq queryValues;
+	if(!evhttp_uri_get_query(uri) || evhttp_parse_query_str(evhttp_uri_get_query(uri), &queryValues)) {
 	
 		// Reply with bad request response to request
 		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
@@ -1353,6 +1724,99 @@ void PrivateServer::handleGetPriceRequest(evhttp_request *request) {
 		return;
 	}
 	
+	// Check if request doesn't contain POST data
+	evbuffer *postDataBuffer = evhttp_request_get_input_buffer(request);
+	if(!postDataBuffer || !evbuffer_get_length(postDataBuffer)) {
+	
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Get POST data's length
+	const size_t postDataLength = evbuffer_get_length(postDataBuffer);
+	
+	// Check if padded POST data is too small
+	if(paddedPostData.size() < postDataLength + simdjson::SIMDJSON_PADDING) {
+	
+		// Increase padded POST data's size
+		paddedPostData.resize(postDataLength + simdjson::SIMDJSON_PADDING);
+	}
+	
+	// Check if copying POST data to the padded POST data failed
+	if(evbuffer_copyout(postDataBuffer, paddedPostData.data(), postDataLength) != static_cast<ev_ssize_t>(postDataLength)) {
+	
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Initialize JSON
+	simdjson::dom::array json;
+	
+	// Try
+	try {
+	
+		// Parse POST data as a JSON array
+		json = jsonParser.parse(paddedPostData.data(), postDataLength, false).get_array();
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if JSON doesn't contain any payment IDs or it contains too many payment IDs
+	if(!json.size() || json.size() > MAXIMUM_NUMBER_OF_GET_PAYMENTS_INFO) {
+	
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Initialize payment IDs
+	vector<uint64_t> paymentIds;
+	paymentIds.reserve(json.size());
+	
+	// Go through all payment IDs in the JSON
+	for(const simdjson::dom::element paymentId : json) {
+	
+		// Check if payment ID is a number
+		if(paymentId.is_uint64()) {
+		
+			// Append payment ID to payment IDs
+			paymentIds.push_back(paymentId.get_uint64().value());
+		}
+		
+		// Otherwise check if payment ID is a valid number string
+		else if(uint64_t paymentIdNumber; paymentId.is_string() && getNumberParameter(paymentIdNumber, paymentId.get_c_str())) {
+		
+			// Append payment ID to payment IDs
+			paymentIds.push_back(paymentIdNumber);
+		}
+		
+		// Otherwise
+		else {
+		
+			// Reply with bad request response to request
+			evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+			
+			// Return
+			return;
+		}
+	}
+	
 	// Check if creating buffer failed
 	const unique_ptr<evbuffer, decltype(&evbuffer_free)> buffer(evbuffer_new(), evbuffer_free);
 	if(!buffer) {
@@ -1364,11 +1828,33 @@ void PrivateServer::handleGetPriceRequest(evhttp_request *request) {
 		return;
 	}
 	
-	// Get current price
-	const string currentPrice = price.getCurrentPrice();
+	// Check if adding start of payments info to buffer failed
+	if(evbuffer_add(buffer.get(), "[", sizeof('['))) {
 	
-	// Check if adding price to buffer failed
-	if(evbuffer_add_printf(buffer.get(), "{\"price\":\"%s\"}", currentPrice.c_str()) == -1) {
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Go through all of the payments that exist
+	bool firstPayment = true;
+	payments.getPaymentsInfo(paymentIds, [this, &buffer, &firstPayment](const uint64_t id, const tuple<uint64_t, string, optional<uint64_t>, uint64_t, bool, uint64_t, optional<uint64_t>, string> &paymentInfo) {
+	
+		// Check if adding payment info to buffer failed
+		if(!addPaymentInfoToBuffer(buffer.get(), id, paymentInfo, firstPayment)) {
+		
+			// Throw exception
+			throw runtime_error("Adding payment info to buffer failed");
+		}
+		
+		// Clear first payment
+		firstPayment = false;
+	});
+	
+	// Check if adding end of payments info to buffer failed
+	if(evbuffer_add(buffer.get(), "]", sizeof(']'))) {
 	
 		// Reply with internal server error response to request
 		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
@@ -1394,8 +1880,8 @@ void PrivateServer::handleGetPriceRequest(evhttp_request *request) {
 	evhttp_send_reply(request, HTTP_OK, nullptr, buffer.get());
 }
 
-// Handle get public server info request
-void PrivateServer::handleGetPublicServerInfoRequest(evhttp_request *request) {
+// Handle list payments request
+void PrivateServer::handleListPaymentsRequest(evhttp_request *request) {
 
 	// Check if setting request's response's cache control header failed
 	if(!evhttp_request_get_output_headers(request) || evhttp_add_header(evhttp_request_get_output_headers(request), "Cache-Control", "no-store, no-transform")) {
@@ -1424,9 +1910,9 @@ void PrivateServer::handleGetPublicServerInfoRequest(evhttp_request *request) {
 		return;
 	}
 	
-	// Check if URI has a query string and parsing it failed
-	evkeyvalq queryValues = {};
-	if(evhttp_uri_get_query(uri) && evhttp_parse_query_str(evhttp_uri_get_query(uri), &queryValues)) {
+	// Check if parsing the URI's query string failed
+	evkeyvalq queryValues;
+	if(evhttp_parse_query_str(evhttp_uri_get_query(uri) ? evhttp_uri_get_query(uri) : "", &queryValues)) {
 	
 		// Reply with bad request response to request
 		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
@@ -1448,62 +1934,1041 @@ void PrivateServer::handleGetPublicServerInfoRequest(evhttp_request *request) {
 		return;
 	}
 	
-	// Check if creating buffer failed
-	const unique_ptr<evbuffer, decltype(&evbuffer_free)> buffer(evbuffer_new(), evbuffer_free);
-	if(!buffer) {
+	// Check if status parameter is invalid
+	const char *status = evhttp_find_header(&queryValues, "status");
+	if(status && strcmp(status, "Not received") && strcmp(status, "Expired") && strcmp(status, "Received") && strcmp(status, "Confirmed") && strcmp(status, "Completed")) {
 	
-		// Reply with internal server error response to request
-		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
 		
 		// Return
 		return;
 	}
 	
-	// Check if adding public server info to buffer failed
-	if(evbuffer_add_printf(buffer.get(), "{\"url\":\"%s\",\"onion_service_address\":%s}", Common::jsonEscape(publicServerUrl.c_str()).c_str(), usingOnionService ? ("\"http://" + wallet.getOnionServiceAddress() + ".onion\"").c_str() : "null") == -1) {
+	// Check if created after parameter is invalid
+	uint64_t createdAfter = 0;
+	const char *createdAfterParameter = evhttp_find_header(&queryValues, "created_after");
+	if(createdAfterParameter && (!getNumberParameter(createdAfter, createdAfterParameter) || createdAfter > static_cast<uint64_t>(numeric_limits<int64_t>::max()))) {
 	
-		// Reply with internal server error response to request
-		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
 		
 		// Return
 		return;
 	}
 	
-	// Check if setting request's response's content type header failed
-	if(evhttp_add_header(evhttp_request_get_output_headers(request), "Content-Type", "application/json; charset=utf-8")) {
+	// Check if created before parameter is invalid
+	uint64_t createdBefore = numeric_limits<int64_t>::max();
+	const char *createdBeforeParameter = evhttp_find_header(&queryValues, "created_before");
+	if(createdBeforeParameter && (!getNumberParameter(createdBefore, createdBeforeParameter) || createdBefore > static_cast<uint64_t>(numeric_limits<int64_t>::max()))) {
 	
-		// Remove request's response's content type header
-		evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-		
-		// Reply with internal server error response to request
-		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
 		
 		// Return
 		return;
 	}
 	
-	// Reply with ok response to request
-	evhttp_send_reply(request, HTTP_OK, nullptr, buffer.get());
-}
-
-// Verify API key
-bool PrivateServer::verifyApiKey(const evkeyvalq &queryValues) const {
-
-	// Check if an API key is required
-	if(!apiKey.empty()) {
+	// Check if cursor parameter is invalid
+	uint64_t cursor = 0;
+	const char *cursorParameter = evhttp_find_header(&queryValues, "cursor");
+	if(cursorParameter && (!getNumberParameter(cursor, cursorParameter) || cursor > static_cast<uint64_t>(numeric_limits<int64_t>::max()))) {
 	
-		// Check if request doesn't have an API key or its the wrong size
-		const char *requestApiKey = evhttp_find_header(&queryValues, "api_key");
-		if(!requestApiKey || strlen(requestApiKey) != apiKey.size()) {
-		
-			// Return false
-			return false;
-		}
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
 		
-		// Return if request has the correct API key
-		return !CRYPTO_memcmp(apiKey.data(), requestApiKey, apiKey.size());
+		// Return
+		return;
 	}
 	
+	// Check if limit parameter is invalid
+	uint64_t limit = DEFAULT_LIST_PAYMENTS_LIMIT;
+	const char *limitParameter = evhttp_find_header(&queryValues, "limit");
+	if(limitParameter && (!getNumberParameter(limit, limitParameter) || !limit || limit > MAXIMUM_LIST_PAYMENTS_LIMIT)) {
+	
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if creating buffer failed
+	const unique_ptr<evbuffer, decltype(&evbuffer_free)> buffer(evbuffer_new(), evbuffer_free);
+	if(!buffer) {
+	
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if adding start of payments info to buffer failed
+	if(evbuffer_add_printf(buffer.get(), "{\"payments\":[") == -1) {
+	
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Go through all of the payments in the page
+	uint64_t numberOfPayments = 0;
+	uint64_t lastUniqueNumber = cursor;
+	payments.listPayments(status, createdAfter, createdBefore, cursor, limit, [this, &buffer, &numberOfPayments, &lastUniqueNumber](const uint64_t id, const tuple<uint64_t, string, optional<uint64_t>, uint64_t, bool, uint64_t, optional<uint64_t>, string> &paymentInfo) {
+	
+		// Check if adding payment info to buffer failed
+		if(!addPaymentInfoToBuffer(buffer.get(), id, paymentInfo, !numberOfPayments)) {
+		
+			// Throw exception
+			throw runtime_error("Adding payment info to buffer failed");
+		}
+		
+		// Increment number of payments
+		++numberOfPayments;
+		
+		// Set last unique number to the payment's unique number
+		lastUniqueNumber = get<0>(paymentInfo);
+	});
+	
+	// Check if page is full
+	if(numberOfPayments == limit) {
+	
+		// Check if adding end of payments info and next cursor to buffer failed
+		if(evbuffer_add_printf(buffer.get(), "],\"next_cursor\":\"%" PRIu64 "\"}", lastUniqueNumber) == -1) {
+		
+			// Reply with internal server error response to request
+			evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+			
+			// Return
+			return;
+		}
+	}
+	
+	// Otherwise
+	else {
+	
+		// Check if adding end of payments info and no next cursor to buffer failed
+		if(evbuffer_add_printf(buffer.get(), "],\"next_cursor\":null}") == -1) {
+		
+			// Reply with internal server error response to request
+			evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+			
+			// Return
+			return;
+		}
+	}
+	
+	// Check if setting request's response's content type header failed
+	if(evhttp_add_header(evhttp_request_get_output_headers(request), "Content-Type", "application/json; charset=utf-8")) {
+	
+		// Remove request's response's content type header
+		evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+		
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Reply with ok response to request
+	evhttp_send_reply(request, HTTP_OK, nullptr, buffer.get());
+}
+
+// Handle watch payments request
+void PrivateServer::handleWatchPaymentsRequest(evhttp_request *request) {
+
+	// Check if setting request's response's cache control header failed
+	if(!evhttp_request_get_output_headers(request) || evhttp_add_header(evhttp_request_get_output_headers(request), "Cache-Control", "no-store, no-transform")) {
+	
+		// Remove request's response's cache control header
+		if(evhttp_request_get_output_headers(request)) {
+		
+			evhttp_remove_header(evhttp_request_get_output_headers(request), "Cache-Control");
+		}
+		
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if request doesn't have a URI
+	const evhttp_uri *uri = evhttp_request_get_evhttp_uri(request);
+	if(!uri) {
+	
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if parsing the URI's query string failed
+	evkeyvalq queryValues;
+	if(evhttp_parse_query_str(evhttp_uri_get_query(uri) ? evhttp_uri_get_query(uri) : "", &queryValues)) {
+	
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Automatically free query values when done
+	const unique_ptr<evkeyvalq, decltype(&evhttp_clear_headers)> queryValuesUniquePointer(&queryValues, evhttp_clear_headers);
+	
+	// Check if verifying API key failed
+	if(!verifyApiKey(queryValues)) {
+	
+		// Reply with forbidden response to request
+		evhttp_send_reply(request, HTTP_FORBIDDEN, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if cursor parameter is invalid
+	uint64_t cursor;
+	const char *cursorParameter = evhttp_find_header(&queryValues, "cursor");
+	if(cursorParameter && !getNumberParameter(cursor, cursorParameter)) {
+	
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if cursor parameter wasn't provided
+	if(!cursorParameter) {
+	
+		// Set cursor to the last payment change so that only future payment changes are returned
+		cursor = payments.getLastPaymentChangeSequence();
+	}
+	
+	// Check if timeout parameter is invalid
+	uint64_t timeout = DEFAULT_WATCH_PAYMENTS_TIMEOUT;
+	const char *timeoutParameter = evhttp_find_header(&queryValues, "timeout");
+	if(timeoutParameter && (!getNumberParameter(timeout, timeoutParameter) || timeout > MAXIMUM_WATCH_PAYMENTS_TIMEOUT)) {
+	
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if sending payment changes replied to the request
+	if(sendPaymentChanges(request, cursor, !timeout)) {
+	
+		// Return
+		return;
+	}
+	
+	// Check if payment watchers is full
+	if(paymentWatchers.size() >= MAXIMUM_NUMBER_OF_PAYMENT_WATCHERS) {
+	
+		// Reply with service unavailable response to request
+		evhttp_send_reply(request, HTTP_SERVUNAVAIL, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if there's no payment watchers and adding payment watchers timer failed
+	if(paymentWatchers.empty() && event_add(paymentWatchersTimer.get(), &PAYMENT_WATCHERS_CHECK_INTERVAL)) {
+	
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Add request to payment watchers so that it's replied to when a payment changes or it times out
+	paymentWatchers.emplace_back(request, cursor, chrono::steady_clock::now() + chrono::seconds(timeout));
+}
+
+// Handle get price request
+void PrivateServer::handleGetPriceRequest(evhttp_request *request) {
+
+	// Check if setting request's response's cache control header failed
+	if(!evhttp_request_get_output_headers(request) || evhttp_add_header(evhttp_request_get_output_headers(request), "Cache-Control", "no-store, no-transform")) {
+	
+		// Remove request's response's cache control header
+		if(evhttp_request_get_output_headers(request)) {
+		
+			evhttp_remove_header(evhttp_request_get_output_headers(request), "Cache-Control");
+		}
+		
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if request doesn't have a URI
+	const evhttp_uri *uri = evhttp_request_get_evhttp_uri(request);
+	if(!uri) {
+	
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if URI has a query string and parsing it failed
+	evkeyvalq queryValues = {};
+	if(evhttp_uri_get_query(uri) && evhttp_parse_query_str(evhttp_uri_get_query(uri), &queryValues)) {
+	
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Automatically free query values when done
+	const unique_ptr<evkeyvalq, decltype(&evhttp_clear_headers)> queryValuesUniquePointer(&queryValues, evhttp_clear_headers);
+	
+	// Check if verifying API key failed
+	if(!verifyApiKey(queryValues)) {
+	
+		// Reply with forbidden response to request
+		evhttp_send_reply(request, HTTP_FORBIDDEN, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if creating buffer failed
+	const unique_ptr<evbuffer, decltype(&evbuffer_free)> buffer(evbuffer_new(), evbuffer_free);
+	if(!buffer) {
+	
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Get current price
+	const string currentPrice = price.getCurrentPrice();
+	
+	// Check if adding price to buffer failed
+	if(evbuffer_add_printf(buffer.get(), "{\"price\":\"%s\"}", currentPrice.c_str()) == -1) {
+	
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if setting request's response's content type header failed
+	if(evhttp_add_header(evhttp_request_get_output_headers(request), "Content-Type", "application/json; charset=utf-8")) {
+	
+		// Remove request's response's content type header
+		evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+		
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Reply with ok response to request
+	evhttp_send_reply(request, HTTP_OK, nullptr, buffer.get());
+}
+
+// Handle get public server info request
+void PrivateServer::handleGetPublicServerInfoRequest(evhttp_request *request) {
+
+	// Check if setting request's response's cache control header failed
+	if(!evhttp_request_get_output_headers(request) || evhttp_add_header(evhttp_request_get_output_headers(request), "Cache-Control", "no-store, no-transform")) {
+	
+		// Remove request's response's cache control header
+		if(evhttp_request_get_output_headers(request)) {
+		
+			evhttp_remove_header(evhttp_request_get_output_headers(request), "Cache-Control");
+		}
+		
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if request doesn't have a URI
+	const evhttp_uri *uri = evhttp_request_get_evhttp_uri(request);
+	if(!uri) {
+	
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if URI has a query string and parsing it failed
+	evkeyvalq queryValues = {};
+	if(evhttp_uri_get_query(uri) && evhttp_parse_query_str(evhttp_uri_get_query(uri), &queryValues)) {
+	
+		// Reply with bad request response to request
+		evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Automatically free query values when done
+	const unique_ptr<evkeyvalq, decltype(&evhttp_clear_headers)> queryValuesUniquePointer(&queryValues, evhttp_clear_headers);
+	
+	// Check if verifying API key failed
+	if(!verifyApiKey(queryValues)) {
+	
+		// Reply with forbidden response to request
+		evhttp_send_reply(request, HTTP_FORBIDDEN, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if creating buffer failed
+	const unique_ptr<evbuffer, decltype(&evbuffer_free)> buffer(evbuffer_new(), evbuffer_free);
+	if(!buffer) {
+	
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if adding public server info to buffer failed
+	if(evbuffer_add_printf(buffer.get(), "{\"url\":\"%s\",\"onion_service_address\":%s}", Common::jsonEscape(publicServerUrl.c_str()).c_str(), usingOnionService ? ("\"http://" + wallet.getOnionServiceAddress() + ".onion\"").c_str() : "null") == -1) {
+	
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if setting request's response's content type header failed
+	if(evhttp_add_header(evhttp_request_get_output_headers(request), "Content-Type", "application/json; charset=utf-8")) {
+	
+		// Remove request's response's content type header
+		evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+		
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Reply with ok response to request
+	evhttp_send_reply(request, HTTP_OK, nullptr, buffer.get());
+}
+
+// Create pending payments
+void PrivateServer::createPendingPayments() {
+
+	// Get pending payments
+	list<tuple<evhttp_request *, uint64_t, string, uint64_t, uint32_t, uint32_t, string, optional<string>, optional<string>, optional<string>, optional<string>>> batch = move(pendingPayments);
+	pendingPayments.clear();
+	
+	// Try
+	try {
+	
+		// Initialize current price
+		optional<string> currentPrice;
+		
+		// Initialize new payments
+		list<tuple<uint64_t, const char *, uint64_t, uint32_t, uint32_t, const char *, const char *, const char *, const char *, const char *, const char *>> newPayments;
+		
+		// Go through all pending payments
+		for(const tuple<evhttp_request *, uint64_t, string, uint64_t, uint32_t, uint32_t, string, optional<string>, optional<string>, optional<string>, optional<string>> &pendingPayment : batch) {
+		
+			// Check if payment has a price, price isn't disabled, and current price hasn't been obtained
+			if(get<3>(pendingPayment) != Payments::ANY_PRICE && !priceDisable && !currentPrice.has_value()) {
+			
+				// Get current price
+				currentPrice = this->price.getCurrentPrice();
+			}
+			
+			// Append payment to new payments
+			newPayments.emplace_back(get<1>(pendingPayment), get<2>(pendingPayment).c_str(), get<3>(pendingPayment), get<4>(pendingPayment), get<5>(pendingPayment), get<6>(pendingPayment).c_str(), get<7>(pendingPayment).has_value() ? get<7>(pendingPayment).value().c_str() : Payments::NO_RECEIVED_CALLBACK, get<8>(pendingPayment).has_value() ? get<8>(pendingPayment).value().c_str() : Payments::NO_CONFIRMED_CALLBACK, get<9>(pendingPayment).has_value() ? get<9>(pendingPayment).value().c_str() : Payments::NO_EXPIRED_CALLBACK, (get<3>(pendingPayment) == Payments::ANY_PRICE || priceDisable) ? nullptr : currentPrice.value().c_str(), get<10>(pendingPayment).has_value() ? get<10>(pendingPayment).value().c_str() : Payments::NO_NOTES);
+		}
+		
+		// Check if creating payments in one database transaction failed
+		vector<uint64_t> paymentProofIndices = payments.createPayments(newPayments);
+		if(paymentProofIndices.empty()) {
+		
+			// Go through all new payments
+			for(const tuple<uint64_t, const char *, uint64_t, uint32_t, uint32_t, const char *, const char *, const char *, const char *, const char *, const char *> &newPayment : newPayments) {
+			
+				// Create payment by itself so that one payment failing doesn't cause the other payments to fail
+				paymentProofIndices.push_back((newPayments.size() > 1) ? payments.createPayment(get<0>(newPayment), get<1>(newPayment), get<2>(newPayment), get<3>(newPayment), get<4>(newPayment), get<5>(newPayment), get<6>(newPayment), get<7>(newPayment), get<8>(newPayment), get<9>(newPayment), get<10>(newPayment)) : 0);
+			}
+		}
+		
+		// Go through all pending payments
+		for(size_t i = 0; !batch.empty(); ++i) {
+		
+			// Get pending payment's request
+			evhttp_request *request = get<0>(batch.front());
+			
+			// Get pending payment's ID and URL
+			const uint64_t id = get<1>(batch.front());
+			const string &url = get<2>(batch.front());
+			
+			// Check if creating buffer failed
+			const unique_ptr<evbuffer, decltype(&evbuffer_free)> buffer(evbuffer_new(), evbuffer_free);
+			if(!buffer) {
+			
+				// Reply with internal server error response to request
+				evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+			}
+			
+			// Otherwise check if creating payment failed
+			else if(!paymentProofIndices[i]) {
+			
+				// Reply with internal server error response to request
+				evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+			}
+			
+			// Otherwise check if setting request's response's content type header failed
+			else if(evhttp_add_header(evhttp_request_get_output_headers(request), "Content-Type", "application/json; charset=utf-8")) {
+			
+				// Remove request's response's content type header
+				evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+				
+				// Reply with internal server error response to request
+				evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+			}
+			
+			// Otherwise
+			else {
+			
+				// Check if payment has a price
+				if(get<3>(batch.front()) != Payments::ANY_PRICE) {
+				
+					// Precompute payment's output in the background since its amount is known
+					outputPrecomputer.precomputeOutput(paymentProofIndices[i], get<3>(batch.front()), get<5>(batch.front()));
+				}
+				
+				// Get cached or wallet's Tor payment proof address at the payment proof index
+				const string paymentProofAddress = paymentProofAddressCache.getTorPaymentProofAddress(paymentProofIndices[i]);
+				
+				// Check if adding payment info to buffer failed
+				if(evbuffer_add_printf(buffer.get(), "{\"payment_id\":\"%" PRIu64 "\",\"url\":\"%s\",\"recipient_payment_proof_address\":\"%s\"}", id, url.c_str(), paymentProofAddress.c_str()) == -1) {
+				
+					// Remove request's response's content type header
+					evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+					
+					// Reply with internal server error response to request
+					evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+				}
+				
+				// Otherwise
+				else {
+				
+					// Display message
+					osyncstream(cout) << "Created payment " << id << endl;
+					
+					// Reply with ok response to request
+					evhttp_send_reply(request, HTTP_OK, nullptr, buffer.get());
+				}
+			}
+			
+			// Remove pending payment
+			batch.pop_front();
+		}
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Go through all remaining pending payments
+		for(const tuple<evhttp_request *, uint64_t, string, uint64_t, uint32_t, uint32_t, string, optional<string>, optional<string>, optional<string>, optional<string>> &pendingPayment : batch) {
+		
+			// Remove request's response's content type header
+			evhttp_remove_header(evhttp_request_get_output_headers(get<0>(pendingPayment)), "Content-Type");
+			
+			// Reply with internal server error response to request
+			evhttp_send_reply(get<0>(pendingPayment), HTTP_INTERNAL, nullptr, nullptr);
+		}
+	}
+}
+
+// Reply to payment watchers
+void PrivateServer::replyToPaymentWatchers() {
+
+	// Get current time
+	const chrono::time_point<chrono::steady_clock> currentTime = chrono::steady_clock::now();
+	
+	// Go through all payment watchers
+	for(list<tuple<evhttp_request *, uint64_t, chrono::time_point<chrono::steady_clock>>>::iterator i = paymentWatchers.begin(); i != paymentWatchers.end();) {
+	
+		// Get payment watcher's request
+		evhttp_request *request = get<0>(*i);
+		
+		// Try
+		try {
+		
+			// Check if sending payment changes replied to the payment watcher's request
+			if(sendPaymentChanges(request, get<1>(*i), get<2>(*i) <= currentTime)) {
+			
+				// Remove payment watcher
+				i = paymentWatchers.erase(i);
+				
+				// Continue
+				continue;
+			}
+		}
+		
+		// Catch errors
+		catch(...) {
+		
+			// Remove request's response's content type header
+			evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+			
+			// Reply with internal server error response to request
+			evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+			
+			// Remove payment watcher
+			i = paymentWatchers.erase(i);
+			
+			// Continue
+			continue;
+		}
+		
+		// Go to next payment watcher
+		++i;
+	}
+	
+	// Check if there's no payment watchers
+	if(paymentWatchers.empty()) {
+	
+		// Remove payment watchers timer
+		event_del(paymentWatchersTimer.get());
+	}
+}
+
+// Send payment changes
+bool PrivateServer::sendPaymentChanges(evhttp_request *request, const uint64_t cursor, const bool replyIfNoChanges) {
+
+	// Get payment changes after the cursor
+	list<tuple<uint64_t, uint64_t, string, uint64_t>> changes;
+	const bool cursorExpired = !payments.getPaymentChanges(changes, cursor, MAXIMUM_NUMBER_OF_WATCH_PAYMENTS_CHANGES);
+	
+	// Check if cursor isn't expired, no changes exist, and not replying if no changes exist
+	if(!cursorExpired && changes.empty() && !replyIfNoChanges) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if creating buffer failed
+	const unique_ptr<evbuffer, decltype(&evbuffer_free)> buffer(evbuffer_new(), evbuffer_free);
+	if(!buffer) {
+	
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		
+		// Return true
+		return true;
+	}
+	
+	// Check if adding start of changes to buffer failed
+	if(evbuffer_add_printf(buffer.get(), "{\"changes\":[") == -1) {
+	
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		
+		// Return true
+		return true;
+	}
+	
+	// Go through all changes
+	for(const tuple<uint64_t, uint64_t, string, uint64_t> &change : changes) {
+	
+		// Check if adding change to buffer failed
+		if(evbuffer_add_printf(buffer.get(), "%s{\"sequence\":\"%" PRIu64 "\",\"payment_id\":\"%" PRIu64 "\",\"status\":\"%s\",\"confirmations\":%" PRIu64 "}", (&change == &changes.front()) ? "" : ",", get<0>(change), get<1>(change), get<2>(change).c_str(), get<3>(change)) == -1) {
+		
+			// Reply with internal server error response to request
+			evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+			
+			// Return true
+			return true;
+		}
+	}
+	
+	// Get next cursor as the last payment change if the cursor is expired, the last change if changes exist, or the cursor otherwise
+	const uint64_t nextCursor = cursorExpired ? payments.getLastPaymentChangeSequence() : (changes.empty() ? cursor : get<0>(changes.back()));
+	
+	// Check if adding end of changes, next cursor, and if cursor is expired to buffer failed
+	if(evbuffer_add_printf(buffer.get(), "],\"next_cursor\":\"%" PRIu64 "\",\"cursor_expired\":%s}", nextCursor, cursorExpired ? "true" : "false") == -1) {
+	
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		
+		// Return true
+		return true;
+	}
+	
+	// Check if setting request's response's content type header failed
+	if(evhttp_add_header(evhttp_request_get_output_headers(request), "Content-Type", "application/json; charset=utf-8")) {
+	
+		// Remove request's response's content type header
+		evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+		
+		// Reply with internal server error response to request
+		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		
+		// Return true
+		return true;
+	}
+	
+	// Reply with ok response to request
+	evhttp_send_reply(request, HTTP_OK, nullptr, buffer.get());
+	
+	// Return true
+	return true;
+}
+
+// Add payment info to buffer
+bool PrivateServer::addPaymentInfoToBuffer(evbuffer *buffer, const uint64_t id, const tuple<uint64_t, string, optional<uint64_t>, uint64_t, bool, uint64_t, optional<uint64_t>, string> &paymentInfo, const bool firstPayment) {
+
+	// Get cached or wallet's Tor payment proof address at the payment proof index
+	const string paymentProofAddress = paymentProofAddressCache.getTorPaymentProofAddress(get<0>(paymentInfo));
+	
+	// Get payment's price as a string
+	const string priceString = get<2>(paymentInfo).has_value() ? '"' + Common::getNumberInNumberBase(get<2>(paymentInfo).value(), Consensus::NUMBER_BASE) + '"' : "null";
+	
+	// Get payment's time remaining as a string
+	const string timeRemainingString = get<6>(paymentInfo).has_value() ? to_string(get<6>(paymentInfo).value()) : "null";
+	
+	// Return if adding payment info to buffer was successful
+	return evbuffer_add_printf(buffer, "%s{\"payment_id\":\"%" PRIu64 "\",\"url\":\"%s\",\"price\":%s,\"required_confirmations\":%" PRIu64 ",\"received\":%s,\"confirmations\":%" PRIu64 ",\"time_remaining\":%s,\"status\":\"%s\",\"recipient_payment_proof_address\":\"%s\"}", firstPayment ? "" : ",", id, get<1>(paymentInfo).c_str(), priceString.c_str(), get<3>(paymentInfo), get<4>(paymentInfo) ? "true" : "false", get<5>(paymentInfo), timeRemainingString.c_str(), get<7>(paymentInfo).c_str(), paymentProofAddress.c_str()) != -1;
+}
+
+// Verify API key
+bool PrivateServer::verifyApiKey(const evkeyvalq &queryValues) const {
+
+	// Check if an API key is required
+	if(!apiKey.empty()) {
+	
+		// Check if request doesn't have an API key or its the wrong size
+		const char *requestApiKey = evhttp_find_header(&queryValues, "api_key");
+		if(!requestApiKey || strlen(requestApiKey) != apiKey.size()) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Return if request has the correct API key
+		return !CRYPTO_memcmp(apiKey.data(), requestApiKey, apiKey.size());
+	}
+	
+	// Return true
+	return true;
+}
+
+// Get create payment parameters
+bool getCreatePaymentParameters(uint64_t &price, uint32_t &requiredConfirmations, uint32_t &timeout, const char *&completedCallback, const char *&receivedCallback, const char *&confirmedCallback, const char *&expiredCallback, const char *&notes, const function<const char *(const char *)> &getParameter) {
+
+	// Check if price parameter is provided
+	const char *priceParameter = getParameter("price");
+	if(priceParameter) {
+	
+		// Check if price parameter before decimal is invalid
+		char *end;
+		errno = 0;
+		const unsigned long long priceNumber = strtoull(priceParameter, &end, Common::DECIMAL_NUMBER_BASE);
+		if(end == priceParameter || (*end && *end != '.') || !isdigit(priceParameter[0]) || (priceParameter[0] == '0' && isdigit(priceParameter[1])) || errno || priceNumber > numeric_limits<uint64_t>::max() / Consensus::NUMBER_BASE) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Set price to provided value in number base
+		price = priceNumber * Consensus::NUMBER_BASE;
+		
+		// Check if price parameter has a decimal
+		if(*end == '.') {
+		
+			// Check if price parameter after decimal is invalid
+			const char *priceDecimalParameter = &end[sizeof('.')];
+			errno = 0;
+			const unsigned long long priceDecimal = strtoull(priceDecimalParameter, &end, Common::DECIMAL_NUMBER_BASE);
+			
+			if(end == priceDecimalParameter || *end || !isdigit(priceDecimalParameter[0]) || errno || priceDecimal >= static_cast<unsigned long long>(Consensus::NUMBER_BASE) || price > numeric_limits<uint64_t>::max() - priceDecimal * static_cast<unsigned long long>(pow(10, ceil(log10(Consensus::NUMBER_BASE)) - (end - priceDecimalParameter)))) {
+			
+				// Return false
+				return false;
+			}
+			
+			// Update price to include decimal part
+			price += priceDecimal * static_cast<unsigned long long>(pow(10, ceil(log10(Consensus::NUMBER_BASE)) - (end - priceDecimalParameter)));
+		}
+		
+		// Check if price is zero
+		if(!price) {
+		
+			// Return false
+			return false;
+		}
+	}
+	
+	// Otherwise
+	else {
+	
+		// Set price to be any price
+		price = Payments::ANY_PRICE;
+	}
+	
+	// Check if required confirmations parameter is provided
+	const char *requiredConfirmationsParameter = getParameter("required_confirmations");
+	if(requiredConfirmationsParameter) {
+	
+		// Check if required confirmations parameter is invalid
+		char *end;
+		errno = 0;
+		const unsigned long requiredConfirmationsNumber = strtoul(requiredConfirmationsParameter, &end, Common::DECIMAL_NUMBER_BASE);
+		if(end == requiredConfirmationsParameter || *end || !isdigit(requiredConfirmationsParameter[0]) || (requiredConfirmationsParameter[0] == '0' && isdigit(requiredConfirmationsParameter[1])) || errno || !requiredConfirmationsNumber || requiredConfirmationsNumber > numeric_limits<uint32_t>::max()) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Set required confirmations to provided value
+		requiredConfirmations = requiredConfirmationsNumber;
+	}
+	
+	// Otherwise
+	else {
+	
+		// Set required confirmations to be confirmed when on-chain
+		requiredConfirmations = Payments::CONFIRMED_WHEN_ON_CHAIN;
+	}
+	
+	// Check if timeout parameter is provided
+	const char *timeoutParameter = getParameter("timeout");
+	if(timeoutParameter) {
+	
+		// Check if timeout parameter is invalid
+		char *end;
+		errno = 0;
+		const unsigned long timeoutNumber = strtoul(timeoutParameter, &end, Common::DECIMAL_NUMBER_BASE);
+		if(end == timeoutParameter || *end || !isdigit(timeoutParameter[0]) || (timeoutParameter[0] == '0' && isdigit(timeoutParameter[1])) || errno || !timeoutNumber || timeoutNumber > numeric_limits<uint32_t>::max()) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Set timeout to provided value
+		timeout = timeoutNumber;
+	}
+	
+	// Otherwise
+	else {
+	
+		// Set timeout to no timeout
+		timeout = Payments::NO_TIMEOUT;
+	}
+	
+	// Check if completed callback parameter is provided and it's not too long
+	completedCallback = getParameter("completed_callback");
+	if(completedCallback && strlen(completedCallback) <= Payments::MAXIMUM_COMPLETED_CALLBACK_SIZE) {
+	
+		// Check if completed callback is invalid
+		const unique_ptr<evhttp_uri, decltype(&evhttp_uri_free)> completedCallbackUri(evhttp_uri_parse(completedCallback), evhttp_uri_free);
+		if(!completedCallbackUri || (strncasecmp(completedCallback, "http://", sizeof("http://") - sizeof('\0')) && strncasecmp(completedCallback, "https://", sizeof("https://") - sizeof('\0'))) || !evhttp_uri_get_scheme(completedCallbackUri.get()) || !evhttp_uri_get_host(completedCallbackUri.get()) || evhttp_uri_get_unixsocket(completedCallbackUri.get()) || evhttp_uri_get_fragment(completedCallbackUri.get()) || (strcasecmp(evhttp_uri_get_scheme(completedCallbackUri.get()), "http") && strcasecmp(evhttp_uri_get_scheme(completedCallbackUri.get()), "https")) || !*evhttp_uri_get_host(completedCallbackUri.get()) || !evhttp_uri_get_port(completedCallbackUri.get())) {
+		
+			// Return false
+			return false;
+		}
+	}
+	
+	// Otherwise
+	else {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if received callback parameter is provided
+	receivedCallback = getParameter("received_callback");
+	if(receivedCallback) {
+	
+		// Check if received callback parameter isn't too long
+		if(strlen(receivedCallback) <= Payments::MAXIMUM_RECEIVED_CALLBACK_SIZE) {
+		
+			// Check if received callback is invalid
+			const unique_ptr<evhttp_uri, decltype(&evhttp_uri_free)> receivedCallbackUri(evhttp_uri_parse(receivedCallback), evhttp_uri_free);
+			if(!receivedCallbackUri || (strncasecmp(receivedCallback, "http://", sizeof("http://") - sizeof('\0')) && strncasecmp(receivedCallback, "https://", sizeof("https://") - sizeof('\0'))) || !evhttp_uri_get_scheme(receivedCallbackUri.get()) || !evhttp_uri_get_host(receivedCallbackUri.get()) || evhttp_uri_get_unixsocket(receivedCallbackUri.get()) || evhttp_uri_get_fragment(receivedCallbackUri.get()) || (strcasecmp(evhttp_uri_get_scheme(receivedCallbackUri.get()), "http") && strcasecmp(evhttp_uri_get_scheme(receivedCallbackUri.get()), "https")) || !*evhttp_uri_get_host(receivedCallbackUri.get()) || !evhttp_uri_get_port(receivedCallbackUri.get())) {
+			
+				// Return false
+				return false;
+			}
+		}
+		
+		// Otherwise
+		else {
+		
+			// Return false
+			return false;
+		}
+	}
+	
+	// Otherwise
+	else {
+	
+		// Set received callback to no received callback
+		receivedCallback = Payments::NO_RECEIVED_CALLBACK;
+	}
+	
+	// Check if confirmed callback parameter is provided
+	confirmedCallback = getParameter("confirmed_callback");
+	if(confirmedCallback) {
+	
+		// Check if confirmed callback parameter isn't too long
+		if(strlen(confirmedCallback) <= Payments::MAXIMUM_CONFIRMED_CALLBACK_SIZE) {
+		
+			// Check if confirmed callback is invalid
+			const unique_ptr<evhttp_uri, decltype(&evhttp_uri_free)> confirmedCallbackUri(evhttp_uri_parse(confirmedCallback), evhttp_uri_free);
+			if(!confirmedCallbackUri || (strncasecmp(confirmedCallback, "http://", sizeof("http://") - sizeof('\0')) && strncasecmp(confirmedCallback, "https://", sizeof("https://") - sizeof('\0'))) || !evhttp_uri_get_scheme(confirmedCallbackUri.get()) || !evhttp_uri_get_host(confirmedCallbackUri.get()) || evhttp_uri_get_unixsocket(confirmedCallbackUri.get()) || evhttp_uri_get_fragment(confirmedCallbackUri.get()) || (strcasecmp(evhttp_uri_get_scheme(confirmedCallbackUri.get()), "http") && strcasecmp(evhttp_uri_get_scheme(confirmedCallbackUri.get()), "https")) || !*evhttp_uri_get_host(confirmedCallbackUri.get()) || !evhttp_uri_get_port(confirmedCallbackUri.get())) {
+			
+				// Return false
+				return false;
+			}
+		}
+		
+		// Otherwise
+		else {
+		
+			// Return false
+			return false;
+		}
+	}
+	
+	// Otherwise
+	else {
+	
+		// Set confirmed callback to no confirmed callback
+		confirmedCallback = Payments::NO_CONFIRMED_CALLBACK;
+	}
+	
+	// Check if expired callback parameter is provided
+	expiredCallback = getParameter("expired_callback");
+	if(expiredCallback) {
+	
+		// Check if expired callback parameter isn't too long and a timeout parameter is provided
+		if(strlen(expiredCallback) <= Payments::MAXIMUM_EXPIRED_CALLBACK_SIZE && timeout != Payments::NO_TIMEOUT) {
+		
+			// Check if expired callback is invalid
+			const unique_ptr<evhttp_uri, decltype(&evhttp_uri_free)> expiredCallbackUri(evhttp_uri_parse(expiredCallback), evhttp_uri_free);
+			if(!expiredCallbackUri || (strncasecmp(expiredCallback, "http://", sizeof("http://") - sizeof('\0')) && strncasecmp(expiredCallback, "https://", sizeof("https://") - sizeof('\0'))) || !evhttp_uri_get_scheme(expiredCallbackUri.get()) || !evhttp_uri_get_host(expiredCallbackUri.get()) || evhttp_uri_get_unixsocket(expiredCallbackUri.get()) || evhttp_uri_get_fragment(expiredCallbackUri.get()) || (strcasecmp(evhttp_uri_get_scheme(expiredCallbackUri.get()), "http") && strcasecmp(evhttp_uri_get_scheme(expiredCallbackUri.get()), "https")) || !*evhttp_uri_get_host(expiredCallbackUri.get()) || !evhttp_uri_get_port(expiredCallbackUri.get())) {
+			
+				// Return false
+				return false;
+			}
+		}
+		
+		// Otherwise
+		else {
+		
+			// Return false
+			return false;
+		}
+	}
+	
+	// Otherwise
+	else {
+	
+		// Set expired callback to no expired callback
+		expiredCallback = Payments::NO_EXPIRED_CALLBACK;
+	}
+	
+	// Check if notes parameter is provided
+	notes = getParameter("notes");
+	if(notes) {
+	
+		// Check if notes parameter is invalid
+		if(!*notes || strlen(notes) > Payments::MAXIMUM_NOTES_SIZE || !Common::isValidUtf8String(reinterpret_cast<const uint8_t *>(notes), strlen(notes))) {
+		
+			// Return false
+			return false;
+		}
+	}
+	
+	// Otherwise
+	else {
+	
+		// Set notes to no notes
+		notes = Payments::NO_NOTES;
+	}
+	
+	// Return true
+	return true;
+}
+
+// Create random ID and URL
+bool createRandomIdAndUrl(uint64_t &id, char *url) {
+
+	// Check if creating random ID failed
+	if(RAND_bytes_ex(nullptr, reinterpret_cast<uint8_t *>(&id), sizeof(id), RAND_DRBG_STRENGTH) != 1) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if creating random URL failed
+	if(RAND_bytes_ex(nullptr, reinterpret_cast<unsigned char *>(url), Payments::URL_SIZE, RAND_DRBG_STRENGTH) != 1) {
+	
+		// Return false
+		return false;
+	}
+	
+	for(size_t i = 0; i < Payments::URL_SIZE; ++i) {
+	
+		url[i] = Payments::URL_CHARACTERS[url[i] % (sizeof(Payments::URL_CHARACTERS) - sizeof('\0'))];
+	}
+	
+	url[Payments::URL_SIZE] = '\0';
+	
+	// Return true
+	return true;
+}
+
+// Get number parameter
+bool getNumberParameter(uint64_t &number, const char *parameter) {
+
+	// Check if parameter is invalid
+	char *end;
+	errno = 0;
+	const unsigned long long parameterNumber = strtoull(parameter, &end, Common::DECIMAL_NUMBER_BASE);
+	if(end == parameter || *end || !isdigit(parameter[0]) || (parameter[0] == '0' && isdigit(parameter[1])) || errno || parameterNumber > numeric_limits<uint64_t>::max()) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Set number to the parameter's value
+	number = parameterNumber;
+	
 	// Return true
 	return true;
 }
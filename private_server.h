@@ -4,13 +4,20 @@
 
 
 // Header files
+#include <chrono>
 #include <filesystem>
 #include <getopt.h>
+#include <list>
+#include <optional>
+#include <string>
 #include <thread>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
 #include "event2/event.h"
 #include "event2/http.h"
+#include "./output_precomputer.h"
+#include "./payment_proof_address_cache.h"
 #include "./payments.h"
 #include "./price.h"
 #include "./wallet.h"
@@ -27,7 +34,7 @@ class PrivateServer final {
 	public:
 	
 		// Constructor
-		explicit PrivateServer(const unordered_map<char, const char *> &providedOptions, const filesystem::path &currentDirectory, const Wallet &wallet, Payments &payments, const Price &price);
+		explicit PrivateServer(const unordered_map<char, const char *> &providedOptions, const filesystem::path &currentDirectory, const Wallet &wallet, Payments &payments, const Price &price, OutputPrecomputer &outputPrecomputer, PaymentProofAddressCache &paymentProofAddressCache);
 		
 		// Destructor
 		~PrivateServer();
@@ -50,15 +57,39 @@ class PrivateServer final {
 		// Handle create payment request
 		void handleCreatePaymentRequest(evhttp_request *request);
 		
+		// Handle create payments request
+		void handleCreatePaymentsRequest(evhttp_request *request);
+		
 		// Handle get payment info request
 		void handleGetPaymentInfoRequest(evhttp_request *request);
 		
+		// Handle get payments info request
+		void handleGetPaymentsInfoRequest(evhttp_request *request);
+		
+		// Handle list payments request
+		void handleListPaymentsRequest(evhttp_request *request);
+		
+		// Handle watch payments request
+		void handleWatchPaymentsRequest(evhttp_request *request);
+		
 		// Handle get price request
 		void handleGetPriceRequest(evhttp_request *request);
 		
 		// Handle get public server info request
 		void handleGetPublicServerInfoRequest(evhttp_request *request);
 		
+		// Create pending payments
+		void createPendingPayments();
+		
+		// Reply to payment watchers
+		void replyToPaymentWatchers();
+		
+		// Send payment changes
+		bool sendPaymentChanges(evhttp_request *request, const uint64_t cursor, const bool replyIfNoChanges);
+		
+		// Add payment info to buffer
+		bool addPaymentInfoToBuffer(evbuffer *buffer, const uint64_t id, const tuple<uint64_t, string, optional<uint64_t>, uint64_t, bool, uint64_t, optional<uint64_t>, string> &paymentInfo, const bool firstPayment);
+		
 		// Verify API key
 		bool verifyApiKey(const evkeyvalq &queryValues) const;
 		
@@ -74,9 +105,36 @@ class PrivateServer final {
 		// Price
 		const Price &price;
 		
+		// Output precomputer
+		OutputPrecomputer &outputPrecomputer;
+		
+		// Payment proof address cache
+		PaymentProofAddressCache &paymentProofAddressCache;
+		
 		// Event base
 		unique_ptr<event_base, decltype(&event_base_free)> eventBase;
 		
+		// Batch timer
+		unique_ptr<event, decltype(&event_free)> batchTimer;
+		
+		// Batch window
+		timeval batchWindow;
+		
+		// Batch size
+		size_t batchSize;
+		
+		// Pending payments
+		list<tuple<evhttp_request *, uint64_t, string, uint64_t, uint32_t, uint32_t, string, optional<string>, optional<string>, optional<string>, optional<string>>> pendingPayments;
+		
+		// Payment changes event
+		unique_ptr<event, decltype(&event_free)> paymentChangesEvent;
+		
+		// Payment watchers timer
+		unique_ptr<event, decltype(&event_free)> paymentWatchersTimer;
+		
+		// Payment watchers
+		list<tuple<evhttp_request *, uint64_t, chrono::time_point<chrono::steady_clock>>> paymentWatchers;
+		
 		// Using Onion Service
 		const bool usingOnionService;
 		
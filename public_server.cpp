@@ -1,9 +1,12 @@
 // Header files
+#include <algorithm>
 #include <arpa/inet.h>
 #include <cinttypes>
 #include <filesystem>
 #include <iostream>
 #include <syncstream>
+#include <unordered_set>
+#include "./blake2.h"
 #include "./common.h"
 #include "./consensus.h"
 #include "event2/buffer.h"
@@ -13,14 +16,15 @@
 #include "./gzip.h"
 #include "./mqs.h"
 #include "openssl/ssl.h"
-#include "png.h"
 #include "./public_server.h"
+#include "./qr_code.h"
 #include "qrcodegen.h"
 #include "secp256k1_commitment.h"
 #include "simdjson.h"
 #include "./slate.h"
 #include "./slatepack.h"
 #include "./tor.h"
+#include "zlib.h"
 
 using namespace std;
 
@@ -55,11 +59,54 @@ static const size_t MAXIMUM_BODY_SIZE = 2 * Common::BYTES_IN_A_KILOBYTE;
 // Default QR code padding
 static const int DEFAULT_QR_CODE_PADDING = 4;
 
+// Default QR code compression level
+static const int DEFAULT_QR_CODE_COMPRESSION_LEVEL = 6;
+
+// Default QR code compression strategy
+static const char *DEFAULT_QR_CODE_COMPRESSION_STRATEGY = "default";
+
+// QR code compression strategies
+static const unordered_map<string, int> QR_CODE_COMPRESSION_STRATEGIES = {
+
+	// Default
+	{"default", Z_DEFAULT_STRATEGY},
+	
+	// Filtered
+	{"filtered", Z_FILTERED},
+	
+	// Huffman only
+	{"huffman_only", Z_HUFFMAN_ONLY},
+	
+	// RLE
+	{"rle", Z_RLE},
+	
+	// Fixed
+	{"fixed", Z_FIXED}
+};
+
+// Maximum number of cached QR codes
+static const size_t MAXIMUM_NUMBER_OF_CACHED_QR_CODES = 1024;
+
+// QR code entity tag hash size
+static const size_t QR_CODE_ENTITY_TAG_HASH_SIZE = 16;
+
+// Default number of worker threads
+static const unsigned long DEFAULT_NUMBER_OF_WORKER_THREADS = max(thread::hardware_concurrency(), 1U);
+
+// JSON parser
+static thread_local simdjson::dom::parser jsonParser;
+
+// Padded POST data
+static thread_local vector<uint8_t> paddedPostData(MAXIMUM_BODY_SIZE + simdjson::SIMDJSON_PADDING);
+
+// Slatepack payload
+static thread_local vector<uint8_t> slatepackPayload;
+
 
 // Supporting function implementation
 
 // Constructor
-PublicServer::PublicServer(const unordered_map<char, const char *> &providedOptions, const filesystem::path &currentDirectory, const Wallet &wallet, Payments &payments, const Price &price) :
+PublicServer::PublicServer(const unordered_map<char, const char *> &providedOptions, const filesystem::path &currentDirectory, const Wallet &wallet, Payments &payments, const Price &price, HttpClient &httpClient, OutputPrecomputer &outputPrecomputer, PaymentProofAddressCache &paymentProofAddressCache) :
 
 	// Set started
 	started(false),
@@ -73,11 +120,35 @@ PublicServer::PublicServer(const unordered_map<char, const char *> &providedOpti
 	// Set price
 	price(price),
 	
+	// Set HTTP client
+	httpClient(httpClient),
+	
+	// Set output precomputer
+	outputPrecomputer(outputPrecomputer),
+	
+	// Set payment proof address cache
+	paymentProofAddressCache(paymentProofAddressCache),
+	
 	// Set event base
 	eventBase(nullptr, event_base_free),
 	
 	// Set price disable
-	priceDisable(providedOptions.contains('q'))
+	priceDisable(providedOptions.contains('q')),
+	
+	// Set QR code compression level
+	qrCodeCompressionLevel(providedOptions.contains('L') ? strtol(providedOptions.at('L'), nullptr, Common::DECIMAL_NUMBER_BASE) : DEFAULT_QR_CODE_COMPRESSION_LEVEL),
+	
+	// Set QR code compression strategy
+	qrCodeCompressionStrategy(QR_CODE_COMPRESSION_STRATEGIES.at(providedOptions.contains('G') ? providedOptions.at('G') : DEFAULT_QR_CODE_COMPRESSION_STRATEGY)),
+	
+	// Set quit
+	quit(false),
+	
+	// Set event loop stopped
+	eventLoopStopped(false),
+	
+	// Set QR code cache payment changes cursor
+	qrCodeCachePaymentChangesCursor(payments.getLastPaymentChangeSequence())
 {
 
 	// Display message
@@ -98,6 +169,61 @@ PublicServer::PublicServer(const unordered_map<char, const char *> &providedOpti
 		throw runtime_error("Creating public server event base failed");
 	}
 	
+	// Check if a public server QR code compression level is provided
+	if(providedOptions.contains('L')) {
+	
+		// Display message
+		osyncstream(cout) << "Using provided public server QR code compression level: " << qrCodeCompressionLevel << endl;
+	}
+	
+	// Check if a public server QR code compression strategy is provided
+	if(providedOptions.contains('G')) {
+	
+		// Display message
+		osyncstream(cout) << "Using provided public server QR code compression strategy: " << providedOptions.at('G') << endl;
+	}
+	
+	// Get number of worker threads from provided options
+	const unsigned long numberOfWorkerThreads = providedOptions.contains('W') ? strtoul(providedOptions.at('W'), nullptr, Common::DECIMAL_NUMBER_BASE) : DEFAULT_NUMBER_OF_WORKER_THREADS;
+	
+	// Check if a public server number of worker threads is provided
+	if(providedOptions.contains('W')) {
+	
+		// Display message
+		osyncstream(cout) << "Using provided public server number of worker threads: " << numberOfWorkerThreads << endl;
+	}
+	
+	// Go through all worker threads
+	for(unsigned long i = 0; i < numberOfWorkerThreads; ++i) {
+	
+		// Try
+		try {
+		
+			// Create worker thread
+			workerThreads.emplace_back(&PublicServer::runWorker, this);
+		}
+		
+		// Catch errors
+		catch(...) {
+		
+			// Stop worker threads
+			stopWorkerThreads();
+		
+			// Throw exception
+			throw runtime_error("Creating public server worker thread failed");
+		}
+		
+		// Check if worker thread is invalid
+		if(!workerThreads.back().joinable()) {
+		
+			// Display message
+			osyncstream(cout) << "Public server worker thread is invalid" << endl;
+			
+			// Exit failure
+			exit(EXIT_FAILURE);
+		}
+	}
+	
 	// Try
 	try {
 	
@@ -108,6 +234,9 @@ PublicServer::PublicServer(const unordered_map<char, const char *> &providedOpti
 	// Catch errors
 	catch(...) {
 	
+		// Stop worker threads
+		stopWorkerThreads();
+		
 		// Throw exception
 		throw runtime_error("Creating public server main thread failed");
 	}
@@ -133,6 +262,9 @@ PublicServer::~PublicServer() {
 		osyncstream(cout) << "Closing public server" << endl;
 	}
 	
+	// Stop worker threads
+	stopWorkerThreads();
+	
 	// Check if exiting event loop failed
 	if(event_base_loopexit(eventBase.get(), nullptr)) {
 	
@@ -184,7 +316,16 @@ vector<option> PublicServer::getOptions() {
 		{"public_certificate", required_argument, nullptr, 't'},
 		
 		// Public key
-		{"public_key", required_argument, nullptr, 'y'}
+		{"public_key", required_argument, nullptr, 'y'},
+		
+		// Public worker threads
+		{"public_worker_threads", required_argument, nullptr, 'W'},
+		
+		// Public QR code compression level
+		{"public_qr_code_compression_level", required_argument, nullptr, 'L'},
+		
+		// Public QR code compression strategy
+		{"public_qr_code_compression_strategy", required_argument, nullptr, 'G'}
 	};
 }
 
@@ -196,6 +337,9 @@ void PublicServer::displayOptionsHelp() {
 	cout << "\t-o, --public_port\t\tSets the port for the public server to listen at (default: " << DEFAULT_PORT << ')' << endl;
 	cout << "\t-t, --public_certificate\tSets the TLS certificate file for the public server" << endl;
 	cout << "\t-y, --public_key\t\tSets the TLS private key file for the public server" << endl;
+	cout << "\t-W, --public_worker_threads\tSets the number of worker threads for the public server to process payments with (default: " << DEFAULT_NUMBER_OF_WORKER_THREADS << ')' << endl;
+	cout << "\t-L, --public_qr_code_compression_level\tSets the compression level from 0 (stored) to 9 for the public server's PNG QR codes (default: " << DEFAULT_QR_CODE_COMPRESSION_LEVEL << ')' << endl;
+	cout << "\t-G, --public_qr_code_compression_strategy\tSets the compression strategy for the public server's PNG QR codes to default, filtered, huffman_only, rle, or fixed (default: " << DEFAULT_QR_CODE_COMPRESSION_STRATEGY << ')' << endl;
 }
 
 // Validate option
@@ -269,6 +413,62 @@ bool PublicServer::validateOption(const char option, const char *value, char *ar
 				return false;
 			}
 			
+			// Break
+			break;
+		
+		// Public worker threads
+		case 'W': {
+		
+			// Check if public worker threads is invalid
+			char *end;
+			errno = 0;
+			const unsigned long numberOfWorkerThreads = value ? strtoul(value, &end, Common::DECIMAL_NUMBER_BASE) : 0;
+			if(!value || end == value || *end || !isdigit(value[0]) || (value[0] == '0' && isdigit(value[1])) || errno || !numberOfWorkerThreads || numberOfWorkerThreads > numeric_limits<uint16_t>::max()) {
+			
+				// Display message
+				cout << argv[0] << ": invalid public worker threads -- '" << (value ? value : "") << '\'' << endl;
+		
+				// Return false
+				return false;
+			}
+			
+			// Break
+			break;
+		}
+		
+		// Public QR code compression level
+		case 'L': {
+		
+			// Check if public QR code compression level is invalid
+			char *end;
+			errno = 0;
+			const long compressionLevel = value ? strtol(value, &end, Common::DECIMAL_NUMBER_BASE) : -1;
+			if(!value || end == value || *end || !isdigit(value[0]) || (value[0] == '0' && isdigit(value[1])) || errno || compressionLevel < Z_NO_COMPRESSION || compressionLevel > Z_BEST_COMPRESSION) {
+			
+				// Display message
+				cout << argv[0] << ": invalid public QR code compression level -- '" << (value ? value : "") << '\'' << endl;
+				
+				// Return false
+				return false;
+			}
+			
+			// Break
+			break;
+		}
+		
+		// Public QR code compression strategy
+		case 'G':
+		
+			// Check if public QR code compression strategy is invalid
+			if(!value || !QR_CODE_COMPRESSION_STRATEGIES.contains(value)) {
+			
+				// Display message
+				cout << argv[0] << ": invalid public QR code compression strategy -- '" << (value ? value : "") << '\'' << endl;
+				
+				// Return false
+				return false;
+			}
+			
 			// Break
 			break;
 	}
@@ -505,8 +705,27 @@ void PublicServer::run(const unordered_map<char, const char *> &providedOptions,
 		// Set started
 		started.store(true);
 		
+		// Run event loop
+		const int eventLoopResult = event_base_dispatch(eventBase.get());
+		
+		// Lock reply lock
+		unique_lock lockReply(replyLock);
+		
+		// Set event loop stopped
+		eventLoopStopped = true;
+		
+		// Unlock reply lock
+		lockReply.unlock();
+		
+		// Check if sending replies that were added to the event loop after it stopped failed
+		if(event_base_loop(eventBase.get(), EVLOOP_NONBLOCK) == -1) {
+		
+			// Throw exception
+			throw runtime_error("Sending public server replies failed");
+		}
+		
 		// Check if running event loop failed
-		if(event_base_dispatch(eventBase.get()) == -1) {
+		if(eventLoopResult == -1) {
 		
 			// Throw exception
 			throw runtime_error("Running public server event loop failed");
@@ -625,17 +844,6 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 		memcpy(paymentUrl, &path[sizeof('/')], Payments::URL_SIZE);
 		paymentUrl[Payments::URL_SIZE] = '\0';
 		
-		// Check if payment doesn't exist
-		const tuple paymentInfo = payments.getPaymentPrice(paymentUrl);
-		if(!get<0>(paymentInfo)) {
-		
-			// Reply with not found response to request
-			evhttp_send_reply(request, HTTP_NOTFOUND, nullptr, nullptr);
-			
-			// Return
-			return;
-		}
-		
 		// Check if parsing the URI's query string failed
 		evkeyvalq queryValues;
 		if(!evhttp_uri_get_query(uri) || evhttp_parse_query_str(evhttp_uri_get_query(uri), &queryValues)) {
@@ -735,53 +943,162 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 			invert = false;
 		}
 		
-		// Check if payment has a price
-		string data;
-		if(get<1>(paymentInfo).has_value()) {
+		// Check if format is provided
+		bool svg;
+		const char *formatParameter = evhttp_find_header(&queryValues, "format");
+		if(formatParameter) {
 		
-			// Set data
-			data = "{\"Recipient Address\":\"" + Common::jsonEscape(url) + "\",\"Amount\":\"" + Common::getNumberInNumberBase(get<1>(paymentInfo).value(), Consensus::NUMBER_BASE) + "\"}";
+			// Check if format parameter is SVG
+			if(!strcasecmp(formatParameter, "svg")) {
+			
+				// Set SVG to true
+				svg = true;
+			}
+			
+			// Otherwise check if format parameter is PNG
+			else if(!strcasecmp(formatParameter, "png")) {
+			
+				// Set SVG to false
+				svg = false;
+			}
+			
+			// Otherwise
+			else {
+			
+				// Reply with bad request response to request
+				evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+				
+				// Return
+				return;
+			}
 		}
 		
 		// Otherwise
 		else {
 		
-			// Set data
-			data = "{\"Recipient Address\":\"" + Common::jsonEscape(url) + "\"}";
+			// Set SVG to false
+			svg = false;
 		}
 		
-		// Check if data's capacity is too small
-		if(data.capacity() < qrcodegen_BUFFER_LEN_MAX) {
+		// Update QR code cache with payment changes
+		updateQrCodeCache();
 		
-			// Increase data's capacity
-			data.reserve(qrcodegen_BUFFER_LEN_MAX);
-		}
+		// Get QR code cache key from the payment URL, padding, invert, format, and URL
+		const string qrCodeCacheKey = string(paymentUrl) + (padding ? '1' : '0') + (invert ? '1' : '0') + (svg ? '1' : '0') + url;
 		
-		// Check if creating QR code failed
-		uint8_t qrCode[qrcodegen_BUFFER_LEN_MAX];
-		if(!qrcodegen_encodeBinary(reinterpret_cast<uint8_t *>(data.data()), data.size(), qrCode, qrcodegen_Ecc_LOW, qrcodegen_VERSION_MIN, qrcodegen_VERSION_MAX, qrcodegen_Mask_AUTO, false)) {
+		// Check if QR code isn't cached
+		unordered_map<string, tuple<uint64_t, string, string, list<string>::iterator>>::iterator cachedQrCode = qrCodeCache.find(qrCodeCacheKey);
+		if(cachedQrCode == qrCodeCache.end()) {
 		
-			// Reply with bad request response to request
-			evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+			// Check if payment doesn't exist
+			const tuple paymentInfo = payments.getPaymentPrice(paymentUrl);
+			if(!get<0>(paymentInfo)) {
 			
-			// Return
-			return;
-		}
+				// Reply with not found response to request
+				evhttp_send_reply(request, HTTP_NOTFOUND, nullptr, nullptr);
+				
+				// Return
+				return;
+			}
+		
+			// Check if payment has a price
+			string data;
+			if(get<1>(paymentInfo).has_value()) {
+		
+				// Set data
+				data = "{\"Recipient Address\":\"" + Common::jsonEscape(url) + "\",\"Amount\":\"" + Common::getNumberInNumberBase(get<1>(paymentInfo).value(), Consensus::NUMBER_BASE) + "\"}";
+			}
+		
+			// Otherwise
+			else {
+		
+				// Set data
+				data = "{\"Recipient Address\":\"" + Common::jsonEscape(url) + "\"}";
+			}
+		
+			// Check if data's capacity is too small
+			if(data.capacity() < qrcodegen_BUFFER_LEN_MAX) {
 		
-		// Get QR code size
-		const int size = qrcodegen_getSize(qrCode);
+				// Increase data's capacity
+				data.reserve(qrcodegen_BUFFER_LEN_MAX);
+			}
 		
-		// Check if creating PNG failed
-		png_infop info = nullptr;
-		const auto pngDestructor = [&info](png_structp png) {
+			// Check if creating QR code failed
+			uint8_t qrCode[qrcodegen_BUFFER_LEN_MAX];
+			if(!qrcodegen_encodeBinary(reinterpret_cast<uint8_t *>(data.data()), data.size(), qrCode, qrcodegen_Ecc_LOW, qrcodegen_VERSION_MIN, qrcodegen_VERSION_MAX, qrcodegen_Mask_AUTO, false)) {
 		
-			// Destroy png
-			png_destroy_write_struct(&png, &info);
-		};
+				// Reply with bad request response to request
+				evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+			
+				// Return
+				return;
+			}
 		
-		const unique_ptr<png_struct, decltype(pngDestructor)> png(png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr), pngDestructor);
-		if(!png) {
+			// Initialize image
+			string image;
+			
+			// Try
+			try {
+			
+				// Set image to the QR code rendered in the format
+				image = svg ? QrCode::getSvg(qrCode, padding, invert) : QrCode::getPng(qrCode, padding, invert, qrCodeCompressionLevel, qrCodeCompressionStrategy);
+			}
+			
+			// Catch errors
+			catch(...) {
 
+				// Reply with internal server error response to request
+				evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+			
+				// Return
+				return;
+			}
+		
+			// Check if getting image's hash failed
+			uint8_t imageHash[QR_CODE_ENTITY_TAG_HASH_SIZE];
+			if(blake2b(imageHash, sizeof(imageHash), reinterpret_cast<const uint8_t *>(image.data()), image.size(), nullptr, 0)) {
+			
+				// Reply with internal server error response to request
+				evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+				
+				// Return
+				return;
+			}
+			
+			// Check if QR code cache is full
+			if(qrCodeCache.size() >= MAXIMUM_NUMBER_OF_CACHED_QR_CODES) {
+			
+				// Remove least recently used QR code from QR code cache
+				qrCodeCache.erase(qrCodeCacheOrder.front());
+				qrCodeCacheOrder.pop_front();
+			}
+			
+			// Add QR code to QR code cache with its image's hash as its entity tag
+			qrCodeCacheOrder.push_back(qrCodeCacheKey);
+			cachedQrCode = qrCodeCache.emplace(qrCodeCacheKey, make_tuple(get<2>(paymentInfo), move(image), '"' + Common::toHexString(imageHash, sizeof(imageHash)) + '"', prev(qrCodeCacheOrder.end()))).first;
+		}
+		
+		// Otherwise
+		else {
+		
+			// Move QR code to the end of the QR code cache order
+			qrCodeCacheOrder.splice(qrCodeCacheOrder.end(), qrCodeCacheOrder, get<3>(cachedQrCode->second));
+		}
+		
+		// Get QR code's image and entity tag
+		const string &image = get<1>(cachedQrCode->second);
+		const string &entityTag = get<2>(cachedQrCode->second);
+		
+		// Remove request's response's cache control header
+		evhttp_remove_header(evhttp_request_get_output_headers(request), "Cache-Control");
+		
+		// Check if setting request's response's cache control header to allow the QR code to be revalidated and setting its entity tag header failed
+		if(evhttp_add_header(evhttp_request_get_output_headers(request), "Cache-Control", "no-cache, no-transform") || evhttp_add_header(evhttp_request_get_output_headers(request), "ETag", entityTag.c_str())) {
+		
+			// Remove request's response's cache control and entity tag headers
+			evhttp_remove_header(evhttp_request_get_output_headers(request), "Cache-Control");
+			evhttp_remove_header(evhttp_request_get_output_headers(request), "ETag");
+			
 			// Reply with internal server error response to request
 			evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
 			
@@ -789,12 +1106,12 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 			return;
 		}
 		
-		// Check if creating PNG's info failed
-		info = png_create_info_struct(png.get());
-		if(!info) {
-
-			// Reply with internal server error response to request
-			evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+		// Check if request's if none match header contains the QR code's entity tag
+		const char *ifNoneMatch = evhttp_request_get_input_headers(request) ? evhttp_find_header(evhttp_request_get_input_headers(request), "If-None-Match") : nullptr;
+		if(ifNoneMatch && (!strcmp(ifNoneMatch, "*") || strstr(ifNoneMatch, entityTag.c_str()))) {
+		
+			// Reply with not modified response to request
+			evhttp_send_reply(request, HTTP_NOTMODIFIED, nullptr, nullptr);
 			
 			// Return
 			return;
@@ -811,9 +1128,9 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 			return;
 		}
 		
-		// Set PNG error handler
-		if(setjmp(png_jmpbuf(png.get()))) {
-
+		// Check if adding image to buffer failed
+		if(evbuffer_add(buffer.get(), image.data(), image.size())) {
+		
 			// Reply with internal server error response to request
 			evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
 			
@@ -821,57 +1138,8 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 			return;
 		}
 		
-		// Set PNG write function
-		png_set_write_fn(png.get(), buffer.get(), [](const png_structp png, const png_bytep data, const png_size_t length) {
-		
-			// Get buffer
-			evbuffer *buffer = reinterpret_cast<evbuffer *>(png_get_io_ptr(png));
-			
-			// Check if adding data to buffer failed
-			if(evbuffer_add(buffer, data, length)) {
-			
-				// Trigger PNG error
-				png_error(png, nullptr);
-			}
-			
-		}, nullptr);
-		
-		// Set PNG image details
-		png_set_IHDR(png.get(), info, size + padding * 2, size + padding * 2, 1, PNG_COLOR_TYPE_GRAY, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
-		
-		// Write PNG info
-		png_write_info(png.get(), info);
-		
-		// Supply each PNG pixel as a byte
-		png_set_packing(png.get());
-		
-		// Check if not inverting
-		if(!invert) {
-		
-			// Invert PNG
-			png_set_invert_mono(png.get());
-		}
-		
-		// Go through all rows in the QR code
-		for(int y = -padding; y < size + padding; ++y) {
-		
-			// Go through all padding and modules in the row
-			png_byte pixels[size + padding * 2];
-			for(int x = -padding; x < size + padding; ++x) {
-			
-				// Set pixel to padding or module
-				pixels[x + padding] = (y < 0 || y >= size || x < 0 || x >= size) ? 0 : qrcodegen_getModule(qrCode, x, y);
-			}
-			
-			// Write pixels to png
-			png_write_row(png.get(), pixels);
-		}
-
-		// Write PNG end
-		png_write_end(png.get(), nullptr);
-		
 		// Check if setting request's response's content type header failed
-		if(evhttp_add_header(evhttp_request_get_output_headers(request), "Content-Type", "image/png")) {
+		if(evhttp_add_header(evhttp_request_get_output_headers(request), "Content-Type", svg ? "image/svg+xml" : "image/png")) {
 		
 			// Remove request's response's content type header
 			evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
@@ -917,400 +1185,601 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 		memcpy(paymentUrl, &path[sizeof('/')], Payments::URL_SIZE);
 		paymentUrl[Payments::URL_SIZE] = '\0';
 		
-		// Lock payments
-		unique_lock lockPayments(payments.getLock());
+		// Lock worker queue
+		unique_lock lockWorkerQueue(workerQueueLock);
 		
-		// Check if payment doesn't exist, it was already received, or it is expired
-		tuple paymentInfo = payments.getReceivingPaymentForUrl(paymentUrl);
-		if(!get<0>(paymentInfo)) {
+		// Check if quitting
+		if(quit.load()) {
 		
-			// Reply with not found response to request
-			evhttp_send_reply(request, HTTP_NOTFOUND, nullptr, nullptr);
+			// Unlock worker queue
+			lockWorkerQueue.unlock();
 			
-			// Return
-			return;
-		}
-		
-		// Check if request doesn't contain headers
-		const evkeyvalq *headers = evhttp_request_get_input_headers(request);
-		if(!headers) {
-		
-			// Reply with bad request response to request
-			evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+			// Reply with service unavailable response to request
+			evhttp_send_reply(request, HTTP_SERVUNAVAIL, nullptr, nullptr);
 			
 			// Return
 			return;
 		}
 		
-		// Check if request's content type is invalid
-		const char *contentType = evhttp_find_header(headers, "Content-Type");
-		if(!contentType || strncasecmp(contentType, "application/json", sizeof("application/json") - sizeof('\0')) || (contentType[sizeof("application/json") - sizeof('\0')] && contentType[sizeof("application/json") - sizeof('\0')] != ';')) {
+		// Add request to the worker queue
+		workerQueue.emplace_back(request, string(paymentUrl));
 		
-			// Reply with bad request response to request
-			evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
-			
-			// Return
-			return;
-		}
+		// Unlock worker queue
+		lockWorkerQueue.unlock();
 		
-		// Check if content type's character set is invalid
-		const char *characterSet = strcasestr(contentType, "charset=");
-		if(characterSet && ((*(characterSet - sizeof(';')) != ';' && *(characterSet - sizeof(' ')) != ' ') || strncasecmp(characterSet + sizeof("charset=") - sizeof('\0'), "utf8", sizeof("utf8") - sizeof('\0')) || (*(characterSet + sizeof("charset=utf8") - sizeof('\0')) && *(characterSet + sizeof("charset=utf8") - sizeof('\0')) != ';'))) {
+		// Notify a worker thread that the worker queue isn't empty
+		workerQueueConditionVariable.notify_one();
+	}
+}
+
+// Run worker
+void PublicServer::runWorker() {
+
+	// Try
+	try {
+	
+		// Loop forever
+		while(true) {
 		
-			// Reply with bad request response to request
-			evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+			// Lock worker queue
+			unique_lock lockWorkerQueue(workerQueueLock);
 			
-			// Return
-			return;
-		}
-		
-		// Initialize compress
-		bool compress = false;
-		
-		// Check if request contains an accept encoding
-		const char *acceptEncoding = evhttp_find_header(headers, "Accept-Encoding");
-		if(acceptEncoding) {
-		
-			// Check if gzip encoding is an accepted encoding
-			const char *gzipEncoding = strcasestr(acceptEncoding, "gzip");
-			if(gzipEncoding && (gzipEncoding == acceptEncoding || *(gzipEncoding - sizeof(',')) == ',' || *(gzipEncoding - sizeof(' ')) == ' ') && (!*(acceptEncoding + sizeof("gzip") - sizeof('\0')) || *(acceptEncoding + sizeof("gzip") - sizeof('\0')) == ',' || *(acceptEncoding + sizeof("gzip") - sizeof('\0')) == ';')) {
+			// Wait until quitting or the worker queue isn't empty
+			workerQueueConditionVariable.wait(lockWorkerQueue, [this]() -> bool {
 			
-				// Set compress to true
-				compress = true;
-			}
-		}
-		
-		// Check if request doesn't contain POST data
-		evbuffer *postDataBuffer = evhttp_request_get_input_buffer(request);
-		if(!postDataBuffer || !evbuffer_get_length(postDataBuffer)) {
-		
-			// Reply with bad request response to request
-			evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+				// Return if quitting or the worker queue isn't empty
+				return quit.load() || !workerQueue.empty();
+			});
 			
-			// Return
+			// Check if quitting
+			if(quit.load()) {
+			
+				// Get remaining requests from the worker queue
+				const list remainingJobs = move(workerQueue);
+				workerQueue.clear();
+				
+				// Unlock worker queue
+				lockWorkerQueue.unlock();
+				
+				// Go through all remaining requests
+				for(const pair<evhttp_request *, string> &remainingJob : remainingJobs) {
+				
+					// Reply with service unavailable response to request
+					sendReply(remainingJob.first, HTTP_SERVUNAVAIL, nullptr);
+				}
+			
+				// Break
+				break;
+			}
+			
+			// Get next request and payment URL from the worker queue
+			const pair job = move(workerQueue.front());
+			workerQueue.pop_front();
+			
+			// Unlock worker queue
+			lockWorkerQueue.unlock();
+			
+			// Get request from job
+			evhttp_request *request = job.first;
+			
+			// Try
+			try {
+			
+				// Handle foreign API request
+				handleForeignApiRequest(request, job.second.c_str());
+			}
+			
+			// Catch errors
+			catch(...) {
+			
+				// Remove request's response's content encoding, vary, and content type headers
+				if(evhttp_request_get_output_headers(request)) {
+				
+					evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Encoding");
+					evhttp_remove_header(evhttp_request_get_output_headers(request), "Vary");
+					evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+				}
+				
+				// Reply with internal server error response to request
+				sendReply(request, HTTP_INTERNAL, nullptr);
+			}
+		}
+	}
+	
+	// Catch runtime errors
+	catch(const runtime_error &error) {
+	
+		// Display message
+		osyncstream(cout) << error.what() << endl;
+		
+		// Set error occurred
+		Common::setErrorOccurred();
+		
+		// Raise interrupt signal
+		kill(getpid(), SIGINT);
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Display message
+		osyncstream(cout) << "Public server worker failed for unknown reason" << endl;
+		
+		// Set error occurred
+		Common::setErrorOccurred();
+		
+		// Raise interrupt signal
+		kill(getpid(), SIGINT);
+	}
+}
+
+// Handle foreign API request
+void PublicServer::handleForeignApiRequest(evhttp_request *request, const char *paymentUrl) {
+
+	// Check if payment doesn't exist, it was already received, or it is expired
+	tuple paymentInfo = payments.getReceivingPaymentForUrl(paymentUrl);
+	if(!get<0>(paymentInfo)) {
+	
+		// Reply with not found response to request
+		sendReply(request, HTTP_NOTFOUND, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if request doesn't contain headers
+	const evkeyvalq *headers = evhttp_request_get_input_headers(request);
+	if(!headers) {
+	
+		// Reply with bad request response to request
+		sendReply(request, HTTP_BADREQUEST, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if request's content type is invalid
+	const char *contentType = evhttp_find_header(headers, "Content-Type");
+	if(!contentType || strncasecmp(contentType, "application/json", sizeof("application/json") - sizeof('\0')) || (contentType[sizeof("application/json") - sizeof('\0')] && contentType[sizeof("application/json") - sizeof('\0')] != ';')) {
+	
+		// Reply with bad request response to request
+		sendReply(request, HTTP_BADREQUEST, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Check if content type's character set is invalid
+	const char *characterSet = strcasestr(contentType, "charset=");
+	if(characterSet && ((*(characterSet - sizeof(';')) != ';' && *(characterSet - sizeof(' ')) != ' ') || strncasecmp(characterSet + sizeof("charset=") - sizeof('\0'), "utf8", sizeof("utf8") - sizeof('\0')) || (*(characterSet + sizeof("charset=utf8") - sizeof('\0')) && *(characterSet + sizeof("charset=utf8") - sizeof('\0')) != ';'))) {
+	
+		// Reply with bad request response to request
+		sendReply(request, HTTP_BADREQUEST, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Initialize compress
+	bool compress = false;
+	
+	// Check if request contains an accept encoding
+	const char *acceptEncoding = evhttp_find_header(headers, "Accept-Encoding");
+	if(acceptEncoding) {
+	
+		// Check if gzip encoding is an accepted encoding
+		const char *gzipEncoding = strcasestr(acceptEncoding, "gzip");
+		if(gzipEncoding && (gzipEncoding == acceptEncoding || *(gzipEncoding - sizeof(',')) == ',' || *(gzipEncoding - sizeof(' ')) == ' ') && (!*(acceptEncoding + sizeof("gzip") - sizeof('\0')) || *(acceptEncoding + sizeof("gzip") - sizeof('\0')) == ',' || *(acceptEncoding + sizeof("gzip") - sizeof('\0')) == ';')) {
+		
+			// Set compress to true
+			compress = true;
+		}
+	}
+	
+	// Check if request doesn't contain POST data
+	evbuffer *postDataBuffer = evhttp_request_get_input_buffer(request);
+	if(!postDataBuffer || !evbuffer_get_length(postDataBuffer)) {
+	
+		// Reply with bad request response to request
+		sendReply(request, HTTP_BADREQUEST, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Get POST data's length
+	const size_t postDataLength = evbuffer_get_length(postDataBuffer);
+	
+	// Check if padded POST data is too small
+	if(paddedPostData.size() < postDataLength + simdjson::SIMDJSON_PADDING) {
+	
+		// Increase padded POST data's size
+		paddedPostData.resize(postDataLength + simdjson::SIMDJSON_PADDING);
+	}
+	
+	// Check if copying POST data to the padded POST data failed
+	if(evbuffer_copyout(postDataBuffer, paddedPostData.data(), postDataLength) != static_cast<ev_ssize_t>(postDataLength)) {
+	
+		// Reply with internal server error response to request
+		sendReply(request, HTTP_INTERNAL, nullptr);
+		
+		// Return
+		return;
+	}
+	
+	// Try
+	try {
+	
+		// Parse POST data as JSON
+		const simdjson::dom::element json = jsonParser.parse(paddedPostData.data(), postDataLength, false);
+		
+		// Check if JSON isn't a JSON-RPC request
+		if(!json.is_object() || strcmp(json["jsonrpc"].get_c_str(), "2.0") || !json["id"].is_uint64() || !json["method"].is_string() || json["params"].error() != simdjson::SUCCESS) {
+		
+			// Reply with bad request response to request
+			sendReply(request, HTTP_BADREQUEST, nullptr);
+			
+			// Return
 			return;
 		}
 		
-		// Check if getting POST data failed
-		const unsigned char *postData = evbuffer_pullup(postDataBuffer, evbuffer_get_length(postDataBuffer));
-		if(!postData) {
+		// Check if creating buffer failed
+		const unique_ptr<evbuffer, decltype(&evbuffer_free)> buffer(evbuffer_new(), evbuffer_free);
+		if(!buffer) {
 		
 			// Reply with internal server error response to request
-			evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+			sendReply(request, HTTP_INTERNAL, nullptr);
 			
 			// Return
 			return;
 		}
 		
-		// Try
-		try {
+		// Check if setting request's response's content type header failed
+		if(evhttp_add_header(evhttp_request_get_output_headers(request), "Content-Type", "application/json; charset=utf-8")) {
+		
+			// Remove request's response's content type header
+			evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 		
-			// Parse POST data as JSON
-			simdjson::dom::parser parser;
-			const simdjson::dom::element json = parser.parse(postData, evbuffer_get_length(postDataBuffer), true);
+			// Reply with internal server error response to request
+			sendReply(request, HTTP_INTERNAL, nullptr);
 			
-			// Check if JSON isn't a JSON-RPC request
-			if(!json.is_object() || strcmp(json["jsonrpc"].get_c_str(), "2.0") || !json["id"].is_uint64() || !json["method"].is_string() || json["params"].error() != simdjson::SUCCESS) {
+			// Return
+			return;
+		}
+		
+		// Check if request is to check version
+		if(!strcmp(json["method"].get_c_str(), "check_version")) {
+		
+			// Check if parameters aren't provided
+			if(!json["params"].is_array()) {
 			
-				// Reply with bad request response to request
-				evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+				// Check if adding invalid request JSON-RPC error to buffer failed
+				if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32600,\"message\":\"Invalid request\"}}", json["id"].get_uint64().value()) == -1) {
 				
-				// Return
-				return;
+					// Remove request's response's content type header
+					evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+					
+					// Reply with internal server error response to request
+					sendReply(request, HTTP_INTERNAL, nullptr);
+					
+					// Return
+					return;
+				}
 			}
 			
-			// Check if creating buffer failed
-			const unique_ptr<evbuffer, decltype(&evbuffer_free)> buffer(evbuffer_new(), evbuffer_free);
-			if(!buffer) {
+			// Otherwise check if parameters are invalid
+			else if(json["params"].get_array().size()) {
 			
-				// Reply with internal server error response to request
-				evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+				// Check if adding invalid parameters JSON-RPC error to buffer failed
+				if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32602,\"message\":\"Invalid parameters\"}}", json["id"].get_uint64().value()) == -1) {
 				
-				// Return
-				return;
+					// Remove request's response's content type header
+					evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+					
+					// Reply with internal server error response to request
+					sendReply(request, HTTP_INTERNAL, nullptr);
+					
+					// Return
+					return;
+				}
 			}
-			
-			// Check if setting request's response's content type header failed
-			if(evhttp_add_header(evhttp_request_get_output_headers(request), "Content-Type", "application/json; charset=utf-8")) {
+		
+			// Otherwise check if adding JSON-RPC result to buffer failed
+			else if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"result\":{\"Ok\":{\"foreign_api_version\":2,\"supported_slate_versions\":[\"SP\"]}}}", json["id"].get_uint64().value()) == -1) {
 			
 				// Remove request's response's content type header
 				evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-			
+				
 				// Reply with internal server error response to request
-				evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+				sendReply(request, HTTP_INTERNAL, nullptr);
 				
 				// Return
 				return;
 			}
+		}
+		
+		// Otherwise check if request is to get proof address
+		else if(!strcmp(json["method"].get_c_str(), "get_proof_address")) {
+		
+			// Check if parameters aren't provided
+			if(!json["params"].is_array()) {
 			
-			// Check if request is to check version
-			if(!strcmp(json["method"].get_c_str(), "check_version")) {
-			
-				// Unlock payments
-				lockPayments.unlock();
-			
-				// Check if parameters aren't provided
-				if(!json["params"].is_array()) {
+				// Check if adding invalid request JSON-RPC error to buffer failed
+				if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32600,\"message\":\"Invalid request\"}}", json["id"].get_uint64().value()) == -1) {
 				
-					// Check if adding invalid request JSON-RPC error to buffer failed
-					if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32600,\"message\":\"Invalid request\"}}", json["id"].get_uint64().value()) == -1) {
+					// Remove request's response's content type header
+					evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 					
-						// Remove request's response's content type header
-						evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-						
-						// Reply with internal server error response to request
-						evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
-						
-						// Return
-						return;
-					}
-				}
-				
-				// Otherwise check if parameters are invalid
-				else if(json["params"].get_array().size()) {
-				
-					// Check if adding invalid parameters JSON-RPC error to buffer failed
-					if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32602,\"message\":\"Invalid parameters\"}}", json["id"].get_uint64().value()) == -1) {
+					// Reply with internal server error response to request
+					sendReply(request, HTTP_INTERNAL, nullptr);
 					
-						// Remove request's response's content type header
-						evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-						
-						// Reply with internal server error response to request
-						evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
-						
-						// Return
-						return;
-					}
+					// Return
+					return;
 				}
+			}
+			
+			// Otherwise check if parameters are invalid
+			else if(json["params"].get_array().size()) {
 			
-				// Otherwise check if adding JSON-RPC result to buffer failed
-				else if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"result\":{\"Ok\":{\"foreign_api_version\":2,\"supported_slate_versions\":[\"SP\"]}}}", json["id"].get_uint64().value()) == -1) {
+				// Check if adding invalid parameters JSON-RPC error to buffer failed
+				if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32602,\"message\":\"Invalid parameters\"}}", json["id"].get_uint64().value()) == -1) {
 				
 					// Remove request's response's content type header
 					evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 					
 					// Reply with internal server error response to request
-					evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+					sendReply(request, HTTP_INTERNAL, nullptr);
 					
 					// Return
 					return;
 				}
 			}
 			
-			// Otherwise check if request is to get proof address
-			else if(!strcmp(json["method"].get_c_str(), "get_proof_address")) {
+			// Otherwise
+			else {
 			
-				// Unlock payments
-				lockPayments.unlock();
+				// Get payment proof index from payment's unique number
+				const uint64_t &paymentProofIndex = get<0>(paymentInfo);
+				
+				// Initialize error occurred
+				bool errorOccurred = false;
 			
-				// Check if parameters aren't provided
-				if(!json["params"].is_array()) {
+				// Try
+				string paymentProofAddress;
+				try {
+				
+					// Get cached or wallet's Tor payment proof address at the payment proof index
+					paymentProofAddress = paymentProofAddressCache.getTorPaymentProofAddress(paymentProofIndex);
+				}
+				
+				// Catch errors
+				catch(...) {
 				
-					// Check if adding invalid request JSON-RPC error to buffer failed
-					if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32600,\"message\":\"Invalid request\"}}", json["id"].get_uint64().value()) == -1) {
+					// Set error occurred
+					errorOccurred = true;
+				
+					// Check if adding internal error JSON-RPC error to buffer failed
+					if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32603,\"message\":\"Internal error\"}}", json["id"].get_uint64().value()) == -1) {
 					
 						// Remove request's response's content type header
 						evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 						
 						// Reply with internal server error response to request
-						evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+						sendReply(request, HTTP_INTERNAL, nullptr);
 						
 						// Return
 						return;
 					}
 				}
 				
-				// Otherwise check if parameters are invalid
-				else if(json["params"].get_array().size()) {
+				// Check if an error didn't occur
+				if(!errorOccurred) {
 				
-					// Check if adding invalid parameters JSON-RPC error to buffer failed
-					if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32602,\"message\":\"Invalid parameters\"}}", json["id"].get_uint64().value()) == -1) {
+					// Check if adding JSON-RPC result to buffer failed
+					if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"result\":{\"Ok\":\"%s\"}}", json["id"].get_uint64().value(), paymentProofAddress.c_str()) == -1) {
 					
 						// Remove request's response's content type header
 						evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 						
 						// Reply with internal server error response to request
-						evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+						sendReply(request, HTTP_INTERNAL, nullptr);
 						
 						// Return
 						return;
 					}
 				}
+			}
+		}
+		
+		// Otherwise check if request is to receive transaction
+		else if(!strcmp(json["method"].get_c_str(), "receive_tx")) {
+		
+			// Check if claiming payment failed since it's already being received, it was received, or it expired
+			if(!payments.claimPayment(get<1>(paymentInfo), paymentUrl)) {
+			
+				// Remove request's response's content type header
+				evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 				
-				// Otherwise
-				else {
+				// Reply with not found response to request
+				sendReply(request, HTTP_NOTFOUND, nullptr);
+				
+				// Return
+				return;
+			}
+			
+			// Automatically release payment's claim when done
+			const auto paymentClaimReleaser = [this](const uint64_t *paymentId) {
+			
+				// Release payment claim
+				payments.releasePaymentClaim(*paymentId);
+			};
+			const unique_ptr<const uint64_t, decltype(paymentClaimReleaser)> paymentClaim(&get<1>(paymentInfo), paymentClaimReleaser);
+			
+			// Check if parameters aren't provided
+			if(!json["params"].is_array()) {
+			
+				// Check if adding invalid request JSON-RPC error to buffer failed
+				if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32600,\"message\":\"Invalid request\"}}", json["id"].get_uint64().value()) == -1) {
+				
+					// Remove request's response's content type header
+					evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+					
+					// Reply with internal server error response to request
+					sendReply(request, HTTP_INTERNAL, nullptr);
+					
+					// Return
+					return;
+				}
+			}
+			
+			// Otherwise check if parameters are invalid
+			else if(json["params"].get_array().size() != 3 || !json["params"].at(0).is_string() || (!json["params"].at(1).is_null() && !json["params"].at(1).is_string()) || (!json["params"].at(2).is_null() && !json["params"].at(2).is_string())) {
+			
+				// Check if adding invalid parameters JSON-RPC error to buffer failed
+				if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32602,\"message\":\"Invalid parameters\"}}", json["id"].get_uint64().value()) == -1) {
 				
+					// Remove request's response's content type header
+					evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+					
+					// Reply with internal server error response to request
+					sendReply(request, HTTP_INTERNAL, nullptr);
+					
+					// Return
+					return;
+				}
+			}
+			
+			// Otherwise
+			else {
+			
+				// Try
+				try {
+			
 					// Get payment proof index from payment's unique number
 					const uint64_t &paymentProofIndex = get<0>(paymentInfo);
 					
-					// Initialize error occurred
-					bool errorOccurred = false;
-				
-					// Try
-					string paymentProofAddress;
-					try {
+					// Decode parameter as a Slatepack into the Slatepack payload
+					const tuple slateData = Slatepack::decode(slatepackPayload, json["params"].at(0).get_c_str(), wallet, paymentProofIndex);
 					
-						// Get wallet's Tor payment proof address at the payment proof index
-						paymentProofAddress = wallet.getTorPaymentProofAddress(paymentProofIndex);
-					}
+					// Parse slate data
+					Slate slate(get<0>(slateData), get<1>(slateData));
 					
-					// Catch errors
-					catch(...) {
+					// Get price from payment's price
+					const uint64_t price = get<2>(paymentInfo).has_value() ? get<2>(paymentInfo).value() : 0;
 					
-						// Set error occurred
-						errorOccurred = true;
+					// Check if price exists and slate's amount doesn't match the price
+					if(price && slate.getAmount() != price) {
 					
-						// Check if adding internal error JSON-RPC error to buffer failed
-						if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32603,\"message\":\"Internal error\"}}", json["id"].get_uint64().value()) == -1) {
+						// Check if adding invalid parameters JSON-RPC error to buffer failed
+						if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32602,\"message\":\"The amount must be exactly %s\"}}", json["id"].get_uint64().value(), Common::getNumberInNumberBase(price, Consensus::NUMBER_BASE).c_str()) == -1) {
 						
 							// Remove request's response's content type header
 							evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 							
 							// Reply with internal server error response to request
-							evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+							sendReply(request, HTTP_INTERNAL, nullptr);
 							
 							// Return
 							return;
 						}
 					}
 					
-					// Check if an error didn't occur
-					if(!errorOccurred) {
+					// Otherwise check if slate doesn't have a payment proof
+					else if(slate.getSenderPaymentProofAddressPublicKey().empty()) {
 					
-						// Check if adding JSON-RPC result to buffer failed
-						if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"result\":{\"Ok\":\"%s\"}}", json["id"].get_uint64().value(), paymentProofAddress.c_str()) == -1) {
+						// Check if adding invalid parameters JSON-RPC error to buffer failed
+						if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32602,\"message\":\"A payment proof is required\"}}", json["id"].get_uint64().value()) == -1) {
 						
 							// Remove request's response's content type header
 							evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 							
 							// Reply with internal server error response to request
-							evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+							sendReply(request, HTTP_INTERNAL, nullptr);
 							
 							// Return
 							return;
 						}
 					}
-				}
-			}
-			
-			// Otherwise check if request is to receive transaction
-			else if(!strcmp(json["method"].get_c_str(), "receive_tx")) {
-			
-				// Check if parameters aren't provided
-				if(!json["params"].is_array()) {
-				
-					// Check if adding invalid request JSON-RPC error to buffer failed
-					if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32600,\"message\":\"Invalid request\"}}", json["id"].get_uint64().value()) == -1) {
 					
-						// Remove request's response's content type header
-						evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-						
-						// Reply with internal server error response to request
-						evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
-						
-						// Return
-						return;
-					}
-				}
-				
-				// Otherwise check if parameters are invalid
-				else if(json["params"].get_array().size() != 3 || !json["params"].at(0).is_string() || (!json["params"].at(1).is_null() && !json["params"].at(1).is_string()) || (!json["params"].at(2).is_null() && !json["params"].at(2).is_string())) {
-				
-					// Check if adding invalid parameters JSON-RPC error to buffer failed
-					if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32602,\"message\":\"Invalid parameters\"}}", json["id"].get_uint64().value()) == -1) {
+					// Otherwise check if slate's kernel features isn't plain
+					else if(slate.getKernelFeatures() != Slate::KernelFeatures::PLAIN) {
 					
-						// Remove request's response's content type header
-						evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-						
-						// Reply with internal server error response to request
-						evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+						// Check if adding invalid parameters JSON-RPC error to buffer failed
+						if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32602,\"message\":\"Invalid parameters\"}}", json["id"].get_uint64().value()) == -1) {
 						
-						// Return
-						return;
+							// Remove request's response's content type header
+							evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+							
+							// Reply with internal server error response to request
+							sendReply(request, HTTP_INTERNAL, nullptr);
+							
+							// Return
+							return;
+						}
 					}
-				}
-				
-				// Otherwise
-				else {
-				
-					// Try
-					try {
-				
-						// Get payment proof index from payment's unique number
-						const uint64_t &paymentProofIndex = get<0>(paymentInfo);
-						
-						// Decode parameter as a Slatepack
-						const pair slateData = Slatepack::decode(json["params"].at(0).get_c_str(), wallet, paymentProofIndex);
-						
-						// Parse slate data
-						Slate slate(slateData.first.data(), slateData.first.size());
-						
-						// Get price from payment's price
-						const uint64_t price = get<2>(paymentInfo).has_value() ? get<2>(paymentInfo).value() : 0;
-						
-						// Check if price exists and slate's amount doesn't match the price
-						if(price && slate.getAmount() != price) {
+					
+					// Otherwise
+					else {
+					
+						// Try
+						try {
 						
-							// Check if adding invalid parameters JSON-RPC error to buffer failed
-							if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32602,\"message\":\"The amount must be exactly %s\"}}", json["id"].get_uint64().value(), Common::getNumberInNumberBase(price, Consensus::NUMBER_BASE).c_str()) == -1) {
+							// Get current price if needed
+							const string currentPrice = (get<4>(paymentInfo).has_value() || priceDisable) ? "" : this->price.getCurrentPrice();
+					
+							// Check if getting precomputed or wallet's Tor payment proof address public key at the payment proof index failed
+							uint8_t paymentProofAddressPublicKey[Crypto::ED25519_PUBLIC_KEY_SIZE];
+							if(!outputPrecomputer.getTorPaymentProofAddressPublicKey(paymentProofAddressPublicKey, paymentProofIndex)) {
 							
-								// Remove request's response's content type header
-								evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-								
-								// Reply with internal server error response to request
-								evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+								// Check if adding internal error JSON-RPC error to buffer failed
+								if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32603,\"message\":\"Internal error\"}}", json["id"].get_uint64().value()) == -1) {
 								
-								// Return
-								return;
+									// Remove request's response's content type header
+									evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+									
+									// Reply with internal server error response to request
+									sendReply(request, HTTP_INTERNAL, nullptr);
+									
+									// Return
+									return;
+								}
 							}
-						}
-						
-						// Otherwise check if slate doesn't have a payment proof
-						else if(slate.getSenderPaymentProofAddressPublicKey().empty()) {
-						
-							// Check if adding invalid parameters JSON-RPC error to buffer failed
-							if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32602,\"message\":\"A payment proof is required\"}}", json["id"].get_uint64().value()) == -1) {
 							
-								// Remove request's response's content type header
-								evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+							// Otherwise
+							else {
+							
+								// Check if slate's sender and recipient payment proof address public keys are the same
+								if(slate.getSenderPaymentProofAddressPublicKey() == slate.getRecipientPaymentProofAddressPublicKey()) {
 								
-								// Reply with internal server error response to request
-								evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+									// Set slate's recipient payment proof address public key to the wallet's payment proof address public key
+									slate.setRecipientPaymentProofAddressPublicKey(paymentProofAddressPublicKey, sizeof(paymentProofAddressPublicKey));
+								}
 								
-								// Return
-								return;
-							}
-						}
-						
-						// Otherwise check if slate's kernel features isn't plain
-						else if(slate.getKernelFeatures() != Slate::KernelFeatures::PLAIN) {
-						
-							// Check if adding invalid parameters JSON-RPC error to buffer failed
-							if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32602,\"message\":\"Invalid parameters\"}}", json["id"].get_uint64().value()) == -1) {
-							
-								// Remove request's response's content type header
-								evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+								// Check if slate's recipient payment proof address public key isn't correct
+								if(slate.getRecipientPaymentProofAddressPublicKey().size() != sizeof(paymentProofAddressPublicKey) || memcmp(slate.getRecipientPaymentProofAddressPublicKey().data(), paymentProofAddressPublicKey, sizeof(paymentProofAddressPublicKey))) {
 								
-								// Reply with internal server error response to request
-								evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+									// Check if adding invalid parameters JSON-RPC error to buffer failed
+									if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32602,\"message\":\"Invalid parameters\"}}", json["id"].get_uint64().value()) == -1) {
+									
+										// Remove request's response's content type header
+										evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+										
+										// Reply with internal server error response to request
+										sendReply(request, HTTP_INTERNAL, nullptr);
+										
+										// Return
+										return;
+									}
+								}
 								
-								// Return
-								return;
-							}
-						}
-						
-						// Otherwise
-						else {
-						
-							// Try
-							try {
-							
-								// Get current price if needed
-								const string currentPrice = (get<4>(paymentInfo).has_value() || priceDisable) ? "" : this->price.getCurrentPrice();
-						
-								// Check if getting wallet's Tor payment proof address public key at the payment proof index failed
-								uint8_t paymentProofAddressPublicKey[Crypto::ED25519_PUBLIC_KEY_SIZE];
-								if(!wallet.getTorPaymentProofAddressPublicKey(paymentProofAddressPublicKey, paymentProofIndex)) {
+								// Get identifer path from payment's unique number
+								const uint64_t &identifierPath = get<0>(paymentInfo);
+								
+								// Check if getting precomputed or wallet's blinding factor, commitment, and proof at the identifier path for the slate's amount failed
+								uint8_t blindingFactor[Crypto::BLINDING_FACTOR_SIZE];
+								uint8_t commitment[Crypto::COMMITMENT_SIZE];
+								uint8_t proof[Crypto::BULLETPROOF_SIZE];
+								if(!outputPrecomputer.getOutput(blindingFactor, commitment, proof, identifierPath, slate.getAmount())) {
 								
 									// Check if adding internal error JSON-RPC error to buffer failed
 									if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32603,\"message\":\"Internal error\"}}", json["id"].get_uint64().value()) == -1) {
@@ -1319,7 +1788,7 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 										evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 										
 										// Reply with internal server error response to request
-										evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+										sendReply(request, HTTP_INTERNAL, nullptr);
 										
 										// Return
 										return;
@@ -1329,38 +1798,15 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 								// Otherwise
 								else {
 								
-									// Check if slate's sender and recipient payment proof address public keys are the same
-									if(slate.getSenderPaymentProofAddressPublicKey() == slate.getRecipientPaymentProofAddressPublicKey()) {
-									
-										// Set slate's recipient payment proof address public key to the wallet's payment proof address public key
-										slate.setRecipientPaymentProofAddressPublicKey(paymentProofAddressPublicKey, sizeof(paymentProofAddressPublicKey));
-									}
+									// Set slate's output
+									slate.setOutput(SlateOutput(commitment, proof));
 									
-									// Check if slate's recipient payment proof address public key isn't correct
-									if(slate.getRecipientPaymentProofAddressPublicKey().size() != sizeof(paymentProofAddressPublicKey) || memcmp(slate.getRecipientPaymentProofAddressPublicKey().data(), paymentProofAddressPublicKey, sizeof(paymentProofAddressPublicKey))) {
+									// Check if creating random slate offset failed
+									if(!slate.createRandomOffset(blindingFactor)) {
 									
-										// Check if adding invalid parameters JSON-RPC error to buffer failed
-										if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32602,\"message\":\"Invalid parameters\"}}", json["id"].get_uint64().value()) == -1) {
+										// Securely clear blinding factor
+										explicit_bzero(blindingFactor, sizeof(blindingFactor));
 										
-											// Remove request's response's content type header
-											evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-											
-											// Reply with internal server error response to request
-											evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
-											
-											// Return
-											return;
-										}
-									}
-									
-									// Get identifer path from payment's unique number
-									const uint64_t &identifierPath = get<0>(paymentInfo);
-									
-									// Check if getting wallet's commitment and proof at the identifier path for the slate's amount failed
-									uint8_t commitment[Crypto::COMMITMENT_SIZE];
-									uint8_t proof[Crypto::BULLETPROOF_SIZE];
-									if(!wallet.getCommitment(commitment, identifierPath, slate.getAmount()) || !wallet.getBulletproof(proof, identifierPath, slate.getAmount())) {
-									
 										// Check if adding internal error JSON-RPC error to buffer failed
 										if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32603,\"message\":\"Internal error\"}}", json["id"].get_uint64().value()) == -1) {
 										
@@ -1368,7 +1814,7 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 											evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 											
 											// Reply with internal server error response to request
-											evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+											sendReply(request, HTTP_INTERNAL, nullptr);
 											
 											// Return
 											return;
@@ -1378,64 +1824,44 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 									// Otherwise
 									else {
 									
-										// Set slate's output
-										slate.setOutput(SlateOutput(commitment, proof));
+										// Try
+										try {
 										
-										// Check if getting wallet's blinding factor at the identifier path for the slate's amount failed
-										uint8_t blindingFactor[Crypto::BLINDING_FACTOR_SIZE];
-										if(!wallet.getBlindingFactor(blindingFactor, identifierPath, slate.getAmount())) {
-										
-											// Check if adding internal error JSON-RPC error to buffer failed
-											if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32603,\"message\":\"Internal error\"}}", json["id"].get_uint64().value()) == -1) {
+											// Check if applying slate's offset to the blinding factor failed
+											const uint8_t *blinds[] = {
 											
-												// Remove request's response's content type header
-												evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-												
-												// Reply with internal server error response to request
-												evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+												// Blinding factor
+												blindingFactor,
 												
-												// Return
-												return;
-											}
-										}
-										
-										// Otherwise check if creating random slate offset failed
-										else if(!slate.createRandomOffset(blindingFactor)) {
-										
-											// Securely clear blinding factor
-											explicit_bzero(blindingFactor, sizeof(blindingFactor));
+												// Slate's offset
+												slate.getOffset()
+											};
 											
-											// Check if adding internal error JSON-RPC error to buffer failed
-											if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32603,\"message\":\"Internal error\"}}", json["id"].get_uint64().value()) == -1) {
+											if(!secp256k1_pedersen_blind_sum(secp256k1_context_no_precomp, blindingFactor, blinds, sizeof(blinds) / sizeof(blinds[0]), 1) || !Crypto::isValidSecp256k1PrivateKey(blindingFactor, sizeof(blindingFactor))) {
 											
-												// Remove request's response's content type header
-												evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+												// Securely clear blinding factor
+												explicit_bzero(blindingFactor, sizeof(blindingFactor));
 												
-												// Reply with internal server error response to request
-												evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+												// Check if adding internal error JSON-RPC error to buffer failed
+												if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32603,\"message\":\"Internal error\"}}", json["id"].get_uint64().value()) == -1) {
 												
-												// Return
-												return;
+													// Remove request's response's content type header
+													evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+													
+													// Reply with internal server error response to request
+													sendReply(request, HTTP_INTERNAL, nullptr);
+													
+													// Return
+													return;
+												}
 											}
-										}
-										
-										// Otherwise
-										else {
-										
-											// Try
-											try {
 											
-												// Check if applying slate's offset to the blinding factor failed
-												const uint8_t *blinds[] = {
-												
-													// Blinding factor
-													blindingFactor,
-													
-													// Slate's offset
-													slate.getOffset()
-												};
-												
-												if(!secp256k1_pedersen_blind_sum(secp256k1_context_no_precomp, blindingFactor, blinds, sizeof(blinds) / sizeof(blinds[0]), 1) || !Crypto::isValidSecp256k1PrivateKey(blindingFactor, sizeof(blindingFactor))) {
+											// Otherwise
+											else {
+											
+												// Check if creating private nonce failed
+												uint8_t privateNonce[Crypto::SCALAR_SIZE];
+												if(!Crypto::createPrivateNonce(privateNonce)) {
 												
 													// Securely clear blinding factor
 													explicit_bzero(blindingFactor, sizeof(blindingFactor));
@@ -1447,7 +1873,7 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 														evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 														
 														// Reply with internal server error response to request
-														evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+														sendReply(request, HTTP_INTERNAL, nullptr);
 														
 														// Return
 														return;
@@ -1457,37 +1883,44 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 												// Otherwise
 												else {
 												
-													// Check if creating private nonce failed
-													uint8_t privateNonce[Crypto::SCALAR_SIZE];
-													if(!Crypto::createPrivateNonce(privateNonce)) {
+													// Try
+													try {
 													
-														// Securely clear blinding factor
-														explicit_bzero(blindingFactor, sizeof(blindingFactor));
+														// Check if getting public blind excess from the blinding factor or public nonce from the private nonce failed
+														uint8_t publicBlindExcess[Crypto::SECP256K1_PUBLIC_KEY_SIZE];
+														uint8_t publicNonce[Crypto::SECP256K1_PUBLIC_KEY_SIZE];
+														if(!Crypto::getSecp256k1PublicKey(publicBlindExcess, blindingFactor) || !Crypto::getSecp256k1PublicKey(publicNonce, privateNonce)) {
 														
-														// Check if adding internal error JSON-RPC error to buffer failed
-														if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32603,\"message\":\"Internal error\"}}", json["id"].get_uint64().value()) == -1) {
-														
-															// Remove request's response's content type header
-															evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+															// Securely clear private nonce
+															explicit_bzero(privateNonce, sizeof(privateNonce));
+															
+															// Securely clear blinding factor
+															explicit_bzero(blindingFactor, sizeof(blindingFactor));
 															
-															// Reply with internal server error response to request
-															evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+															// Check if adding internal error JSON-RPC error to buffer failed
+															if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32603,\"message\":\"Internal error\"}}", json["id"].get_uint64().value()) == -1) {
 															
-															// Return
-															return;
+																// Remove request's response's content type header
+																evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+																
+																// Reply with internal server error response to request
+																sendReply(request, HTTP_INTERNAL, nullptr);
+																
+																// Return
+																return;
+															}
 														}
-													}
-													
-													// Otherwise
-													else {
-													
-														// Try
-														try {
 														
-															// Check if getting public blind excess from the blinding factor or public nonce from the private nonce failed
-															uint8_t publicBlindExcess[Crypto::SECP256K1_PUBLIC_KEY_SIZE];
-															uint8_t publicNonce[Crypto::SECP256K1_PUBLIC_KEY_SIZE];
-															if(!Crypto::getSecp256k1PublicKey(publicBlindExcess, blindingFactor) || !Crypto::getSecp256k1PublicKey(publicNonce, privateNonce)) {
+														// Otherwise
+														else {
+														
+															// Add participant to the slate
+															slate.addParticipant(SlateParticipant(publicBlindExcess, publicNonce));
+															
+															// Check if getting slate's public blind excess sum or public nonce sum failed
+															uint8_t publicBlindExcessSum[Crypto::SECP256K1_PUBLIC_KEY_SIZE];
+															uint8_t publicNonceSum[Crypto::SECP256K1_PUBLIC_KEY_SIZE];
+															if(!slate.getPublicBlindExcessSum(publicBlindExcessSum) || !slate.getPublicNonceSum(publicNonceSum)) {
 															
 																// Securely clear private nonce
 																explicit_bzero(privateNonce, sizeof(privateNonce));
@@ -1502,7 +1935,7 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 																	evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 																	
 																	// Reply with internal server error response to request
-																	evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+																	sendReply(request, HTTP_INTERNAL, nullptr);
 																	
 																	// Return
 																	return;
@@ -1512,13 +1945,10 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 															// Otherwise
 															else {
 															
-																// Add participant to the slate
-																slate.addParticipant(SlateParticipant(publicBlindExcess, publicNonce));
-																
-																// Check if getting slate's public blind excess sum or public nonce sum failed
-																uint8_t publicBlindExcessSum[Crypto::SECP256K1_PUBLIC_KEY_SIZE];
-																uint8_t publicNonceSum[Crypto::SECP256K1_PUBLIC_KEY_SIZE];
-																if(!slate.getPublicBlindExcessSum(publicBlindExcessSum) || !slate.getPublicNonceSum(publicNonceSum)) {
+																// Check if creating partial signature failed
+																uint8_t partialSignature[Crypto::SECP256K1_SINGLE_SIGNER_SIGNATURE_SIZE];
+																const vector kernelData = slate.getKernelData();
+																if(!Crypto::getSecp256k1PartialSingleSignerSignature(partialSignature, blindingFactor, kernelData.data(), kernelData.size(), privateNonce, publicBlindExcessSum, publicNonceSum)) {
 																
 																	// Securely clear private nonce
 																	explicit_bzero(privateNonce, sizeof(privateNonce));
@@ -1533,7 +1963,7 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 																		evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 																		
 																		// Reply with internal server error response to request
-																		evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+																		sendReply(request, HTTP_INTERNAL, nullptr);
 																		
 																		// Return
 																		return;
@@ -1543,17 +1973,34 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 																// Otherwise
 																else {
 																
-																	// Check if creating partial signature failed
-																	uint8_t partialSignature[Crypto::SECP256K1_SINGLE_SIGNER_SIGNATURE_SIZE];
-																	const vector kernelData = slate.getKernelData();
-																	if(!Crypto::getSecp256k1PartialSingleSignerSignature(partialSignature, blindingFactor, kernelData.data(), kernelData.size(), privateNonce, publicBlindExcessSum, publicNonceSum)) {
+																	// Securely clear private nonce
+																	explicit_bzero(privateNonce, sizeof(privateNonce));
+																	
+																	// Securely clear blinding factor
+																	explicit_bzero(blindingFactor, sizeof(blindingFactor));
+																	
+																	// Set slate participant's partial signature
+																	slate.setParticipantsPartialSignature(partialSignature);
+																	
+																	// Check if slate's sender payment proof address public key is a secp256k1 public key
+																	string senderPaymentProofAddress;
+																	if(slate.getSenderPaymentProofAddressPublicKey().size() == Crypto::SECP256K1_PUBLIC_KEY_SIZE) {
+																	
+																		// Set sender payment proof address to the slate's sender payment proof address public key as an MQS address
+																		senderPaymentProofAddress = Mqs::secp256k1PublicKeyToAddress(slate.getSenderPaymentProofAddressPublicKey().data());
+																	}
+																	
+																	// Otherwise
+																	else {
+																	
+																		// Set sender payment proof address to the slate's sender payment proof address public key as a Tor address
+																		senderPaymentProofAddress = Tor::ed25519PublicKeyToAddress(slate.getSenderPaymentProofAddressPublicKey().data());
+																	}
+																	
+																	// Check if getting slate's excess failed
+																	uint8_t excess[Crypto::COMMITMENT_SIZE];
+																	if(!slate.getExcess(excess)) {
 																	
-																		// Securely clear private nonce
-																		explicit_bzero(privateNonce, sizeof(privateNonce));
-																		
-																		// Securely clear blinding factor
-																		explicit_bzero(blindingFactor, sizeof(blindingFactor));
-																		
 																		// Check if adding internal error JSON-RPC error to buffer failed
 																		if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32603,\"message\":\"Internal error\"}}", json["id"].get_uint64().value()) == -1) {
 																		
@@ -1561,7 +2008,7 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 																			evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 																			
 																			// Reply with internal server error response to request
-																			evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+																			sendReply(request, HTTP_INTERNAL, nullptr);
 																			
 																			// Return
 																			return;
@@ -1571,33 +2018,9 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 																	// Otherwise
 																	else {
 																	
-																		// Securely clear private nonce
-																		explicit_bzero(privateNonce, sizeof(privateNonce));
-																		
-																		// Securely clear blinding factor
-																		explicit_bzero(blindingFactor, sizeof(blindingFactor));
-																		
-																		// Set slate participant's partial signature
-																		slate.setParticipantsPartialSignature(partialSignature);
-																		
-																		// Check if slate's sender payment proof address public key is a secp256k1 public key
-																		string senderPaymentProofAddress;
-																		if(slate.getSenderPaymentProofAddressPublicKey().size() == Crypto::SECP256K1_PUBLIC_KEY_SIZE) {
-																		
-																			// Set sender payment proof address to the slate's sender payment proof address public key as an MQS address
-																			senderPaymentProofAddress = Mqs::secp256k1PublicKeyToAddress(slate.getSenderPaymentProofAddressPublicKey().data());
-																		}
-																		
-																		// Otherwise
-																		else {
-																		
-																			// Set sender payment proof address to the slate's sender payment proof address public key as a Tor address
-																			senderPaymentProofAddress = Tor::ed25519PublicKeyToAddress(slate.getSenderPaymentProofAddressPublicKey().data());
-																		}
-																		
-																		// Check if getting slate's excess failed
-																		uint8_t excess[Crypto::COMMITMENT_SIZE];
-																		if(!slate.getExcess(excess)) {
+																		// Check if getting recipient payment proof signature failed
+																		uint8_t recipientPaymentProofSignature[Crypto::ED25519_SIGNATURE_SIZE];
+																		if(!wallet.getTorPaymentProofSignature(recipientPaymentProofSignature, paymentProofIndex, excess, senderPaymentProofAddress.c_str(), slate.getAmount())) {
 																		
 																			// Check if adding internal error JSON-RPC error to buffer failed
 																			if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32603,\"message\":\"Internal error\"}}", json["id"].get_uint64().value()) == -1) {
@@ -1606,7 +2029,7 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 																				evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 																				
 																				// Reply with internal server error response to request
-																				evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+																				sendReply(request, HTTP_INTERNAL, nullptr);
 																				
 																				// Return
 																				return;
@@ -1616,148 +2039,183 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 																		// Otherwise
 																		else {
 																		
-																			// Check if getting recipient payment proof signature failed
-																			uint8_t recipientPaymentProofSignature[Crypto::ED25519_SIGNATURE_SIZE];
-																			if(!wallet.getTorPaymentProofSignature(recipientPaymentProofSignature, paymentProofIndex, excess, senderPaymentProofAddress.c_str(), slate.getAmount())) {
+																			// Set slate's recipient payment proof signature
+																			slate.setRecipientPaymentProofSignature(recipientPaymentProofSignature, sizeof(recipientPaymentProofSignature));
 																			
-																				// Check if adding internal error JSON-RPC error to buffer failed
-																				if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32603,\"message\":\"Internal error\"}}", json["id"].get_uint64().value()) == -1) {
-																				
-																					// Remove request's response's content type header
-																					evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-																					
-																					// Reply with internal server error response to request
-																					evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
-																					
-																					// Return
-																					return;
-																				}
-																			}
+																			// Serialize the slate
+																			const vector serializedSlate = slate.serialize();
 																			
-																			// Otherwise
-																			else {
+																			// Check if adding JSON-RPC result to buffer failed
+																			if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"result\":{\"Ok\":\"%s\"}}", json["id"].get_uint64().value(), Slatepack::encode(serializedSlate.data(), serializedSlate.size(), get<2>(slateData).has_value() ? get<2>(slateData).value().data() : nullptr, wallet, paymentProofIndex).c_str()) == -1) {
 																			
-																				// Set slate's recipient payment proof signature
-																				slate.setRecipientPaymentProofSignature(recipientPaymentProofSignature, sizeof(recipientPaymentProofSignature));
+																				// Remove request's response's content type header
+																				evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 																				
-																				// Serialize the slate
-																				const vector serializedSlate = slate.serialize();
+																				// Reply with internal server error response to request
+																				sendReply(request, HTTP_INTERNAL, nullptr);
 																				
-																				// Check if adding JSON-RPC result to buffer failed
-																				if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"result\":{\"Ok\":\"%s\"}}", json["id"].get_uint64().value(), Slatepack::encode(serializedSlate.data(), serializedSlate.size(), slateData.second.has_value() ? slateData.second.value().data() : nullptr, wallet, paymentProofIndex).c_str()) == -1) {
+																				// Return
+																				return;
+																			}
+																			
+																			// Initialize error occurred
+																			bool errorOccurred = false;
+																			
+																			// Check if compressing
+																			if(compress) {
+																			
+																				// Check if getting buffer's uncompressed data failed
+																				const unsigned char *uncompressedData = evbuffer_pullup(buffer.get(), evbuffer_get_length(buffer.get()));
+																				if(!uncompressedData) {
 																				
 																					// Remove request's response's content type header
 																					evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 																					
 																					// Reply with internal server error response to request
-																					evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+																					sendReply(request, HTTP_INTERNAL, nullptr);
 																					
 																					// Return
 																					return;
 																				}
 																				
-																				// Initialize error occurred
-																				bool errorOccurred = false;
+																				// Try
+																				vector<uint8_t> compressedData;
+																				try {
+																			
+																					// Compress uncompressed data
+																					compressedData = Gzip::compress(uncompressedData, evbuffer_get_length(buffer.get()));
+																				}
 																				
-																				// Check if compressing
-																				if(compress) {
+																				// Catch errors
+																				catch(...) {
 																				
-																					// Check if getting buffer's uncompressed data failed
-																					const unsigned char *uncompressedData = evbuffer_pullup(buffer.get(), evbuffer_get_length(buffer.get()));
-																					if(!uncompressedData) {
+																					// Set error occurred
+																					errorOccurred = true;
+																					
+																					// Check if clearing buffer failed
+																					if(evbuffer_drain(buffer.get(), evbuffer_get_length(buffer.get()))) {
 																					
 																						// Remove request's response's content type header
 																						evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 																						
 																						// Reply with internal server error response to request
-																						evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
+																						sendReply(request, HTTP_INTERNAL, nullptr);
 																						
 																						// Return
 																						return;
 																					}
 																					
-																					// Try
-																					vector<uint8_t> compressedData;
-																					try {
+																					// Check if adding internal error JSON-RPC error to buffer failed
+																					if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32603,\"message\":\"Internal error\"}}", json["id"].get_uint64().value()) == -1) {
+																					
+																						// Remove request's response's content type header
+																						evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+																						
+																						// Reply with internal server error response to request
+																						sendReply(request, HTTP_INTERNAL, nullptr);
+																						
+																						// Return
+																						return;
+																					}
+																				}
 																				
-																						// Compress uncompressed data
-																						compressedData = Gzip::compress(uncompressedData, evbuffer_get_length(buffer.get()));
+																				// Check if an error didn't occur
+																				if(!errorOccurred) {
+																				
+																					// Check if clearing buffer and setting it to the compressed data failed
+																					if(evbuffer_drain(buffer.get(), evbuffer_get_length(buffer.get())) || evbuffer_add(buffer.get(), compressedData.data(), compressedData.size())) {
+																					
+																						// Remove request's response's content type header
+																						evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+																						
+																						// Reply with internal server error response to request
+																						sendReply(request, HTTP_INTERNAL, nullptr);
+																						
+																						// Return
+																						return;
 																					}
 																					
-																					// Catch errors
-																					catch(...) {
+																					// Check if setting request's response's content encoding and vary headers failed
+																					if(evhttp_add_header(evhttp_request_get_output_headers(request), "Content-Encoding", "gzip") || evhttp_add_header(evhttp_request_get_output_headers(request), "Vary", "Accept-Encoding")) {
 																					
-																						// Set error occurred
-																						errorOccurred = true;
+																						// Remove request's response's content encoding and vary headers
+																						evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Encoding");
+																						evhttp_remove_header(evhttp_request_get_output_headers(request), "Vary");
 																						
-																						// Check if clearing buffer failed
-																						if(evbuffer_drain(buffer.get(), evbuffer_get_length(buffer.get()))) {
+																						// Remove request's response's content type header
+																						evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 																						
-																							// Remove request's response's content type header
-																							evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-																							
-																							// Reply with internal server error response to request
-																							evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
-																							
-																							// Return
-																							return;
-																						}
+																						// Reply with internal server error response to request
+																						sendReply(request, HTTP_INTERNAL, nullptr);
 																						
-																						// Check if adding internal error JSON-RPC error to buffer failed
-																						if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32603,\"message\":\"Internal error\"}}", json["id"].get_uint64().value()) == -1) {
+																						// Return
+																						return;
+																					}
+																				}
+																			}
+																			
+																			// Check if an error didn't occur
+																			if(!errorOccurred) {
+																			
+																				// Get payment ID
+																				const uint64_t &paymentId = get<1>(paymentInfo);
+																				
+																				// Check if setting that payment is received failed
+																				if(!payments.setPaymentReceived(paymentId, slate.getAmount(), senderPaymentProofAddress.c_str(), excess, slate.getParticipants().front().getPublicBlindExcess(), partialSignature, publicNonceSum, kernelData.data(), kernelData.size(), get<4>(paymentInfo).has_value() ? get<4>(paymentInfo).value().c_str() : (priceDisable ? nullptr : currentPrice.c_str()))) {
+																				
+																					// Check if compressing and removing request's response's content encoding and vary headers failed
+																					if(compress && (evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Encoding") || evhttp_remove_header(evhttp_request_get_output_headers(request), "Vary"))) {
+																					
+																						// Remove request's response's content encoding and vary headers
+																						evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Encoding");
+																						evhttp_remove_header(evhttp_request_get_output_headers(request), "Vary");
 																						
-																							// Remove request's response's content type header
-																							evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-																							
-																							// Reply with internal server error response to request
-																							evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
-																							
-																							// Return
-																							return;
-																						}
+																						// Remove request's response's content type header
+																						evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+																						
+																						// Reply with internal server error response to request
+																						sendReply(request, HTTP_INTERNAL, nullptr);
+																						
+																						// Return
+																						return;
 																					}
 																					
-																					// Check if an error didn't occur
-																					if(!errorOccurred) {
+																					// Check if clearing buffer failed
+																					if(evbuffer_drain(buffer.get(), evbuffer_get_length(buffer.get()))) {
 																					
-																						// Check if clearing buffer and setting it to the compressed data failed
-																						if(evbuffer_drain(buffer.get(), evbuffer_get_length(buffer.get())) || evbuffer_add(buffer.get(), compressedData.data(), compressedData.size())) {
+																						// Remove request's response's content type header
+																						evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 																						
-																							// Remove request's response's content type header
-																							evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-																							
-																							// Reply with internal server error response to request
-																							evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
-																							
-																							// Return
-																							return;
-																						}
+																						// Reply with internal server error response to request
+																						sendReply(request, HTTP_INTERNAL, nullptr);
 																						
-																						// Check if setting request's response's content encoding and vary headers failed
-																						if(evhttp_add_header(evhttp_request_get_output_headers(request), "Content-Encoding", "gzip") || evhttp_add_header(evhttp_request_get_output_headers(request), "Vary", "Accept-Encoding")) {
+																						// Return
+																						return;
+																					}
+																					
+																					// Check if adding internal error JSON-RPC error to buffer failed
+																					if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32603,\"message\":\"Internal error\"}}", json["id"].get_uint64().value()) == -1) {
+																					
+																						// Remove request's response's content type header
+																						evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 																						
-																							// Remove request's response's content encoding and vary headers
-																							evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Encoding");
-																							evhttp_remove_header(evhttp_request_get_output_headers(request), "Vary");
-																							
-																							// Remove request's response's content type header
-																							evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-																							
-																							// Reply with internal server error response to request
-																							evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
-																							
-																							// Return
-																							return;
-																						}
+																						// Reply with internal server error response to request
+																						sendReply(request, HTTP_INTERNAL, nullptr);
+																						
+																						// Return
+																						return;
 																					}
 																				}
 																				
-																				// Check if an error didn't occur
-																				if(!errorOccurred) {
-																				
-																					// Get payment ID
-																					const uint64_t &paymentId = get<1>(paymentInfo);
+																				// Otherwise
+																				else {
 																				
+																					// Remove precomputed output now that the payment is received
+																					outputPrecomputer.removeReceivedOutput(identifierPath);
+																					
+																					// Display message
+																					osyncstream(cout) << "Received payment " << paymentId << endl;
+																					
 																					// Check if payment has a received callback
 																					if(get<3>(paymentInfo).has_value()) {
 																					
@@ -1785,9 +2243,9 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 																								// Recipient payment proof signature
 																								{"__recipient_payment_proof_signature__", Common::toHexString(recipientPaymentProofSignature, sizeof(recipientPaymentProofSignature))}
 																							});
-																					
+																							
 																							// Check if sending HTTP request to the payment's received callback failed
-																							if(!Common::sendHttpRequest(paymentReceivedCallback.c_str())) {
+																							if(!httpClient.sendRequest(paymentReceivedCallback.c_str())) {
 																							
 																								// Throw exception
 																								throw runtime_error("Sending HTTP request to the payment's received callback failed");
@@ -1797,109 +2255,8 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 																						// Catch errors
 																						catch(...) {
 																						
-																							// Set error occurred
-																							errorOccurred = true;
-																							
-																							// Check if compressing and removing request's response's content encoding and vary headers failed
-																							if(compress && (evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Encoding") || evhttp_remove_header(evhttp_request_get_output_headers(request), "Vary"))) {
-																							
-																								// Remove request's response's content encoding and vary headers
-																								evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Encoding");
-																								evhttp_remove_header(evhttp_request_get_output_headers(request), "Vary");
-																								
-																								// Remove request's response's content type header
-																								evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-																								
-																								// Reply with internal server error response to request
-																								evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
-																								
-																								// Return
-																								return;
-																							}
-																							
-																							// Check if clearing buffer failed
-																							if(evbuffer_drain(buffer.get(), evbuffer_get_length(buffer.get()))) {
-																							
-																								// Remove request's response's content type header
-																								evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-																								
-																								// Reply with internal server error response to request
-																								evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
-																								
-																								// Return
-																								return;
-																							}
-																							
-																							// Check if adding internal error JSON-RPC error to buffer failed
-																							if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32603,\"message\":\"Internal error\"}}", json["id"].get_uint64().value()) == -1) {
-																							
-																								// Remove request's response's content type header
-																								evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-																								
-																								// Reply with internal server error response to request
-																								evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
-																								
-																								// Return
-																								return;
-																							}
-																						}
-																					}
-																					
-																					// Check if an error didn't occur
-																					if(!errorOccurred) {
-																				
-																						// Check if setting that payment is received failed
-																						if(!payments.setPaymentReceived(paymentId, slate.getAmount(), senderPaymentProofAddress.c_str(), excess, slate.getParticipants().front().getPublicBlindExcess(), partialSignature, publicNonceSum, kernelData.data(), kernelData.size(), get<4>(paymentInfo).has_value() ? get<4>(paymentInfo).value().c_str() : (priceDisable ? nullptr : currentPrice.c_str()))) {
-																						
-																							// Check if compressing and removing request's response's content encoding and vary headers failed
-																							if(compress && (evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Encoding") || evhttp_remove_header(evhttp_request_get_output_headers(request), "Vary"))) {
-																							
-																								// Remove request's response's content encoding and vary headers
-																								evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Encoding");
-																								evhttp_remove_header(evhttp_request_get_output_headers(request), "Vary");
-																								
-																								// Remove request's response's content type header
-																								evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-																								
-																								// Reply with internal server error response to request
-																								evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
-																								
-																								// Return
-																								return;
-																							}
-																							
-																							// Check if clearing buffer failed
-																							if(evbuffer_drain(buffer.get(), evbuffer_get_length(buffer.get()))) {
-																							
-																								// Remove request's response's content type header
-																								evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-																								
-																								// Reply with internal server error response to request
-																								evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
-																								
-																								// Return
-																								return;
-																							}
-																							
-																							// Check if adding internal error JSON-RPC error to buffer failed
-																							if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32603,\"message\":\"Internal error\"}}", json["id"].get_uint64().value()) == -1) {
-																							
-																								// Remove request's response's content type header
-																								evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-																								
-																								// Reply with internal server error response to request
-																								evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
-																								
-																								// Return
-																								return;
-																							}
-																						}
-																						
-																						// Otherwise
-																						else {
-																						
 																							// Display message
-																							osyncstream(cout) << "Received payment " << paymentId << endl;
+																							osyncstream(cout) << "Sending HTTP request to payment " << paymentId << "'s received callback failed" << endl;
 																						}
 																					}
 																				}
@@ -1909,104 +2266,257 @@ void PublicServer::handleGenericRequest(evhttp_request *request) {
 																}
 															}
 														}
-														
-														// Catch errors
-														catch(...) {
-														
-															// Securely clear private nonce
-															explicit_bzero(privateNonce, sizeof(privateNonce));
-														
-															// Throw
-															throw;
-														}
+													}
+													
+													// Catch errors
+													catch(...) {
+													
+														// Securely clear private nonce
+														explicit_bzero(privateNonce, sizeof(privateNonce));
+													
+														// Throw
+														throw;
 													}
 												}
 											}
-											
-											// Catch errors
-											catch(...) {
-											
-												// Securely clear blinding factor
-												explicit_bzero(blindingFactor, sizeof(blindingFactor));
-											
-												// Throw
-												throw;
-											}
+										}
+										
+										// Catch errors
+										catch(...) {
+										
+											// Securely clear blinding factor
+											explicit_bzero(blindingFactor, sizeof(blindingFactor));
+										
+											// Throw
+											throw;
 										}
 									}
 								}
 							}
+						}
+						
+						// Catch errors
+						catch(...) {
+						
+							// Check if adding internal error JSON-RPC error to buffer failed
+							if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32603,\"message\":\"Internal error\"}}", json["id"].get_uint64().value()) == -1) {
 							
-							// Catch errors
-							catch(...) {
-							
-								// Check if adding internal error JSON-RPC error to buffer failed
-								if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32603,\"message\":\"Internal error\"}}", json["id"].get_uint64().value()) == -1) {
+								// Remove request's response's content type header
+								evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 								
-									// Remove request's response's content type header
-									evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-									
-									// Reply with internal server error response to request
-									evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
-									
-									// Return
-									return;
-								}
+								// Reply with internal server error response to request
+								sendReply(request, HTTP_INTERNAL, nullptr);
+								
+								// Return
+								return;
 							}
 						}
 					}
+				}
+				
+				// Catch errors
+				catch(...) {
+				
+					// Check if adding invalid parameters JSON-RPC error to buffer failed
+					if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32602,\"message\":\"Invalid parameters\"}}", json["id"].get_uint64().value()) == -1) {
 					
-					// Catch errors
-					catch(...) {
-					
-						// Check if adding invalid parameters JSON-RPC error to buffer failed
-						if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32602,\"message\":\"Invalid parameters\"}}", json["id"].get_uint64().value()) == -1) {
+						// Remove request's response's content type header
+						evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 						
-							// Remove request's response's content type header
-							evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-							
-							// Reply with internal server error response to request
-							evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
-							
-							// Return
-							return;
-						}
+						// Reply with internal server error response to request
+						sendReply(request, HTTP_INTERNAL, nullptr);
+						
+						// Return
+						return;
 					}
 				}
 			}
+		}
+		
+		// Otherwise
+		else {
+		
+			// Check if adding method not found JSON-RPC error to buffer failed
+			if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32601,\"message\":\"Method not found\"}}", json["id"].get_uint64().value()) == -1) {
 			
-			// Otherwise
-			else {
-			
-				// Unlock payments
-				lockPayments.unlock();
-			
-				// Check if adding method not found JSON-RPC error to buffer failed
-				if(evbuffer_add_printf(buffer.get(), "{\"jsonrpc\":\"2.0\",\"id\":%" PRIu64 ",\"error\":{\"code\":-32601,\"message\":\"Method not found\"}}", json["id"].get_uint64().value()) == -1) {
+				// Remove request's response's content type header
+				evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
 				
-					// Remove request's response's content type header
-					evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
-					
-					// Reply with internal server error response to request
-					evhttp_send_reply(request, HTTP_INTERNAL, nullptr, nullptr);
-					
-					// Return
-					return;
-				}
+				// Reply with internal server error response to request
+				sendReply(request, HTTP_INTERNAL, nullptr);
+				
+				// Return
+				return;
 			}
-			
-			// Reply with ok response to request
-			evhttp_send_reply(request, HTTP_OK, nullptr, buffer.get());
+		}
+		
+		// Reply with ok response to request
+		sendReply(request, HTTP_OK, buffer.get());
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Remove request's response's content type header
+		evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+	
+		// Reply with bad request response to request
+		sendReply(request, HTTP_BADREQUEST, nullptr);
+	}
+}
+
+// Send reply
+void PublicServer::sendReply(evhttp_request *request, const int responseCode, evbuffer *buffer) {
+
+	// Lock reply lock
+	lock_guard guard(replyLock);
+	
+	// Check if event loop stopped
+	if(eventLoopStopped) {
+	
+		// Return
+		return;
+	}
+	
+	// Check if creating reply buffer failed
+	unique_ptr<evbuffer, decltype(&evbuffer_free)> replyBuffer(buffer ? evbuffer_new() : nullptr, evbuffer_free);
+	if(buffer && !replyBuffer) {
+	
+		// Throw exception
+		throw runtime_error("Creating public server reply buffer failed");
+	}
+	
+	// Check if moving buffer's data to the reply buffer failed
+	if(buffer && evbuffer_add_buffer(replyBuffer.get(), buffer)) {
+	
+		// Throw exception
+		throw runtime_error("Moving data to public server reply buffer failed");
+	}
+	
+	// Create reply
+	unique_ptr<tuple<evhttp_request *, int, evbuffer *>> reply = make_unique<tuple<evhttp_request *, int, evbuffer *>>(request, responseCode, replyBuffer.get());
+	
+	// Check if adding reply to the event loop failed
+	if(event_base_once(eventBase.get(), -1, EV_TIMEOUT, [](const evutil_socket_t fileDescriptor, const short events, void *argument) {
+	
+		// Get reply from argument
+		const unique_ptr<tuple<evhttp_request *, int, evbuffer *>> reply(reinterpret_cast<tuple<evhttp_request *, int, evbuffer *> *>(argument));
+		
+		// Automatically free reply buffer when done
+		const unique_ptr<evbuffer, decltype(&evbuffer_free)> replyBuffer(get<2>(*reply), evbuffer_free);
+		
+		// Reply with response to request
+		evhttp_send_reply(get<0>(*reply), get<1>(*reply), nullptr, replyBuffer.get());
+		
+	}, reply.get(), nullptr)) {
+	
+		// Throw exception
+		throw runtime_error("Adding public server reply to event loop failed");
+	}
+	
+	// Release reply buffer
+	replyBuffer.release();
+	
+	// Release reply
+	reply.release();
+}
+
+// Stop worker threads
+void PublicServer::stopWorkerThreads() {
+
+	// Lock worker queue
+	unique_lock lockWorkerQueue(workerQueueLock);
+	
+	// Set quit to true
+	quit.store(true);
+	
+	// Unlock worker queue
+	lockWorkerQueue.unlock();
+	
+	// Notify all worker threads that they're quitting
+	workerQueueConditionVariable.notify_all();
+	
+	// Go through all worker threads
+	for(thread &workerThread : workerThreads) {
+	
+		// Try
+		try {
+		
+			// Wait for worker thread to finish
+			workerThread.join();
 		}
 		
 		// Catch errors
 		catch(...) {
 		
-			// Remove request's response's content type header
-			evhttp_remove_header(evhttp_request_get_output_headers(request), "Content-Type");
+			// Display message
+			osyncstream(cout) << "Waiting for public server worker thread to finish failed" << endl;
+			
+			// Exit failure
+			exit(EXIT_FAILURE);
+		}
+	}
+	
+	// Clear worker threads
+	workerThreads.clear();
+}
+
+// Update QR code cache
+void PublicServer::updateQrCodeCache() {
+
+	// Check if payment changes after the QR code cache payment changes cursor can't be obtained
+	list<tuple<uint64_t, uint64_t, string, uint64_t>> changes;
+	if(!payments.getPaymentChanges(changes, qrCodeCachePaymentChangesCursor, numeric_limits<size_t>::max())) {
+	
+		// Clear QR code cache since changes may have been missed
+		qrCodeCache.clear();
+		qrCodeCacheOrder.clear();
 		
-			// Reply with bad request response to request
-			evhttp_send_reply(request, HTTP_BADREQUEST, nullptr, nullptr);
+		// Set QR code cache payment changes cursor to the last payment change
+		qrCodeCachePaymentChangesCursor = payments.getLastPaymentChangeSequence();
+	}
+	
+	// Otherwise check if changes exist
+	else if(!changes.empty()) {
+	
+		// Initialize finished payments
+		unordered_set<uint64_t> finishedPayments;
+		
+		// Go through all changes
+		for(const tuple<uint64_t, uint64_t, string, uint64_t> &change : changes) {
+		
+			// Check if change is a payment being received or expired
+			if(get<2>(change) == "Received" || get<2>(change) == "Expired") {
+			
+				// Add payment to finished payments
+				finishedPayments.insert(get<1>(change));
+			}
+		}
+		
+		// Check if finished payments exist
+		if(!finishedPayments.empty()) {
+		
+			// Go through all cached QR codes
+			for(unordered_map<string, tuple<uint64_t, string, string, list<string>::iterator>>::iterator i = qrCodeCache.begin(); i != qrCodeCache.end();) {
+			
+				// Check if cached QR code's payment is finished
+				if(finishedPayments.contains(get<0>(i->second))) {
+				
+					// Remove cached QR code from QR code cache
+					qrCodeCacheOrder.erase(get<3>(i->second));
+					i = qrCodeCache.erase(i);
+				}
+				
+				// Otherwise
+				else {
+				
+					// Go to next cached QR code
+					++i;
+				}
+			}
 		}
+		
+		// Set QR code cache payment changes cursor to the last change
+		qrCodeCachePaymentChangesCursor = get<0>(changes.back());
 	}
 }
@@ -4,13 +4,21 @@
 
 
 // Header files
+#include <condition_variable>
 #include <filesystem>
 #include <getopt.h>
+#include <list>
+#include <mutex>
+#include <string>
 #include <thread>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
 #include "event2/event.h"
 #include "event2/http.h"
+#include "./http_client.h"
+#include "./output_precomputer.h"
+#include "./payment_proof_address_cache.h"
 #include "./payments.h"
 #include "./price.h"
 #include "./wallet.h"
@@ -27,7 +35,7 @@ class PublicServer final {
 	public:
 	
 		// Constructor
-		explicit PublicServer(const unordered_map<char, const char *> &providedOptions, const filesystem::path &currentDirectory, const Wallet &wallet, Payments &payments, const Price &price);
+		explicit PublicServer(const unordered_map<char, const char *> &providedOptions, const filesystem::path &currentDirectory, const Wallet &wallet, Payments &payments, const Price &price, HttpClient &httpClient, OutputPrecomputer &outputPrecomputer, PaymentProofAddressCache &paymentProofAddressCache);
 		
 		// Destructor
 		~PublicServer();
@@ -56,6 +64,21 @@ class PublicServer final {
 		// Handle generic request
 		void handleGenericRequest(evhttp_request *request);
 		
+		// Run worker
+		void runWorker();
+		
+		// Handle foreign API request
+		void handleForeignApiRequest(evhttp_request *request, const char *paymentUrl);
+		
+		// Send reply
+		void sendReply(evhttp_request *request, const int responseCode, evbuffer *buffer);
+		
+		// Stop worker threads
+		void stopWorkerThreads();
+		
+		// Update QR code cache
+		void updateQrCodeCache();
+		
 		// Started
 		atomic_bool started;
 		
@@ -68,12 +91,57 @@ class PublicServer final {
 		// Price
 		const Price &price;
 		
+		// HTTP client
+		HttpClient &httpClient;
+		
+		// Output precomputer
+		OutputPrecomputer &outputPrecomputer;
+		
+		// Payment proof address cache
+		PaymentProofAddressCache &paymentProofAddressCache;
+		
 		// Event base
 		unique_ptr<event_base, decltype(&event_base_free)> eventBase;
 		
 		// Price disable
 		const bool priceDisable;
 		
+		// QR code compression level
+		const int qrCodeCompressionLevel;
+		
+		// QR code compression strategy
+		const int qrCodeCompressionStrategy;
+		
+		// Quit
+		atomic_bool quit;
+		
+		// Event loop stopped
+		bool eventLoopStopped;
+		
+		// Reply lock
+		mutex replyLock;
+		
+		// Worker queue
+		list<pair<evhttp_request *, string>> workerQueue;
+		
+		// Worker queue lock
+		mutex workerQueueLock;
+		
+		// Worker queue condition variable
+		condition_variable workerQueueConditionVariable;
+		
+		// Worker threads
+		list<thread> workerThreads;
+		
+		// QR code cache payment changes cursor
+		uint64_t qrCodeCachePaymentChangesCursor;
+		
+		// QR code cache
+		unordered_map<string, tuple<uint64_t, string, string, list<string>::iterator>> qrCodeCache;
+		
+		// QR code cache order
+		list<string> qrCodeCacheOrder;
+		
 		// Main thread
 		thread mainThread;
 };
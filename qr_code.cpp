@@ -0,0 +1,237 @@
+// Header files
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include "./qr_code.h"
+#include "qrcodegen.h"
+#include "zlib.h"
+
+using namespace std;
+
+
+// Constants
+
+// PNG signature
+static const uint8_t PNG_SIGNATURE[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+// PNG bit depth
+static const uint8_t PNG_BIT_DEPTH = 1;
+
+// PNG grayscale color type
+static const uint8_t PNG_GRAYSCALE_COLOR_TYPE = 0;
+
+// PNG deflate compression method
+static const uint8_t PNG_DEFLATE_COMPRESSION_METHOD = 0;
+
+// PNG adaptive filter method
+static const uint8_t PNG_ADAPTIVE_FILTER_METHOD = 0;
+
+// PNG no interlace method
+static const uint8_t PNG_NO_INTERLACE_METHOD = 0;
+
+// PNG none filter type
+static const uint8_t PNG_NONE_FILTER_TYPE = 0;
+
+// Window bits
+static const int WINDOW_BITS = MAX_WBITS;
+
+// Memory level
+static const int MEMORY_LEVEL = MAX_MEM_LEVEL;
+
+
+// Function prototypes
+
+// Add PNG chunk
+static void addPngChunk(string &png, const char type[sizeof("IHDR") - sizeof('\0')], const uint8_t *data, const size_t length);
+
+// Add PNG number
+static void addPngNumber(string &png, uint32_t number);
+
+
+// Supporting function implementation
+
+// Get PNG
+string QrCode::getPng(const uint8_t *qrCode, const int padding, const bool invert, const int compressionLevel, const int compressionStrategy) {
+
+	// Get QR code size
+	const int size = qrcodegen_getSize(qrCode);
+	
+	// Get image size
+	const uint32_t imageSize = size + padding * 2;
+	
+	// Get row size as the filter type followed by one bit per pixel
+	const size_t rowSize = sizeof(PNG_NONE_FILTER_TYPE) + (imageSize + numeric_limits<uint8_t>::digits - 1) / numeric_limits<uint8_t>::digits;
+	
+	// Initialize scanlines with every pixel set to the light color
+	vector<uint8_t> scanlines(rowSize * imageSize, invert ? 0 : numeric_limits<uint8_t>::max());
+	
+	// Go through all rows in the image
+	for(uint32_t y = 0; y < imageSize; ++y) {
+	
+		// Set row's filter type
+		scanlines[y * rowSize] = PNG_NONE_FILTER_TYPE;
+	}
+	
+	// Go through all rows in the QR code
+	for(int y = 0; y < size; ++y) {
+	
+		// Get row's pixels
+		uint8_t *pixels = &scanlines[(y + padding) * rowSize + sizeof(PNG_NONE_FILTER_TYPE)];
+		
+		// Go through all modules in the row
+		for(int x = 0; x < size; ++x) {
+		
+			// Check if module is dark
+			if(qrcodegen_getModule(qrCode, x, y)) {
+			
+				// Toggle pixel to the dark color
+				pixels[(x + padding) / numeric_limits<uint8_t>::digits] ^= 1 << (numeric_limits<uint8_t>::digits - 1 - (x + padding) % numeric_limits<uint8_t>::digits);
+			}
+		}
+	}
+	
+	// Check if scanlines are too large
+	if(scanlines.size() > numeric_limits<uInt>::max()) {
+	
+		// Throw exception
+		throw runtime_error("Scanlines are too large");
+	}
+	
+	// Initialize stream
+	z_stream stream = {
+	
+		// Next in
+		.next_in = scanlines.data(),
+		
+		// Available in
+		.avail_in = static_cast<uInt>(scanlines.size())
+	};
+	
+	// Check if initializing stream failed
+	if(deflateInit2(&stream, compressionLevel, Z_DEFLATED, WINDOW_BITS, MEMORY_LEVEL, compressionStrategy) != Z_OK) {
+	
+		// Throw exception
+		throw runtime_error("Initializing stream failed");
+	}
+	
+	// Automatically free stream
+	const unique_ptr<z_stream, decltype(&deflateEnd)> streamUniquePointer(&stream, deflateEnd);
+	
+	// Check if deflating scanlines failed
+	vector<uint8_t> imageData(deflateBound(&stream, scanlines.size()));
+	stream.next_out = imageData.data();
+	stream.avail_out = imageData.size();
+	if(deflate(&stream, Z_FINISH) != Z_STREAM_END) {
+	
+		// Throw exception
+		throw runtime_error("Deflating scanlines failed");
+	}
+	
+	// Initialize result
+	string result(reinterpret_cast<const char *>(PNG_SIGNATURE), sizeof(PNG_SIGNATURE));
+	
+	// Get image header
+	string imageHeader;
+	addPngNumber(imageHeader, imageSize);
+	addPngNumber(imageHeader, imageSize);
+	imageHeader.push_back(PNG_BIT_DEPTH);
+	imageHeader.push_back(PNG_GRAYSCALE_COLOR_TYPE);
+	imageHeader.push_back(PNG_DEFLATE_COMPRESSION_METHOD);
+	imageHeader.push_back(PNG_ADAPTIVE_FILTER_METHOD);
+	imageHeader.push_back(PNG_NO_INTERLACE_METHOD);
+	
+	// Add image header, image data, and image end chunks to result
+	addPngChunk(result, "IHDR", reinterpret_cast<const uint8_t *>(imageHeader.data()), imageHeader.size());
+	addPngChunk(result, "IDAT", imageData.data(), stream.total_out);
+	addPngChunk(result, "IEND", nullptr, 0);
+	
+	// Return result
+	return result;
+}
+
+// Get SVG
+string QrCode::getSvg(const uint8_t *qrCode, const int padding, const bool invert) {
+
+	// Get QR code size
+	const int size = qrcodegen_getSize(qrCode);
+	
+	// Get image size
+	const string imageSize = to_string(size + padding * 2);
+	
+	// Initialize result with the image's background
+	string result = "<svg xmlns=\"http://www.w3.org/2000/svg\" viewBox=\"0 0 " + imageSize + ' ' + imageSize + "\" shape-rendering=\"crispEdges\"><rect width=\"100%\" height=\"100%\" fill=\"" + (invert ? "#000" : "#fff") + "\"/><path fill=\"" + (invert ? "#fff" : "#000") + "\" d=\"";
+	
+	// Go through all rows in the QR code
+	for(int y = 0; y < size; ++y) {
+	
+		// Go through all modules in the row
+		for(int x = 0; x < size; ++x) {
+		
+			// Check if module is dark
+			if(qrcodegen_getModule(qrCode, x, y)) {
+			
+				// Get length of the run of dark modules starting at the module
+				int length = 1;
+				while(x + length < size && qrcodegen_getModule(qrCode, x + length, y)) {
+				
+					// Increment length
+					++length;
+				}
+				
+				// Add run of dark modules to result
+				result += 'M' + to_string(x + padding) + ' ' + to_string(y + padding) + 'h' + to_string(length) + "v1h-" + to_string(length) + 'z';
+				
+				// Skip the run of dark modules
+				x += length - 1;
+			}
+		}
+	}
+	
+	// Add end of image to result
+	result += "\"/></svg>";
+	
+	// Return result
+	return result;
+}
+
+// Add PNG chunk
+void addPngChunk(string &png, const char type[sizeof("IHDR") - sizeof('\0')], const uint8_t *data, const size_t length) {
+
+	// Add length to PNG
+	addPngNumber(png, length);
+	
+	// Add type to PNG
+	png.append(type, sizeof("IHDR") - sizeof('\0'));
+	
+	// Get checksum of the type
+	uint32_t checksum = crc32(0, Z_NULL, 0);
+	checksum = crc32_z(checksum, reinterpret_cast<const uint8_t *>(type), sizeof("IHDR") - sizeof('\0'));
+	
+	// Check if data exists
+	if(length) {
+	
+		// Add data to PNG
+		png.append(reinterpret_cast<const char *>(data), length);
+		
+		// Update checksum with the data
+		checksum = crc32_z(checksum, data, length);
+	}
+	
+	// Add checksum to PNG
+	addPngNumber(png, checksum);
+}
+
+// Add PNG number
+void addPngNumber(string &png, uint32_t number) {
+
+	// Check if little endian
+	#if BYTE_ORDER == LITTLE_ENDIAN
+	
+		// Make number big endian
+		number = __builtin_bswap32(number);
+	#endif
+	
+	// Add number to PNG
+	png.append(reinterpret_cast<const char *>(&number), sizeof(number));
+}
@@ -0,0 +1,32 @@
+// Header guard
+#ifndef QR_CODE_H
+#define QR_CODE_H
+
+
+// Header files
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+
+// Classes
+
+// QR code class
+class QrCode final {
+
+	// Public
+	public:
+	
+		// Constructor
+		QrCode() = delete;
+		
+		// Get PNG
+		static string getPng(const uint8_t *qrCode, const int padding, const bool invert, const int compressionLevel, const int compressionStrategy);
+		
+		// Get SVG
+		static string getSvg(const uint8_t *qrCode, const int padding, const bool invert);
+};
+
+
+#endif
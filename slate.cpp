@@ -36,6 +36,9 @@ static const size_t COMPRESSED_NUMBER_OF_DIGITS_SIZE = 6;
 // Compressed hundreds scaling factor
 static const size_t COMPRESSED_HUNDREDS_SCALING_FACTOR = 100;
 
+// Serialized bit fields maximum size
+static const size_t SERIALIZED_BIT_FIELDS_MAXIMUM_SIZE = 64;
+
 // Purpose
 enum class Purpose {
 
@@ -404,8 +407,8 @@ void Slate::setRecipientPaymentProofSignature(const uint8_t *recipientPaymentPro
 // Serialize
 vector<uint8_t> Slate::serialize() const {
 
-	// Initialize bit writer
-	BitWriter bitWriter;
+	// Initialize bit writer with enough capacity for the serialized slate
+	BitWriter bitWriter(sizeof(id) + sizeof(offset) + Crypto::COMMITMENT_SIZE + Crypto::BULLETPROOF_SIZE + Crypto::COMMITMENT_SIZE + Crypto::SECP256K1_SINGLE_SIGNER_SIGNATURE_SIZE + Crypto::SECP256K1_PUBLIC_KEY_SIZE + Crypto::SECP256K1_PUBLIC_KEY_SIZE + Crypto::SECP256K1_SINGLE_SIGNER_SIGNATURE_SIZE + senderPaymentProofAddressPublicKey.size() + recipientPaymentProofAddressPublicKey.size() + recipientPaymentProofSignature.size() + SERIALIZED_BIT_FIELDS_MAXIMUM_SIZE);
 	
 	// Write purpose
 	bitWriter.setBits(static_cast<underlying_type<Purpose>::type>(Purpose::SEND_RESPONSE), COMPRESSED_PURPOSE_SIZE);
@@ -29,12 +29,21 @@ static const char ENCRYPTED_FOOTER[] = ". ENDSLATEPACK.";
 // Checksum digest algorithm
 static const char *CHECKSUM_DIGEST_ALGORITHM = "SHA-256";
 
+// Checksum digest
+static thread_local const unique_ptr<EVP_MD, decltype(&EVP_MD_free)> checksumDigest(EVP_MD_fetch(nullptr, CHECKSUM_DIGEST_ALGORITHM, nullptr), EVP_MD_free);
+
+// Checksum digest context
+static thread_local const unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> checksumDigestContext(EVP_MD_CTX_new(), EVP_MD_CTX_free);
+
 // Checksum size
 static const size_t CHECKSUM_SIZE = 4;
 
 // Version
 static const uint8_t VERSION = 0;
 
+// Encoded payload
+static thread_local string encodedPayload;
+
 
 // Function prototypes
 
@@ -107,7 +116,7 @@ string Slatepack::encode(const uint8_t *data, const size_t length, const uint8_t
 }
 
 // Decode
-pair<vector<uint8_t>, optional<array<uint8_t, Crypto::ED25519_PUBLIC_KEY_SIZE>>> Slatepack::decode(const char *data, const Wallet &wallet, const uint64_t index) {
+tuple<const uint8_t *, size_t, optional<array<uint8_t, Crypto::ED25519_PUBLIC_KEY_SIZE>>> Slatepack::decode(vector<uint8_t> &payload, const char *data, const Wallet &wallet, const uint64_t index) {
 
 	// Get length
 	const size_t length = strlen(data);
@@ -116,7 +125,7 @@ pair<vector<uint8_t>, optional<array<uint8_t, Crypto::ED25519_PUBLIC_KEY_SIZE>>>
 	if(length >= sizeof(HEADER) - sizeof('\0') + sizeof(FOOTER) - sizeof('\0') && !strncmp(data, HEADER, sizeof(HEADER) - sizeof('\0')) && !strncmp(&data[length - (sizeof(FOOTER) - sizeof('\0'))], FOOTER, sizeof(FOOTER) - sizeof('\0'))) {
 	
 		// Get encoded payload from data and remove spaces and newlines from it
-		string encodedPayload(&data[sizeof(HEADER) - sizeof('\0')], &data[sizeof(HEADER) - sizeof('\0')] + length - (sizeof(HEADER) - sizeof('\0') + sizeof(FOOTER) - sizeof('\0')));
+		encodedPayload.assign(&data[sizeof(HEADER) - sizeof('\0')], &data[sizeof(HEADER) - sizeof('\0')] + length - (sizeof(HEADER) - sizeof('\0') + sizeof(FOOTER) - sizeof('\0')));
 		encodedPayload.erase(remove_if(encodedPayload.begin(), encodedPayload.end(), ([](const char character) -> bool {
 		
 			// Return if character is a space or newline
@@ -124,8 +133,8 @@ pair<vector<uint8_t>, optional<array<uint8_t, Crypto::ED25519_PUBLIC_KEY_SIZE>>>
 			
 		})), encodedPayload.end());
 		
-		// Decode encoded payload
-		vector payload = Base58::decode(encodedPayload.c_str());
+		// Decode encoded payload into payload
+		Base58::decodeInto(payload, encodedPayload.data(), encodedPayload.size());
 		
 		// Check if payload doesn't contain a checksum and version
 		if(payload.size() < CHECKSUM_SIZE + sizeof(VERSION)) {
@@ -172,18 +181,15 @@ pair<vector<uint8_t>, optional<array<uint8_t, Crypto::ED25519_PUBLIC_KEY_SIZE>>>
 			throw runtime_error("Slate length is invalid");
 		}
 		
-		// Remove everything except the slate from the payload
-		payload.erase(payload.begin(), payload.begin() + CHECKSUM_SIZE + sizeof(version) + sizeof(slateLength));
-		
-		// Return payload
-		return {payload, nullopt};
+		// Return slate in the payload
+		return {payload.data() + CHECKSUM_SIZE + sizeof(version) + sizeof(slateLength), slateLength, nullopt};
 	}
 	
 	// Otherwise check if data has an encrypted header and footer
 	else if(length >= sizeof(ENCRYPTED_HEADER) - sizeof('\0') + sizeof(ENCRYPTED_FOOTER) - sizeof('\0') && !strncmp(data, ENCRYPTED_HEADER, sizeof(ENCRYPTED_HEADER) - sizeof('\0')) && !strncmp(&data[length - (sizeof(ENCRYPTED_FOOTER) - sizeof('\0'))], ENCRYPTED_FOOTER, sizeof(ENCRYPTED_FOOTER) - sizeof('\0'))) {
 	
 		// Get encoded payload from data and remove spaces and newlines from it
-		string encodedPayload(&data[sizeof(ENCRYPTED_HEADER) - sizeof('\0')], &data[sizeof(ENCRYPTED_HEADER) - sizeof('\0')] + length - (sizeof(ENCRYPTED_HEADER) - sizeof('\0') + sizeof(ENCRYPTED_FOOTER) - sizeof('\0')));
+		encodedPayload.assign(&data[sizeof(ENCRYPTED_HEADER) - sizeof('\0')], &data[sizeof(ENCRYPTED_HEADER) - sizeof('\0')] + length - (sizeof(ENCRYPTED_HEADER) - sizeof('\0') + sizeof(ENCRYPTED_FOOTER) - sizeof('\0')));
 		encodedPayload.erase(remove_if(encodedPayload.begin(), encodedPayload.end(), ([](const char character) -> bool {
 		
 			// Return if character is a space or newline
@@ -191,8 +197,8 @@ pair<vector<uint8_t>, optional<array<uint8_t, Crypto::ED25519_PUBLIC_KEY_SIZE>>>
 			
 		})), encodedPayload.end());
 		
-		// Decode encoded payload
-		const vector payload = Base58::decode(encodedPayload.c_str());
+		// Decode encoded payload into payload
+		Base58::decodeInto(payload, encodedPayload.data(), encodedPayload.size());
 		
 		// Check if payload doesn't contain a checksum and version
 		if(payload.size() < CHECKSUM_SIZE + sizeof(VERSION)) {
@@ -272,10 +278,13 @@ pair<vector<uint8_t>, optional<array<uint8_t, Crypto::ED25519_PUBLIC_KEY_SIZE>>>
 		}
 		
 		// Get payload's encrypted slate
-		const uint8_t *encryptedSlate = &payload[CHECKSUM_SIZE + sizeof(version) + senderPublicKey.size() + Crypto::ED25519_PUBLIC_KEY_SIZE + Crypto::CHACHA20_NONCE_SIZE + sizeof(encryptedSlateLength)];
+		uint8_t *encryptedSlate = &payload[CHECKSUM_SIZE + sizeof(version) + senderPublicKey.size() + Crypto::ED25519_PUBLIC_KEY_SIZE + Crypto::CHACHA20_NONCE_SIZE + sizeof(encryptedSlateLength)];
+		
+		// Decrypt encrypted slate in place
+		const size_t slateLength = wallet.decryptAddressMessage(encryptedSlate, encryptedSlateLength, nonce, senderPublicKey.data(), index, version);
 		
-		// Return decrypted slate and sender public key
-		return {wallet.decryptAddressMessage(encryptedSlate, encryptedSlateLength, nonce, senderPublicKey.data(), index, version), senderPublicKey};
+		// Return decrypted slate in the payload and sender public key
+		return {encryptedSlate, slateLength, senderPublicKey};
 	}
 	
 	// Otherwise
@@ -290,30 +299,28 @@ pair<vector<uint8_t>, optional<array<uint8_t, Crypto::ED25519_PUBLIC_KEY_SIZE>>>
 void getChecksum(uint8_t checksum[CHECKSUM_SIZE], const uint8_t *data, const size_t length) {
 
 	// Check if getting digest failed
-	const unique_ptr<EVP_MD, decltype(&EVP_MD_free)> digest(EVP_MD_fetch(nullptr, CHECKSUM_DIGEST_ALGORITHM, nullptr), EVP_MD_free);
-	if(!digest) {
+	if(!checksumDigest) {
 	
 		// Throw exception
 		throw runtime_error("Getting digest failed");
 	}
 	
 	// Check if creating digest context failed
-	const unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> digestContext(EVP_MD_CTX_new(), EVP_MD_CTX_free);
-	if(!digestContext) {
+	if(!checksumDigestContext) {
 	
 		// Throw exception
 		throw runtime_error("Creating digest context failed");
 	}
 	
 	// Check if initializing digest context failed
-	if(!EVP_DigestInit_ex2(digestContext.get(), digest.get(), nullptr)) {
+	if(!EVP_DigestInit_ex2(checksumDigestContext.get(), checksumDigest.get(), nullptr)) {
 	
 		// Throw exception
 		throw runtime_error("Initializing digest context failed");
 	}
 	
 	// Check if hashing data failed
-	if(!EVP_DigestUpdate(digestContext.get(), data, length)) {
+	if(!EVP_DigestUpdate(checksumDigestContext.get(), data, length)) {
 	
 		// Throw exception
 		throw runtime_error("Hashing data failed");
@@ -329,7 +336,7 @@ void getChecksum(uint8_t checksum[CHECKSUM_SIZE], const uint8_t *data, const siz
 		// End
 		OSSL_PARAM_END
 	};
-	if(!EVP_MD_get_params(digest.get(), getDigestLengthParameters)) {
+	if(!EVP_MD_get_params(checksumDigest.get(), getDigestLengthParameters)) {
 	
 		// Throw exception
 		throw runtime_error("Getting digest length failed");
@@ -338,28 +345,28 @@ void getChecksum(uint8_t checksum[CHECKSUM_SIZE], const uint8_t *data, const siz
 	// Check if getting hash failed
 	uint8_t hash[digestLength];
 	unsigned int hashLength;
-	if(!EVP_DigestFinal_ex(digestContext.get(), hash, &hashLength) || hashLength != sizeof(hash)) {
+	if(!EVP_DigestFinal_ex(checksumDigestContext.get(), hash, &hashLength) || hashLength != sizeof(hash)) {
 	
 		// Throw exception
 		throw runtime_error("Getting hash failed");
 	}
 	
 	// Check if initializing digest context failed
-	if(!EVP_DigestInit_ex2(digestContext.get(), digest.get(), nullptr)) {
+	if(!EVP_DigestInit_ex2(checksumDigestContext.get(), checksumDigest.get(), nullptr)) {
 	
 		// Throw exception
 		throw runtime_error("Initializing digest context failed");
 	}
 	
 	// Check if hashing hash failed
-	if(!EVP_DigestUpdate(digestContext.get(), hash, sizeof(hash))) {
+	if(!EVP_DigestUpdate(checksumDigestContext.get(), hash, sizeof(hash))) {
 	
 		// Throw exception
 		throw runtime_error("Hashing hash failed");
 	}
 	
 	// Check if getting hash failed
-	if(!EVP_DigestFinal_ex(digestContext.get(), hash, &hashLength) || hashLength != sizeof(hash)) {
+	if(!EVP_DigestFinal_ex(checksumDigestContext.get(), hash, &hashLength) || hashLength != sizeof(hash)) {
 	
 		// Throw exception
 		throw runtime_error("Getting hash failed");
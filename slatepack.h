@@ -7,6 +7,7 @@
 #include <array>
 #include <optional>
 #include <string>
+#include <tuple>
 #include <vector>
 #include "./crypto.h"
 #include "./wallet.h"
@@ -29,7 +30,7 @@ class Slatepack final {
 		static string encode(const uint8_t *data, const size_t length, const uint8_t recipientPublicKey[Crypto::ED25519_PUBLIC_KEY_SIZE], const Wallet &wallet, const uint64_t index);
 		
 		// Decode
-		static pair<vector<uint8_t>, optional<array<uint8_t, Crypto::ED25519_PUBLIC_KEY_SIZE>>> decode(const char *data, const Wallet &wallet, const uint64_t index);
+		static tuple<const uint8_t *, size_t, optional<array<uint8_t, Crypto::ED25519_PUBLIC_KEY_SIZE>>> decode(vector<uint8_t> &payload, const char *data, const Wallet &wallet, const uint64_t index);
 		
 };
 
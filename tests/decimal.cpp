@@ -0,0 +1,229 @@
+// Header files
+#include <cstring>
+#include <iostream>
+#include <tuple>
+#include <vector>
+#include "../common.h"
+#include "../decimal.h"
+
+using namespace std;
+
+
+// Constants
+
+// Multiply strings tests (first string, second string, result produced by MPFR)
+static const tuple<const char *, const char *, const char *> MULTIPLY_STRINGS_TESTS[] = {
+	{"1", "1", "1"},
+	{"0", "123.45", "0"},
+	{"1.5", "2", "3"},
+	{"0.125", "0.5", "0.0625"},
+	{"12345678.9", "0.00000001", "0.123456789"},
+	{"0.000000001", "1000000000", "1"},
+	{"99999999.99999999", "99999999.99999999", "9999999999999998.0000000000000001"},
+	{"0.1", "0.2", "0.02"},
+	{"3.14159", "2.71828", "8.5397212652"},
+	{"1000000000", "0.010001", "10001000"},
+	{"1546586.768", "626121.719142", "968351565982.429513056"},
+	{"28123190421.82271", "17612", "495305629709141.56852"},
+	{"96369.91089815", "437264.9", "42139179451.888469935"},
+	{"790332025.5", "873.871106103", "690648321312.3094016265"},
+	{"420890.178", "22026.458563", "9270720065.290694214"},
+	{"33861609.75078", "376.712285941", "12756084414.85838910778398"},
+	{"689", "7102.98564685", "4893957.11067965"},
+	{"73164.301", "197.717479237", "14465861.163857118337"},
+	{"2112594.291628673", "8.158", "17234544.231106714334"},
+	{"1892589936.1620739", "256856.67491883", "486124357987431.037940006961537"},
+	{"18813.2570", "0.31", "5832.10967"},
+	{"156297.50", "23.5322", "3678024.0295"},
+	{"93.245043", "841.1351937", "78431.6873053698291"},
+	{"7931187.888077", "65", "515527212.725005"},
+	{"42.3801", "2.6421", "111.97246221"},
+	{"82027844.457573", "4.297330", "352500716.82286218009"},
+	{"31373281576.500421", "649024.4", "20362025251219239.8392724"},
+	{"440017", "43.934", "19331706.878"},
+	{"92854.7624434", "86.486", "8030636.9846798924"},
+	{"742751350783.494006", "34.71", "25780899385695.07694826"},
+	{"78786901.105", "65.1607", "5133809626.8325735"},
+	{"2808992.6738", "4338.6278", "12187173704.54501164"},
+	{"74.08", "932409.187034978", "69072872.57555117024"},
+	{"7482679.7761539", "2657.4220", "19884637856.1064492458"},
+	{"88153572464.43506162", "9.41739373", "830176900603.6713972923516426"},
+	{"890651.7794602", "0.38559", "343426.419642058518"},
+	{"920464.48774357", "6113.9373", "5627662164.940805458161"},
+	{"7", "4917.981358", "34425.869506"},
+	{"819773494", "68.25", "55949540965.5"},
+	{"16771526027", "3532.558320389", "59246393812299.518264503"}
+};
+
+// Average price tests (prices, result produced by MPFR)
+static const tuple<vector<const char *>, const char *> AVERAGE_PRICE_TESTS[] = {
+	{{"546.86376"}, "546.86376"},
+	{{"626.2", "67.9", "426.81"}, "373.64"},
+	{{"19", "21.82271", "17.120896"}, "19.314535"},
+	{{"9.91089815", "437.64", "987.033202515", "873.871106103"}, "577.113801692"},
+	{{"208.031784220", "6.458563", "33.61609575", "78.376971", "2.59412689", "40.1028985"}, "61.530073227"},
+	{{"6.54731643", "17", "979.1747923"}, "334.24070291"},
+	{{"2.1", "5.492916286", "32.31585189", "58.936716207", "99.56", "568.749188"}, "127.859112064"},
+	{{"18.13425706", "231.1", "6.97", "5", "23.5322", "93.245043"}, "62.99691668"},
+	{{"41.1351937", "7.311876888", "77.650142438"}, "42.032404342"},
+	{{"2.46", "2.9", "202.8446457", "73.46", "97.306"}, "75.7941291"},
+	{{"3.3281576", "500.2156"}, "251.7718788"},
+	{{"0.41"}, "0.41"},
+	{{"440", "709.3393", "69.85"}, "406.3964"},
+	{{"7.244343", "634.67742751", "507.36494006"}, "383.09557019"},
+	{{"42.1807878", "90.3"}, "66.2403939"},
+	{{"516.41607", "2.08992467", "874.384", "27.97420819"}, "355.21605072"},
+	{{"409.187034978", "7.8267"}, "208.506867489"},
+	{{"776.5", "94", "6.74422", "9", "8.5", "57.46"}, "158.7007"},
+	{{"43.06162"}, "43.06162"},
+	{{"84.7"}, "84.7"}
+};
+
+
+// Function prototypes
+
+// Get average price
+static string getAveragePrice(const vector<const char *> &prices);
+
+
+// Main function
+int main() {
+
+	// Initialize number of failures
+	size_t numberOfFailures = 0;
+	
+	// Go through all multiply strings tests
+	for(const tuple<const char *, const char *, const char *> &test : MULTIPLY_STRINGS_TESTS) {
+	
+		// Check if multiplying strings didn't produce the expected result
+		const string result = Common::multiplyStrings(get<0>(test), get<1>(test));
+		if(result != get<2>(test)) {
+		
+			// Display message
+			cout << "Multiplying " << get<0>(test) << " by " << get<1>(test) << " produced " << result << " instead of " << get<2>(test) << endl;
+			
+			// Increment number of failures
+			++numberOfFailures;
+		}
+		
+		// Go through both strings
+		for(const char *value : {get<0>(test), get<1>(test)}) {
+		
+			// Get value's precision
+			const char *decimal = strchr(value, '.');
+			const size_t precision = decimal ? strlen(decimal + sizeof('.')) : 0;
+			
+			// Check if value doesn't round trip
+			const string result = Decimal(value).toString(precision);
+			if(result != value) {
+			
+				// Display message
+				cout << "Round tripping " << value << " produced " << result << endl;
+				
+				// Increment number of failures
+				++numberOfFailures;
+			}
+		}
+	}
+	
+	// Go through all average price tests
+	for(const tuple<vector<const char *>, const char *> &test : AVERAGE_PRICE_TESTS) {
+	
+		// Check if getting average price didn't produce the expected result
+		const string result = getAveragePrice(get<0>(test));
+		if(result != get<1>(test)) {
+		
+			// Display message
+			cout << "Averaging prices produced " << result << " instead of " << get<1>(test) << endl;
+			
+			// Increment number of failures
+			++numberOfFailures;
+		}
+	}
+	
+	// Check if divide didn't report overflow when scaling the numerator
+	try {
+	
+		// Divide the largest value by one with the maximum scale
+		Decimal("340282366920938463463374607431768211455").divide(Decimal(static_cast<uint64_t>(1)), Decimal::MAXIMUM_SCALE);
+		
+		// Display message
+		cout << "Dividing with an overflowing numerator didn't fail" << endl;
+		
+		// Increment number of failures
+		++numberOfFailures;
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+	}
+	
+	// Check if any tests failed
+	if(numberOfFailures) {
+	
+		// Display message
+		cout << numberOfFailures << " decimal test(s) failed" << endl;
+		
+		// Return failure
+		return EXIT_FAILURE;
+	}
+	
+	// Display message
+	cout << "Decimal tests passed" << endl;
+	
+	// Return success
+	return EXIT_SUCCESS;
+}
+
+// Get average price
+string getAveragePrice(const vector<const char *> &prices) {
+
+	// Initialize average price
+	Decimal averagePrice;
+	
+	// Initialize precision
+	size_t precision = 0;
+	
+	// Go through all prices
+	for(const char *price : prices) {
+	
+		// Add price to average price
+		averagePrice = averagePrice + Decimal(price);
+		
+		// Check if price has a decimal
+		const char *decimal = strchr(price, '.');
+		if(decimal) {
+		
+			// Update precision
+			precision = max(precision, strlen(decimal + sizeof('.')));
+		}
+	}
+	
+	// Divide average price by the number of prices
+	averagePrice = averagePrice.divide(Decimal(static_cast<uint64_t>(prices.size())), Decimal::MAXIMUM_SCALE);
+	
+	// Get result
+	string result = averagePrice.toString(precision);
+	
+	// Check if result isn't zero and it has precision
+	if(result != "0" && precision) {
+	
+		// Check if result has a trailing zero
+		if(result.back() == '0') {
+		
+			// Remove trailing zeros from result
+			result = result.substr(0, result.find_last_not_of('0') + sizeof('0'));
+		}
+		
+		// Check if result has a trailing decimal
+		if(result.back() == '.') {
+		
+			// Remove trailing decimal from result
+			result.pop_back();
+		}
+	}
+	
+	// Return result
+	return result;
+}
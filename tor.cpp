@@ -20,6 +20,12 @@ static const char ADDRESS_CHECKSUM_SEED[] = ".onion checksum";
 // Address checksum digest algorithm
 static const char *ADDRESS_CHECKSUM_DIGEST_ALGORITHM = "SHA3-256";
 
+// Address checksum digest
+static thread_local const unique_ptr<EVP_MD, decltype(&EVP_MD_free)> addressChecksumDigest(EVP_MD_fetch(nullptr, ADDRESS_CHECKSUM_DIGEST_ALGORITHM, nullptr), EVP_MD_free);
+
+// Address checksum digest context
+static thread_local const unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> addressChecksumDigestContext(EVP_MD_CTX_new(), EVP_MD_CTX_free);
+
 // Address version
 static const uint8_t ADDRESS_VERSION = 3;
 
@@ -59,30 +65,28 @@ void getAddressChecksum(uint8_t addressChecksum[ADDRESS_CHECKSUM_SIZE], const ui
 	addressData[sizeof(ADDRESS_CHECKSUM_SEED) - sizeof('\0') + Crypto::ED25519_PUBLIC_KEY_SIZE] = ADDRESS_VERSION;
 	
 	// Check if getting digest failed
-	const unique_ptr<EVP_MD, decltype(&EVP_MD_free)> digest(EVP_MD_fetch(nullptr, ADDRESS_CHECKSUM_DIGEST_ALGORITHM, nullptr), EVP_MD_free);
-	if(!digest) {
+	if(!addressChecksumDigest) {
 	
 		// Throw exception
 		throw runtime_error("Getting digest failed");
 	}
 	
 	// Check if creating digest context failed
-	const unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> digestContext(EVP_MD_CTX_new(), EVP_MD_CTX_free);
-	if(!digestContext) {
+	if(!addressChecksumDigestContext) {
 	
 		// Throw exception
 		throw runtime_error("Creating digest context failed");
 	}
 	
 	// Check if initializing digest context failed
-	if(!EVP_DigestInit_ex2(digestContext.get(), digest.get(), nullptr)) {
+	if(!EVP_DigestInit_ex2(addressChecksumDigestContext.get(), addressChecksumDigest.get(), nullptr)) {
 	
 		// Throw exception
 		throw runtime_error("Initializing digest context failed");
 	}
 	
 	// Check if hashing address data failed
-	if(!EVP_DigestUpdate(digestContext.get(), addressData, sizeof(addressData))) {
+	if(!EVP_DigestUpdate(addressChecksumDigestContext.get(), addressData, sizeof(addressData))) {
 	
 		// Throw exception
 		throw runtime_error("Hashing address data failed");
@@ -98,7 +102,7 @@ void getAddressChecksum(uint8_t addressChecksum[ADDRESS_CHECKSUM_SIZE], const ui
 		// End
 		OSSL_PARAM_END
 	};
-	if(!EVP_MD_get_params(digest.get(), getDigestLengthParameters)) {
+	if(!EVP_MD_get_params(addressChecksumDigest.get(), getDigestLengthParameters)) {
 	
 		// Throw exception
 		throw runtime_error("Getting digest length failed");
@@ -107,7 +111,7 @@ void getAddressChecksum(uint8_t addressChecksum[ADDRESS_CHECKSUM_SIZE], const ui
 	// Check if getting hash failed
 	uint8_t hash[digestLength];
 	unsigned int hashLength;
-	if(!EVP_DigestFinal_ex(digestContext.get(), hash, &hashLength) || hashLength != sizeof(hash)) {
+	if(!EVP_DigestFinal_ex(addressChecksumDigestContext.get(), hash, &hashLength) || hashLength != sizeof(hash)) {
 	
 		// Throw exception
 		throw runtime_error("Getting hash failed");
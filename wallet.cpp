@@ -51,6 +51,9 @@ static const char *SEED_ENCRYPTION_ALGORITHM = "AES-256-GCM";
 // Extended private key MAC algorithm
 static const char *EXTENDED_PRIVATE_KEY_MAC_ALGORITHM = "HMAC";
 
+// Extended private key MAC
+static thread_local const unique_ptr<EVP_MAC, decltype(&EVP_MAC_free)> extendedPrivateKeyMac(EVP_MAC_fetch(nullptr, EXTENDED_PRIVATE_KEY_MAC_ALGORITHM, nullptr), EVP_MAC_free);
+
 // Extended private key MAC digest
 static const char *EXTENDED_PRIVATE_KEY_MAC_DIGEST = "SHA-512";
 
@@ -60,12 +63,18 @@ static const char EXTENDED_PRIVATE_KEY_MAC_SEED[] = "IamVoldemort";
 // Bulletproof hash digest algorithm
 static const char *BULLETPROOF_HASH_DIGEST_ALGORITHM = "BLAKE2B-512";
 
+// Bulletproof hash digest
+static thread_local const unique_ptr<EVP_MD, decltype(&EVP_MD_free)> bulletproofHashDigest(EVP_MD_fetch(nullptr, BULLETPROOF_HASH_DIGEST_ALGORITHM, nullptr), EVP_MD_free);
+
 // Bulletproof hash digest algorithm
 static const size_t BULLETPROOF_HASH_DIGEST_SIZE = 32;
 
 // Bulletproof nonce MAC algorithm
 static const char *BULLETPROOF_NONCE_MAC_ALGORITHM = "BLAKE2BMAC";
 
+// Bulletproof nonce MAC
+static thread_local const unique_ptr<EVP_MAC, decltype(&EVP_MAC_free)> bulletproofNonceMac(EVP_MAC_fetch(nullptr, BULLETPROOF_NONCE_MAC_ALGORITHM, nullptr), EVP_MAC_free);
+
 // Bulletproof nonce MAC size
 static const size_t BULLETPROOF_NONCE_MAC_SIZE = 32;
 
@@ -75,6 +84,9 @@ static const uint64_t ADDRESS_PRIVATE_KEY_COMMITTED_VALUE = 713;
 // Address private key MAC algorithm
 static const char *ADDRESS_PRIVATE_KEY_MAC_ALGORITHM = "HMAC";
 
+// Address private key MAC
+static thread_local const unique_ptr<EVP_MAC, decltype(&EVP_MAC_free)> addressPrivateKeyMac(EVP_MAC_fetch(nullptr, ADDRESS_PRIVATE_KEY_MAC_ALGORITHM, nullptr), EVP_MAC_free);
+
 // Address private key MAC digest
 static const char *ADDRESS_PRIVATE_KEY_MAC_DIGEST = "SHA-512";
 
@@ -84,6 +96,9 @@ static const char ADDRESS_PRIVATE_KEY_MAC_SEED[] = "Grinbox_seed";
 // Address message encryption algorithm
 static const char *ADDRESS_MESSAGE_ENCRYPTION_ALGORITHM = "CHACHA20-POLY1305";
 
+// Address message encryption cipher
+static thread_local const unique_ptr<EVP_CIPHER, decltype(&EVP_CIPHER_free)> addressMessageEncryptionCipher(EVP_CIPHER_fetch(nullptr, ADDRESS_MESSAGE_ENCRYPTION_ALGORITHM, nullptr), EVP_CIPHER_free);
+
 // Onion Service index
 static const uint64_t ONION_SERVICE_INDEX = 0;
 
@@ -863,15 +878,14 @@ bool Wallet::open(sqlite3 *databaseConnection, const char *providedPassword, con
 		explicit_bzero(password.data(), password.capacity());
 		
 		// Check if getting MAC failed
-		const unique_ptr<EVP_MAC, decltype(&EVP_MAC_free)> mac(EVP_MAC_fetch(nullptr, EXTENDED_PRIVATE_KEY_MAC_ALGORITHM, nullptr), EVP_MAC_free);
-		if(!mac) {
+		if(!extendedPrivateKeyMac) {
 		
 			// Throw exception
 			throw runtime_error("Getting MAC failed");
 		}
 		
 		// Check if creating MAC context failed
-		const unique_ptr<EVP_MAC_CTX, decltype(&EVP_MAC_CTX_free)> macContext(EVP_MAC_CTX_new(mac.get()), EVP_MAC_CTX_free);
+		const unique_ptr<EVP_MAC_CTX, decltype(&EVP_MAC_CTX_free)> macContext(EVP_MAC_CTX_new(extendedPrivateKeyMac.get()), EVP_MAC_CTX_free);
 		if(!macContext) {
 		
 			// Throw exception
@@ -1013,43 +1027,6 @@ void Wallet::displayRootPublicKey() const {
 	explicit_bzero(rootPublicKey, sizeof(rootPublicKey));
 }
 
-// Get blinding factor
-bool Wallet::getBlindingFactor(uint8_t blindingFactor[Crypto::BLINDING_FACTOR_SIZE], const uint64_t identifierPath, const uint64_t value) const {
-
-	// Set child path to a non-standard path used to allow 2^64 unique identifiers that other wallet software won't use
-	const uint32_t childPath[] = {
-		static_cast<uint32_t>(identifierPath >> numeric_limits<uint32_t>::digits),
-		static_cast<uint32_t>(identifierPath & numeric_limits<uint32_t>::max()),
-		0,
-		0
-	};
-	
-	// Check if deriving the child extended private key at the child path failed
-	uint8_t childExtendedPrivateKey[sizeof(extendedPrivateKey)];
-	memcpy(childExtendedPrivateKey, extendedPrivateKey, sizeof(extendedPrivateKey));
-	if(!Crypto::deriveChildExtendedPrivateKey(childExtendedPrivateKey, childPath, sizeof(childPath) / sizeof(childPath[0]))) {
-	
-		// Return false
-		return false;
-	}
-	
-	// Check if getting the blinding factor from the child extended private key's private key and value failed
-	if(!Crypto::getBlindingFactor(blindingFactor, childExtendedPrivateKey, value)) {
-	
-		// Securely clear child extended private key
-		explicit_bzero(childExtendedPrivateKey, sizeof(childExtendedPrivateKey));
-		
-		// Return false
-		return false;
-	}
-	
-	// Securely clear child extended private key
-	explicit_bzero(childExtendedPrivateKey, sizeof(childExtendedPrivateKey));
-	
-	// Return true
-	return true;
-}
-
 // Get commitment
 bool Wallet::getCommitment(uint8_t commitment[Crypto::COMMITMENT_SIZE], const uint64_t identifierPath, const uint64_t value) const {
 
@@ -1101,8 +1078,8 @@ bool Wallet::getCommitment(uint8_t commitment[Crypto::COMMITMENT_SIZE], const ui
 	return true;
 }
 
-// Get Bulletproof
-bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const uint64_t identifierPath, const uint64_t value) const {
+// Get output
+bool Wallet::getOutput(uint8_t blindingFactor[Crypto::BLINDING_FACTOR_SIZE], uint8_t commitment[Crypto::COMMITMENT_SIZE], uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const uint64_t identifierPath, const uint64_t value) const {
 
 	// Set child path to a non-standard path used to allow 2^64 unique identifiers that other wallet software won't use
 	uint32_t childPath[] = {
@@ -1122,9 +1099,11 @@ bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const
 	}
 	
 	// Check if getting the blinding factor from the child extended private key's private key and value failed
-	uint8_t blindingFactor[Crypto::BLINDING_FACTOR_SIZE];
 	if(!Crypto::getBlindingFactor(blindingFactor, childExtendedPrivateKey, value)) {
 	
+		// Securely clear blinding factor
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
+		
 		// Securely clear child extended private key
 		explicit_bzero(childExtendedPrivateKey, sizeof(childExtendedPrivateKey));
 		
@@ -1136,22 +1115,20 @@ bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const
 	explicit_bzero(childExtendedPrivateKey, sizeof(childExtendedPrivateKey));
 	
 	// Check if getting commitment failed
-	uint8_t commitment[Crypto::COMMITMENT_SIZE];
 	if(!Crypto::getCommitment(commitment, blindingFactor, value)) {
 	
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
 	}
 	
 	// Check if getting digest failed
-	const unique_ptr<EVP_MD, decltype(&EVP_MD_free)> digest(EVP_MD_fetch(nullptr, BULLETPROOF_HASH_DIGEST_ALGORITHM, nullptr), EVP_MD_free);
-	if(!digest) {
+	if(!bulletproofHashDigest) {
 	
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
@@ -1162,7 +1139,7 @@ bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const
 	if(!digestContext) {
 	
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
@@ -1177,10 +1154,10 @@ bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const
 		// End
 		OSSL_PARAM_END
 	};
-	if(!EVP_DigestInit_ex2(digestContext.get(), digest.get(), setDigestLengthParameters)) {
+	if(!EVP_DigestInit_ex2(digestContext.get(), bulletproofHashDigest.get(), setDigestLengthParameters)) {
 	
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
@@ -1190,7 +1167,7 @@ bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const
 	if(!EVP_DigestUpdate(digestContext.get(), extendedPrivateKey, Crypto::SECP256K1_PRIVATE_KEY_SIZE)) {
 	
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
@@ -1205,35 +1182,34 @@ bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const
 		explicit_bzero(privateHash, sizeof(privateHash));
 		
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
 	}
 	
 	// Check if getting MAC failed
-	const unique_ptr<EVP_MAC, decltype(&EVP_MAC_free)> mac(EVP_MAC_fetch(nullptr, BULLETPROOF_NONCE_MAC_ALGORITHM, nullptr), EVP_MAC_free);
-	if(!mac) {
+	if(!bulletproofNonceMac) {
 	
 		// Securely clear private hash
 		explicit_bzero(privateHash, sizeof(privateHash));
 		
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
 	}
 	
 	// Check if creating MAC context failed
-	const unique_ptr<EVP_MAC_CTX, decltype(&EVP_MAC_CTX_free)> macContext(EVP_MAC_CTX_new(mac.get()), EVP_MAC_CTX_free);
+	const unique_ptr<EVP_MAC_CTX, decltype(&EVP_MAC_CTX_free)> macContext(EVP_MAC_CTX_new(bulletproofNonceMac.get()), EVP_MAC_CTX_free);
 	if(!macContext) {
 	
 		// Securely clear private hash
 		explicit_bzero(privateHash, sizeof(privateHash));
 		
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
@@ -1248,13 +1224,13 @@ bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const
 		// End
 		OSSL_PARAM_END
 	};
-	if(!EVP_MAC_init(macContext.get(), commitment, sizeof(commitment), setMacLengthParameters)) {
+	if(!EVP_MAC_init(macContext.get(), commitment, Crypto::COMMITMENT_SIZE, setMacLengthParameters)) {
 	
 		// Securely clear private hash
 		explicit_bzero(privateHash, sizeof(privateHash));
 		
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
@@ -1267,7 +1243,7 @@ bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const
 		explicit_bzero(privateHash, sizeof(privateHash));
 		
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
@@ -1285,7 +1261,7 @@ bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const
 		explicit_bzero(privateNonce, sizeof(privateNonce));
 		
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
@@ -1298,7 +1274,7 @@ bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const
 		explicit_bzero(privateNonce, sizeof(privateNonce));
 		
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
@@ -1312,14 +1288,14 @@ bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const
 		explicit_bzero(privateNonce, sizeof(privateNonce));
 		
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
 	}
 	
 	// Check if initializing digest context failed
-	if(!EVP_DigestInit_ex2(digestContext.get(), digest.get(), setDigestLengthParameters)) {
+	if(!EVP_DigestInit_ex2(digestContext.get(), bulletproofHashDigest.get(), setDigestLengthParameters)) {
 	
 		// Securely clear public key
 		explicit_bzero(publicKey, sizeof(publicKey));
@@ -1328,7 +1304,7 @@ bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const
 		explicit_bzero(privateNonce, sizeof(privateNonce));
 		
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
@@ -1344,7 +1320,7 @@ bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const
 		explicit_bzero(privateNonce, sizeof(privateNonce));
 		
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
@@ -1365,14 +1341,14 @@ bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const
 		explicit_bzero(privateNonce, sizeof(privateNonce));
 		
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
 	}
 	
 	// Check if initializing MAC context with the commitment as the key failed
-	if(!EVP_MAC_init(macContext.get(), commitment, sizeof(commitment), setMacLengthParameters)) {
+	if(!EVP_MAC_init(macContext.get(), commitment, Crypto::COMMITMENT_SIZE, setMacLengthParameters)) {
 	
 		// Securely clear rewind hash
 		explicit_bzero(rewindHash, sizeof(rewindHash));
@@ -1381,7 +1357,7 @@ bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const
 		explicit_bzero(privateNonce, sizeof(privateNonce));
 		
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
@@ -1397,7 +1373,7 @@ bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const
 		explicit_bzero(privateNonce, sizeof(privateNonce));
 		
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
@@ -1415,7 +1391,7 @@ bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const
 		explicit_bzero(privateNonce, sizeof(privateNonce));
 		
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
@@ -1428,7 +1404,7 @@ bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const
 		explicit_bzero(privateNonce, sizeof(privateNonce));
 		
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
@@ -1459,7 +1435,7 @@ bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const
 		explicit_bzero(privateNonce, sizeof(privateNonce));
 		
 		// Securely clear blinding factor
-		explicit_bzero(blindingFactor, sizeof(blindingFactor));
+		explicit_bzero(blindingFactor, Crypto::BLINDING_FACTOR_SIZE);
 		
 		// Return false
 		return false;
@@ -1468,9 +1444,6 @@ bool Wallet::getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const
 	// Securely clear private nonce
 	explicit_bzero(privateNonce, sizeof(privateNonce));
 	
-	// Securely clear blinding factor
-	explicit_bzero(blindingFactor, sizeof(blindingFactor));
-	
 	// Return true
 	return true;
 }
@@ -1798,8 +1771,7 @@ pair<vector<uint8_t>, array<uint8_t, Crypto::CHACHA20_NONCE_SIZE>> Wallet::encry
 	explicit_bzero(x25519PrivateKey, sizeof(x25519PrivateKey));
 	
 	// Check if getting cipher failed
-	const unique_ptr<EVP_CIPHER, decltype(&EVP_CIPHER_free)> cipher(EVP_CIPHER_fetch(nullptr, ADDRESS_MESSAGE_ENCRYPTION_ALGORITHM, nullptr), EVP_CIPHER_free);
-	if(!cipher) {
+	if(!addressMessageEncryptionCipher) {
 	
 		// Securely clear shared private key
 		explicit_bzero(sharedKey, sizeof(sharedKey));
@@ -1820,7 +1792,7 @@ pair<vector<uint8_t>, array<uint8_t, Crypto::CHACHA20_NONCE_SIZE>> Wallet::encry
 	}
 
 	// Check if initializing cipher context failed
-	if(!EVP_EncryptInit_ex2(cipherContext.get(), cipher.get(), sharedKey, nonce.data(), nullptr)) {
+	if(!EVP_EncryptInit_ex2(cipherContext.get(), addressMessageEncryptionCipher.get(), sharedKey, nonce.data(), nullptr)) {
 	
 		// Securely clear shared private key
 		explicit_bzero(sharedKey, sizeof(sharedKey));
@@ -1889,7 +1861,7 @@ pair<vector<uint8_t>, array<uint8_t, Crypto::CHACHA20_NONCE_SIZE>> Wallet::encry
 }
 
 // Decrypt address message
-vector<uint8_t> Wallet::decryptAddressMessage(const uint8_t *encryptedData, const size_t length, const uint8_t nonce[Crypto::CHACHA20_NONCE_SIZE], const uint8_t senderPublicKey[Crypto::ED25519_PUBLIC_KEY_SIZE], const uint64_t index, const uint8_t version) const {
+size_t Wallet::decryptAddressMessage(uint8_t *encryptedData, const size_t length, const uint8_t nonce[Crypto::CHACHA20_NONCE_SIZE], const uint8_t senderPublicKey[Crypto::ED25519_PUBLIC_KEY_SIZE], const uint64_t index, const uint8_t version) const {
 	
 	// Check if getting address private key at the index failed
 	uint8_t addressPrivateKey[Crypto::ED25519_PRIVATE_KEY_SIZE];
@@ -1960,8 +1932,7 @@ vector<uint8_t> Wallet::decryptAddressMessage(const uint8_t *encryptedData, cons
 	explicit_bzero(x25519PrivateKey, sizeof(x25519PrivateKey));
 	
 	// Check if getting cipher failed
-	const unique_ptr<EVP_CIPHER, decltype(&EVP_CIPHER_free)> cipher(EVP_CIPHER_fetch(nullptr, ADDRESS_MESSAGE_ENCRYPTION_ALGORITHM, nullptr), EVP_CIPHER_free);
-	if(!cipher) {
+	if(!addressMessageEncryptionCipher) {
 	
 		// Securely clear shared private key
 		explicit_bzero(sharedKey, sizeof(sharedKey));
@@ -1982,7 +1953,7 @@ vector<uint8_t> Wallet::decryptAddressMessage(const uint8_t *encryptedData, cons
 	}
 
 	// Check if initializing cipher context failed
-	if(!EVP_DecryptInit_ex2(cipherContext.get(), cipher.get(), sharedKey, nonce, nullptr)) {
+	if(!EVP_DecryptInit_ex2(cipherContext.get(), addressMessageEncryptionCipher.get(), sharedKey, nonce, nullptr)) {
 	
 		// Securely clear shared private key
 		explicit_bzero(sharedKey, sizeof(sharedKey));
@@ -2004,11 +1975,17 @@ vector<uint8_t> Wallet::decryptAddressMessage(const uint8_t *encryptedData, cons
 	// Get encrypted data's tag
 	const uint8_t *tag = &encryptedData[length - Crypto::POLY1305_TAG_SIZE];
 
-	// Check if decrypting encrypted data failed
-	vector<uint8_t> data(length - Crypto::POLY1305_TAG_SIZE);
-	int dataLength;
-	if(!EVP_DecryptUpdate(cipherContext.get(), data.data(), &dataLength, encryptedData, data.size()) || static_cast<size_t>(dataLength) != data.size()) {
+	// Get data's length
+	const size_t dataLength = length - Crypto::POLY1305_TAG_SIZE;
+	
+	// Check if decrypting encrypted data in place failed
+	uint8_t *data = encryptedData;
+	int decryptedLength;
+	if(!EVP_DecryptUpdate(cipherContext.get(), data, &decryptedLength, encryptedData, dataLength) || static_cast<size_t>(decryptedLength) != dataLength) {
 	
+		// Securely clear data since it may be partially decrypted
+		explicit_bzero(data, dataLength);
+		
 		// Throw exception
 		throw runtime_error("Decrypting encrypted data failed");
 	}
@@ -2024,27 +2001,36 @@ vector<uint8_t> Wallet::decryptAddressMessage(const uint8_t *encryptedData, cons
 	};
 	if(!EVP_CIPHER_CTX_set_params(cipherContext.get(), setTagParameters)) {
 	
+		// Securely clear decrypted data
+		explicit_bzero(data, dataLength);
+		
 		// Throw exception
 		throw runtime_error("Setting tag failed");
 	}
 
 	// Check if finishing decrypting encrypted data failed
-	if(!EVP_DecryptFinal_ex(cipherContext.get(), data.data(), &dataLength) || dataLength) {
+	if(!EVP_DecryptFinal_ex(cipherContext.get(), data, &decryptedLength) || decryptedLength) {
 	
+		// Securely clear decrypted data
+		explicit_bzero(data, dataLength);
+		
 		// Throw exception
 		throw runtime_error("Finishing decrypting encrypted data failed");
 	}
 	
 	// Check if data doesn't contain a checksum
-	if(data.size() < sizeof(uint32_t)) {
+	if(dataLength < sizeof(uint32_t)) {
 	
+		// Securely clear decrypted data
+		explicit_bzero(data, dataLength);
+		
 		// Throw exception
 		throw runtime_error("Data doesn't contain a checksum");
 	}
 	
 	// Get data's checksum
 	uint32_t checksum;
-	memcpy(&checksum, &data[data.size() - sizeof(checksum)], sizeof(checksum));
+	memcpy(&checksum, &data[dataLength - sizeof(checksum)], sizeof(checksum));
 	
 	// Check if little endian
 	#if BYTE_ORDER == LITTLE_ENDIAN
@@ -2058,20 +2044,20 @@ vector<uint8_t> Wallet::decryptAddressMessage(const uint8_t *encryptedData, cons
 	expectedChecksum = crc32_z(expectedChecksum, &version, sizeof(version));
 	expectedChecksum = crc32_z(expectedChecksum, senderPublicKey, Crypto::ED25519_PUBLIC_KEY_SIZE);
 	expectedChecksum = crc32_z(expectedChecksum, publicKey, sizeof(publicKey));
-	expectedChecksum = crc32_z(expectedChecksum, data.data(), data.size() - sizeof(checksum));
+	expectedChecksum = crc32_z(expectedChecksum, data, dataLength - sizeof(checksum));
 	
 	// Check if checksum is invalid
 	if(checksum != expectedChecksum) {
 	
+		// Securely clear decrypted data
+		explicit_bzero(data, dataLength);
+		
 		// Throw exception
 		throw runtime_error("Checksum is invalid");
 	}
 	
-	// Remove checksum from data
-	data.resize(data.size() - sizeof(checksum));
-	
-	// Return data
-	return data;
+	// Return data's length without its checksum
+	return dataLength - sizeof(checksum);
 }
 
 // Get Onion Service private key
@@ -2153,8 +2139,7 @@ bool Wallet::getAddressPrivateKey(uint8_t addressPrivateKey[Crypto::SECP256K1_PR
 	}
 	
 	// Check if getting MAC failed
-	const unique_ptr<EVP_MAC, decltype(&EVP_MAC_free)> mac(EVP_MAC_fetch(nullptr, ADDRESS_PRIVATE_KEY_MAC_ALGORITHM, nullptr), EVP_MAC_free);
-	if(!mac) {
+	if(!addressPrivateKeyMac) {
 	
 		// Securely blinding factor key
 		explicit_bzero(blindingFactor, sizeof(blindingFactor));
@@ -2164,7 +2149,7 @@ bool Wallet::getAddressPrivateKey(uint8_t addressPrivateKey[Crypto::SECP256K1_PR
 	}
 	
 	// Check if creating MAC context failed
-	const unique_ptr<EVP_MAC_CTX, decltype(&EVP_MAC_CTX_free)> macContext(EVP_MAC_CTX_new(mac.get()), EVP_MAC_CTX_free);
+	const unique_ptr<EVP_MAC_CTX, decltype(&EVP_MAC_CTX_free)> macContext(EVP_MAC_CTX_new(addressPrivateKeyMac.get()), EVP_MAC_CTX_free);
 	if(!macContext) {
 	
 		// Securely blinding factor key
@@ -2277,7 +2262,6 @@ bool Wallet::getAddressPrivateKey(uint8_t addressPrivateKey[Crypto::SECP256K1_PR
 bool isValidSeed(const uint8_t seed[Mnemonic::SEED_SIZE]) {
 
 	// Check if getting extended private key MAC failed
-	const unique_ptr<EVP_MAC, decltype(&EVP_MAC_free)> extendedPrivateKeyMac(EVP_MAC_fetch(nullptr, EXTENDED_PRIVATE_KEY_MAC_ALGORITHM, nullptr), EVP_MAC_free);
 	if(!extendedPrivateKeyMac) {
 	
 		// Throw exception
@@ -2374,7 +2358,6 @@ bool isValidSeed(const uint8_t seed[Mnemonic::SEED_SIZE]) {
 	explicit_bzero(extendedPrivateKey, sizeof(extendedPrivateKey));
 	
 	// Check if getting address private key MAC failed
-	const unique_ptr<EVP_MAC, decltype(&EVP_MAC_free)> addressPrivateKeyMac(EVP_MAC_fetch(nullptr, ADDRESS_PRIVATE_KEY_MAC_ALGORITHM, nullptr), EVP_MAC_free);
 	if(!addressPrivateKeyMac) {
 	
 		// Securely blinding factor key
@@ -33,14 +33,11 @@ class Wallet final {
 		// Display root public key
 		void displayRootPublicKey() const;
 		
-		// Get blinding factor
-		bool getBlindingFactor(uint8_t blindingFactor[Crypto::BLINDING_FACTOR_SIZE], const uint64_t identifierPath, const uint64_t value) const;
-		
 		// Get commitment
 		bool getCommitment(uint8_t commitment[Crypto::COMMITMENT_SIZE], const uint64_t identifierPath, const uint64_t value) const;
 		
-		// Get Bulletproof
-		bool getBulletproof(uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const uint64_t identifierPath, const uint64_t value) const;
+		// Get output
+		bool getOutput(uint8_t blindingFactor[Crypto::BLINDING_FACTOR_SIZE], uint8_t commitment[Crypto::COMMITMENT_SIZE], uint8_t bulletproof[Crypto::BULLETPROOF_SIZE], const uint64_t identifierPath, const uint64_t value) const;
 		
 		// Get Tor payment proof address
 		string getTorPaymentProofAddress(const uint64_t index) const;
@@ -64,7 +61,7 @@ class Wallet final {
 		pair<vector<uint8_t>, array<uint8_t, Crypto::CHACHA20_NONCE_SIZE>> encryptAddressMessage(const uint8_t *data, const size_t length, const uint8_t recipientPublicKey[Crypto::ED25519_PUBLIC_KEY_SIZE], const uint64_t index, const uint8_t version) const;
 		
 		// Decrypt address message
-		vector<uint8_t> decryptAddressMessage(const uint8_t *encryptedData, const size_t length, const uint8_t nonce[Crypto::CHACHA20_NONCE_SIZE], const uint8_t senderPublicKey[Crypto::ED25519_PUBLIC_KEY_SIZE], const uint64_t index, const uint8_t version) const;
+		size_t decryptAddressMessage(uint8_t *encryptedData, const size_t length, const uint8_t nonce[Crypto::CHACHA20_NONCE_SIZE], const uint8_t senderPublicKey[Crypto::ED25519_PUBLIC_KEY_SIZE], const uint64_t index, const uint8_t version) const;
 		
 		// Get Onion Service private key
 		string getOnionServicePrivateKey() const;